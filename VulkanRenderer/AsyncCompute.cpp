@@ -0,0 +1,217 @@
+#include "AsyncCompute.h"
+#include "VulkanInitializers.h"
+#include <iostream>
+#include <algorithm>
+
+namespace VulkanCore
+{
+	GpuTimer CreateGpuTimer(GraphicsDevice& GFXDevice, const uint32_t QueueFamilyIndex, const uint32_t FrameCount, const uint32_t QueriesPerFrame)
+	{
+		GpuTimer RetVal;
+		RetVal.QueriesPerFrame = QueriesPerFrame;
+		RetVal.FrameCount = FrameCount;
+		RetVal.TimestampPeriod = GFXDevice.Properties.limits.timestampPeriod;
+		RetVal.Written.resize(FrameCount, false);
+
+		uint32_t FamilyCount = 0;
+		vkGetPhysicalDeviceQueueFamilyProperties(GFXDevice.PhysicalDevice, &FamilyCount, nullptr);
+		std::vector<VkQueueFamilyProperties> Families{ FamilyCount };
+		vkGetPhysicalDeviceQueueFamilyProperties(GFXDevice.PhysicalDevice, &FamilyCount, Families.data());
+
+		const uint32_t ValidBits = QueueFamilyIndex < FamilyCount ? Families[QueueFamilyIndex].timestampValidBits : 0;
+		if (ValidBits == 0)
+		{
+			std::cout << "Queue family " << QueueFamilyIndex << " doesn't support timestamps" << std::endl;
+			return RetVal;
+		}
+		RetVal.ValidMask = ValidBits >= 64 ? ~0ull : ((1ull << ValidBits) - 1);
+
+		VkQueryPoolCreateInfo QueryPoolCreateInfo = {};
+		QueryPoolCreateInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+		QueryPoolCreateInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+		QueryPoolCreateInfo.queryCount = FrameCount * QueriesPerFrame;
+
+		VkResult R = vkCreateQueryPool(GFXDevice.Device, &QueryPoolCreateInfo, nullptr, &RetVal.QueryPool);
+		if (R != VK_SUCCESS)
+		{
+			std::cout << "Timestamp query pool creation failed with error: " << R << std::endl;
+			RetVal.QueryPool = VK_NULL_HANDLE;
+		}
+
+		return RetVal;
+	}
+
+	void CmdResetGpuTimer(VkCommandBuffer CommandBuffer, GpuTimer& Timer, const uint32_t FrameIndex)
+	{
+		if (Timer.QueryPool != VK_NULL_HANDLE)
+		{
+			vkCmdResetQueryPool(CommandBuffer, Timer.QueryPool, FrameIndex * Timer.QueriesPerFrame, Timer.QueriesPerFrame);
+		}
+	}
+
+	void CmdWriteGpuTimestamp(VkCommandBuffer CommandBuffer, GpuTimer& Timer, const uint32_t FrameIndex, const uint32_t Query, const VkPipelineStageFlagBits Stage)
+	{
+		if (Timer.QueryPool != VK_NULL_HANDLE)
+		{
+			vkCmdWriteTimestamp(CommandBuffer, Stage, Timer.QueryPool, FrameIndex * Timer.QueriesPerFrame + Query);
+			Timer.Written[FrameIndex] = true;
+		}
+	}
+
+	bool GetGpuTimestamps(GraphicsDevice& GFXDevice, const GpuTimer& Timer, const uint32_t FrameIndex, std::vector<uint64_t>& Nanoseconds)
+	{
+		if (Timer.QueryPool == VK_NULL_HANDLE || !Timer.Written[FrameIndex])
+		{
+			return false;
+		}
+
+		Nanoseconds.resize(Timer.QueriesPerFrame);
+		VkResult R = vkGetQueryPoolResults(GFXDevice.Device, Timer.QueryPool, FrameIndex * Timer.QueriesPerFrame, Timer.QueriesPerFrame,
+			Nanoseconds.size() * sizeof(uint64_t), Nanoseconds.data(), sizeof(uint64_t), VK_QUERY_RESULT_64_BIT);
+		if (R != VK_SUCCESS)
+		{
+			return false;
+		}
+
+		for (uint64_t& Value : Nanoseconds)
+		{
+			Value = static_cast<uint64_t> ((Value & Timer.ValidMask) * static_cast<double> (Timer.TimestampPeriod));
+		}
+		return true;
+	}
+
+	void DestroyGpuTimer(GraphicsDevice& GFXDevice, GpuTimer& Timer)
+	{
+		if (Timer.QueryPool != VK_NULL_HANDLE)
+		{
+			vkDestroyQueryPool(GFXDevice.Device, Timer.QueryPool, nullptr);
+		}
+		Timer = GpuTimer();
+	}
+
+	QueueOverlap MeasureQueueOverlap(const uint64_t GraphicsBegin, const uint64_t GraphicsEnd, const uint64_t ComputeBegin, const uint64_t ComputeEnd)
+	{
+		QueueOverlap RetVal;
+		RetVal.GraphicsMs = (GraphicsEnd - GraphicsBegin) / 1000000.0;
+		RetVal.ComputeMs = (ComputeEnd - ComputeBegin) / 1000000.0;
+
+		const uint64_t OverlapBegin = std::max(GraphicsBegin, ComputeBegin);
+		const uint64_t OverlapEnd = std::min(GraphicsEnd, ComputeEnd);
+		RetVal.OverlapMs = OverlapEnd > OverlapBegin ? (OverlapEnd - OverlapBegin) / 1000000.0 : 0.0;
+		return RetVal;
+	}
+
+	AsyncComputeQueue CreateAsyncComputeQueue(GraphicsDevice& GFXDevice, const uint32_t FrameCount)
+	{
+		AsyncComputeQueue RetVal;
+		RetVal.bDedicated = GFXDevice.bHasComputeQueue;
+		RetVal.Queue = GFXDevice.ComputeQueue;
+		RetVal.Family = GFXDevice.ComputeQueueIndex;
+		RetVal.GraphicsFamily = GFXDevice.GraphicsQueueIndex;
+
+		RetVal.CommandPool = CreateCommandPool(GFXDevice, RetVal.Family);
+		RetVal.CommandBuffers = AllocateCommandBuffers(GFXDevice, RetVal.CommandPool, FrameCount);
+		RetVal.Timeline = CreateQueueTimeline(GFXDevice, RetVal.Queue);
+		RetVal.FrameValues.resize(FrameCount, 0);
+
+		RetVal.Timer = CreateGpuTimer(GFXDevice, RetVal.Family, FrameCount, 2);
+
+		return RetVal;
+	}
+
+	VkCommandBuffer BeginAsyncCompute(GraphicsDevice& GFXDevice, AsyncComputeQueue& Compute, const uint32_t FrameIndex)
+	{
+		Compute.CurrentFrame = FrameIndex;
+		Compute.BufferAcquires.clear();
+		Compute.AcquireStages = 0;
+		Compute.ReleaseStages = 0;
+		Compute.WaitValue = 0;
+		Compute.WaitStages = 0;
+
+		WaitForTimeline(GFXDevice, Compute.Timeline, Compute.FrameValues[FrameIndex]);
+
+		VkCommandBuffer CommandBuffer = Compute.CommandBuffers[FrameIndex];
+		VkCommandBufferBeginInfo BeginInfo = {};
+		BeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+		BeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+		vkBeginCommandBuffer(CommandBuffer, &BeginInfo);
+
+		CmdResetGpuTimer(CommandBuffer, Compute.Timer, FrameIndex);
+		CmdWriteGpuTimestamp(CommandBuffer, Compute.Timer, FrameIndex, AsyncComputeBeginQuery, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT);
+
+		return CommandBuffer;
+	}
+
+	void CmdHandOffBufferToGraphics(AsyncComputeQueue& Compute, VkBuffer Buffer, const VkDeviceSize Offset, const VkDeviceSize Size,
+		const VkPipelineStageFlags SrcStage, const VkAccessFlags SrcAccess, const VkAccessFlags DstAccess, const VkPipelineStageFlags DstStage)
+	{
+		VkBufferMemoryBarrier Barrier = {};
+		Barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+		Barrier.srcAccessMask = SrcAccess;
+		Barrier.srcQueueFamilyIndex = Compute.bDedicated ? Compute.Family : VK_QUEUE_FAMILY_IGNORED;
+		Barrier.dstQueueFamilyIndex = Compute.bDedicated ? Compute.GraphicsFamily : VK_QUEUE_FAMILY_IGNORED;
+		Barrier.buffer = Buffer;
+		Barrier.offset = Offset;
+		Barrier.size = Size;
+
+		//On a shared queue the acquire alone is an ordinary barrier, recorded later in submission order
+		if (Compute.bDedicated)
+		{
+			//Release: the destination access is ignored here, visibility comes from the acquire
+			vkCmdPipelineBarrier(Compute.CommandBuffers[Compute.CurrentFrame], SrcStage, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0,
+				0, nullptr, 1, &Barrier, 0, nullptr);
+
+			//Acquire: same ownership fields, the timeline wait already made the writes available
+			Barrier.srcAccessMask = 0;
+		}
+		Barrier.dstAccessMask = DstAccess;
+		Compute.BufferAcquires.push_back(Barrier);
+		Compute.AcquireStages |= DstStage;
+		Compute.ReleaseStages |= SrcStage;
+	}
+
+	void SubmitAsyncCompute(GraphicsDevice& GFXDevice, AsyncComputeQueue& Compute, const std::vector<TimelineWait>& Waits)
+	{
+		const uint32_t FrameIndex = Compute.CurrentFrame;
+		VkCommandBuffer CommandBuffer = Compute.CommandBuffers[FrameIndex];
+
+		CmdWriteGpuTimestamp(CommandBuffer, Compute.Timer, FrameIndex, AsyncComputeEndQuery, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT);
+		vkEndCommandBuffer(CommandBuffer);
+
+		TimelineSubmitInfo SubmitInfo;
+		SubmitInfo.CommandBuffers.push_back(CommandBuffer);
+		for (const TimelineWait& Wait : Waits)
+		{
+			AddTimelineWait(SubmitInfo, *Wait.Timeline, Wait.Value, Wait.Stages);
+		}
+		Compute.FrameValues[FrameIndex] = SubmitToTimeline(GFXDevice, Compute.Timeline, SubmitInfo);
+
+		//Graphics only has to wait when it consumes something
+		if (!Compute.BufferAcquires.empty())
+		{
+			Compute.WaitValue = Compute.FrameValues[FrameIndex];
+			Compute.WaitStages = Compute.AcquireStages;
+		}
+	}
+
+	void CmdAcquireAsyncCompute(VkCommandBuffer GraphicsCommandBuffer, AsyncComputeQueue& Compute)
+	{
+		if (Compute.BufferAcquires.empty())
+		{
+			return;
+		}
+
+		//Chained to the timeline wait through the same stages, or straight after the compute side writes on a shared queue
+		const VkPipelineStageFlags SrcStages = Compute.bDedicated ? Compute.AcquireStages : Compute.ReleaseStages;
+		vkCmdPipelineBarrier(GraphicsCommandBuffer, SrcStages, Compute.AcquireStages, 0, 0, nullptr,
+			static_cast<uint32_t> (Compute.BufferAcquires.size()), Compute.BufferAcquires.data(), 0, nullptr);
+	}
+
+	void DestroyAsyncComputeQueue(GraphicsDevice& GFXDevice, AsyncComputeQueue& Compute)
+	{
+		DestroyQueueTimeline(GFXDevice, Compute.Timeline);
+		DestroyGpuTimer(GFXDevice, Compute.Timer);
+		vkDestroyCommandPool(GFXDevice.Device, Compute.CommandPool, nullptr);
+		Compute = AsyncComputeQueue();
+	}
+}
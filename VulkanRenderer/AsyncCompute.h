@@ -0,0 +1,103 @@
+#pragma once
+
+#include "vulkan\vulkan.h"
+#include "Sync.h"
+#include <vector>
+
+namespace VulkanCore
+{
+	struct GraphicsDevice;
+
+	//Timestamp queries for one queue family, QueriesPerFrame slots for each frame in flight
+	struct GpuTimer
+	{
+		VkQueryPool QueryPool = VK_NULL_HANDLE;
+		uint32_t QueriesPerFrame = 0;
+		uint32_t FrameCount = 0;
+
+		//Nanoseconds per tick (timestampPeriod) and the bits the family actually writes
+		float TimestampPeriod = 1.0f;
+		uint64_t ValidMask = 0;
+
+		//Per frame slot, true once its queries have been written at least once (unwritten queries never become available)
+		std::vector<bool> Written;
+	};
+
+	//Returns a timer with no query pool when the family doesn't support timestamps, all calls on it are then no-ops
+	GpuTimer CreateGpuTimer(GraphicsDevice& GFXDevice, const uint32_t QueueFamilyIndex, const uint32_t FrameCount, const uint32_t QueriesPerFrame);
+
+	//Resets FrameIndex's queries, must be recorded outside a render pass before any timestamp of that frame
+	void CmdResetGpuTimer(VkCommandBuffer CommandBuffer, GpuTimer& Timer, const uint32_t FrameIndex);
+
+	void CmdWriteGpuTimestamp(VkCommandBuffer CommandBuffer, GpuTimer& Timer, const uint32_t FrameIndex, const uint32_t Query, const VkPipelineStageFlagBits Stage);
+
+	//Reads FrameIndex's timestamps in nanoseconds without waiting, false when they aren't available yet
+	bool GetGpuTimestamps(GraphicsDevice& GFXDevice, const GpuTimer& Timer, const uint32_t FrameIndex, std::vector<uint64_t>& Nanoseconds);
+
+	void DestroyGpuTimer(GraphicsDevice& GFXDevice, GpuTimer& Timer);
+
+	//Busy time of two queues over a frame and how much of it ran concurrently, in milliseconds
+	//Both ranges come from timestamps of the same device, which share one clock on the drivers we target
+	struct QueueOverlap
+	{
+		double GraphicsMs = 0.0;
+		double ComputeMs = 0.0;
+		double OverlapMs = 0.0;
+	};
+
+	QueueOverlap MeasureQueueOverlap(const uint64_t GraphicsBegin, const uint64_t GraphicsEnd, const uint64_t ComputeBegin, const uint64_t ComputeEnd);
+
+	//Timestamp slots the async compute queue writes each frame
+	static const uint32_t AsyncComputeBeginQuery = 0;
+	static const uint32_t AsyncComputeEndQuery = 1;
+
+	//Per-frame command buffers on the compute-only queue, so dispatches run next to the graphics queue instead of between its passes
+	//Falls back to the graphics queue when the device has no compute-only family, everything still works but nothing overlaps
+	//Results graphics consumes are handed over with queue family ownership transfers and a wait on the compute timeline
+	struct AsyncComputeQueue
+	{
+		VkQueue Queue = VK_NULL_HANDLE;
+		uint32_t Family = 0;
+		uint32_t GraphicsFamily = 0;
+		bool bDedicated = false;
+
+		VkCommandPool CommandPool = VK_NULL_HANDLE;
+		std::vector<VkCommandBuffer> CommandBuffers;
+
+		//Compute queue counter, FrameValues holds what each frame slot's last submission signals
+		QueueTimeline Timeline;
+		std::vector<uint64_t> FrameValues;
+		uint32_t CurrentFrame = 0;
+
+		//Acquire halves of this frame's hand-offs, recorded on the graphics queue
+		//ReleaseStages are the compute side stages that wrote them, the acquire's source scope on a shared queue
+		std::vector<VkBufferMemoryBarrier> BufferAcquires;
+		VkPipelineStageFlags AcquireStages = 0;
+		VkPipelineStageFlags ReleaseStages = 0;
+
+		//Compute timeline value (and the stages that wait for it) the graphics submit of this frame must wait on, 0 without hand-offs
+		uint64_t WaitValue = 0;
+		VkPipelineStageFlags WaitStages = 0;
+
+		GpuTimer Timer;
+	};
+
+	AsyncComputeQueue CreateAsyncComputeQueue(GraphicsDevice& GFXDevice, const uint32_t FrameCount);
+
+	//Starts recording FrameIndex's compute work and its begin timestamp
+	//Waits for that frame's previous compute submission, which has normally finished long before
+	VkCommandBuffer BeginAsyncCompute(GraphicsDevice& GFXDevice, AsyncComputeQueue& Compute, const uint32_t FrameIndex);
+
+	//Hands a buffer written by this frame's compute work (at SrcStage) to the graphics queue, released here and acquired by CmdAcquireAsyncCompute
+	void CmdHandOffBufferToGraphics(AsyncComputeQueue& Compute, VkBuffer Buffer, const VkDeviceSize Offset, const VkDeviceSize Size,
+		const VkPipelineStageFlags SrcStage, const VkAccessFlags SrcAccess, const VkAccessFlags DstAccess, const VkPipelineStageFlags DstStage);
+
+	//Submits the frame's compute work, optionally after points on other timelines (e.g. the graphics queue finishing a scene to post-process)
+	void SubmitAsyncCompute(GraphicsDevice& GFXDevice, AsyncComputeQueue& Compute, const std::vector<TimelineWait>& Waits = std::vector<TimelineWait>());
+
+	//Records the acquire barriers of this frame's hand-offs into the graphics command buffer, outside a render pass
+	void CmdAcquireAsyncCompute(VkCommandBuffer GraphicsCommandBuffer, AsyncComputeQueue& Compute);
+
+	//Device must be idle
+	void DestroyAsyncComputeQueue(GraphicsDevice& GFXDevice, AsyncComputeQueue& Compute);
+}
@@ -0,0 +1,164 @@
+#include "Bindless.h"
+#include "VulkanInitializers.h"
+#include <iostream>
+
+namespace VulkanCore
+{
+	namespace
+	{
+		uint32_t AllocateSlot(BindlessSlots& Slots)
+		{
+			if (!Slots.FreeSlots.empty())
+			{
+				uint32_t Slot = Slots.FreeSlots.back();
+				Slots.FreeSlots.pop_back();
+				return Slot;
+			}
+			if (Slots.NextUnused < Slots.Capacity)
+			{
+				return Slots.NextUnused++;
+			}
+			return BindlessInvalidIndex;
+		}
+	}
+
+	BindlessTable CreateBindlessTable(GraphicsDevice& GFXDevice, DescriptorLayoutCache& LayoutCache, const BindlessConfig& Config)
+	{
+		BindlessTable RetVal;
+		RetVal.Config = Config;
+		RetVal.Slots[BindlessTextureBinding].Capacity = Config.MaxTextures;
+		RetVal.Slots[BindlessSamplerBinding].Capacity = Config.MaxSamplers;
+		RetVal.Slots[BindlessStorageBufferBinding].Capacity = Config.MaxStorageBuffers;
+
+		std::vector<VkDescriptorSetLayoutBinding> Bindings(BindlessBindingCount);
+		Bindings[BindlessTextureBinding].binding = BindlessTextureBinding;
+		Bindings[BindlessTextureBinding].descriptorType = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+		Bindings[BindlessTextureBinding].descriptorCount = Config.MaxTextures;
+		Bindings[BindlessSamplerBinding].binding = BindlessSamplerBinding;
+		Bindings[BindlessSamplerBinding].descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER;
+		Bindings[BindlessSamplerBinding].descriptorCount = Config.MaxSamplers;
+		Bindings[BindlessStorageBufferBinding].binding = BindlessStorageBufferBinding;
+		Bindings[BindlessStorageBufferBinding].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		Bindings[BindlessStorageBufferBinding].descriptorCount = Config.MaxStorageBuffers;
+		for (VkDescriptorSetLayoutBinding& Binding : Bindings)
+		{
+			Binding.stageFlags = VK_SHADER_STAGE_ALL;
+		}
+
+		//Unwritten slots are fine as long as nothing reads them, and slots can change while other slots are in use by the GPU
+		const VkDescriptorBindingFlags Flags = VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT | VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT
+			| VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT;
+		std::vector<VkDescriptorBindingFlags> BindingFlags(BindlessBindingCount, Flags);
+
+		RetVal.Layout = GetDescriptorSetLayout(GFXDevice, LayoutCache, Bindings, VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT, BindingFlags);
+
+		std::vector<VkDescriptorPoolSize> PoolSizes(BindlessBindingCount);
+		for (uint32_t i = 0; i < BindlessBindingCount; ++i)
+		{
+			PoolSizes[i].type = Bindings[i].descriptorType;
+			PoolSizes[i].descriptorCount = Bindings[i].descriptorCount;
+		}
+		RetVal.Pool = CreateDescriptorPool(GFXDevice, PoolSizes, 1, VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT);
+		RetVal.Set = AllocateDescriptorSet(GFXDevice, RetVal.Pool, RetVal.Layout);
+
+		std::cout << "Bindless table: " << Config.MaxTextures << " textures, " << Config.MaxSamplers << " samplers, "
+			<< Config.MaxStorageBuffers << " storage buffers" << std::endl;
+
+		return RetVal;
+	}
+
+	uint32_t RegisterBindlessTexture(BindlessTable& Table, VkImageView View, const VkImageLayout Layout)
+	{
+		uint32_t Slot = AllocateSlot(Table.Slots[BindlessTextureBinding]);
+		if (Slot != BindlessInvalidIndex)
+		{
+			WriteImage(Table.Writes, Table.Set, BindlessTextureBinding, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, View, Layout, VK_NULL_HANDLE, Slot);
+		}
+		else
+		{
+			std::cout << "Bindless texture array is full" << std::endl;
+		}
+		return Slot;
+	}
+
+	uint32_t RegisterBindlessSampler(BindlessTable& Table, VkSampler Sampler)
+	{
+		uint32_t Slot = AllocateSlot(Table.Slots[BindlessSamplerBinding]);
+		if (Slot != BindlessInvalidIndex)
+		{
+			WriteImage(Table.Writes, Table.Set, BindlessSamplerBinding, VK_DESCRIPTOR_TYPE_SAMPLER, VK_NULL_HANDLE, VK_IMAGE_LAYOUT_UNDEFINED, Sampler, Slot);
+		}
+		else
+		{
+			std::cout << "Bindless sampler array is full" << std::endl;
+		}
+		return Slot;
+	}
+
+	uint32_t RegisterBindlessStorageBuffer(BindlessTable& Table, VkBuffer Buffer, const VkDeviceSize Offset, const VkDeviceSize Range)
+	{
+		uint32_t Slot = AllocateSlot(Table.Slots[BindlessStorageBufferBinding]);
+		if (Slot != BindlessInvalidIndex)
+		{
+			WriteBuffer(Table.Writes, Table.Set, BindlessStorageBufferBinding, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, Buffer, Offset, Range, Slot);
+		}
+		else
+		{
+			std::cout << "Bindless storage buffer array is full" << std::endl;
+		}
+		return Slot;
+	}
+
+	void ReleaseBindlessSlot(BindlessTable& Table, const uint32_t Binding, const uint32_t Slot)
+	{
+		if (Slot == BindlessInvalidIndex)
+		{
+			return;
+		}
+
+		//The stale descriptor stays in place, partially bound means it's harmless until the slot is rewritten
+		BindlessRelease Release;
+		Release.Binding = Binding;
+		Release.Slot = Slot;
+		Release.Frame = Table.FrameNumber;
+		Table.PendingReleases.push_back(Release);
+	}
+
+	void BeginBindlessFrame(BindlessTable& Table)
+	{
+		++Table.FrameNumber;
+
+		for (size_t i = 0; i < Table.PendingReleases.size();)
+		{
+			const BindlessRelease& Release = Table.PendingReleases[i];
+			if (Release.Frame + Table.Config.FramesInFlight > Table.FrameNumber)
+			{
+				++i;
+				continue;
+			}
+
+			Table.Slots[Release.Binding].FreeSlots.push_back(Release.Slot);
+			Table.PendingReleases[i] = Table.PendingReleases.back();
+			Table.PendingReleases.pop_back();
+		}
+	}
+
+	void FlushBindlessWrites(GraphicsDevice& GFXDevice, BindlessTable& Table)
+	{
+		FlushDescriptorWrites(GFXDevice, Table.Writes);
+	}
+
+	void CmdBindBindlessTable(VkCommandBuffer CommandBuffer, const BindlessTable& Table, VkPipelineLayout PipelineLayout, const VkPipelineBindPoint BindPoint)
+	{
+		vkCmdBindDescriptorSets(CommandBuffer, BindPoint, PipelineLayout, 0, 1, &Table.Set, 0, nullptr);
+	}
+
+	void DestroyBindlessTable(GraphicsDevice& GFXDevice, BindlessTable& Table)
+	{
+		//Destroying the pool frees the set with it
+		vkDestroyDescriptorPool(GFXDevice.Device, Table.Pool, nullptr);
+		Table.Pool = VK_NULL_HANDLE;
+		Table.Set = VK_NULL_HANDLE;
+		Table.PendingReleases.clear();
+	}
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "vulkan\vulkan.h"
+#include "Descriptors.h"
+#include <vector>
+
+namespace VulkanCore
+{
+	struct GraphicsDevice;
+
+	//Bindings of the global set, each an array indexed by the slots handed out below
+	static const uint32_t BindlessTextureBinding = 0;
+	static const uint32_t BindlessSamplerBinding = 1;
+	static const uint32_t BindlessStorageBufferBinding = 2;
+	static const uint32_t BindlessBindingCount = 3;
+
+	//Returned when an array is full
+	static const uint32_t BindlessInvalidIndex = 0xFFFFFFFF;
+
+	struct BindlessConfig
+	{
+		//Array sizes, well under the 500k update-after-bind minimums the extension guarantees
+		uint32_t MaxTextures = 4096;
+		uint32_t MaxSamplers = 64;
+		uint32_t MaxStorageBuffers = 1024;
+
+		//Frames that may still read a released slot before it is handed out again
+		uint32_t FramesInFlight = 2;
+	};
+
+	//Per-draw push constants read by BindlessFragmentShader
+	//FeedbackBuffer is the storage buffer slot of this frame's texture feedback region, FeedbackSlot the texture's streamer index (see TextureStreaming.h)
+	struct BindlessDrawData
+	{
+		uint32_t TextureIndex = 0;
+		uint32_t SamplerIndex = 0;
+		uint32_t FeedbackBuffer = 0;
+		uint32_t FeedbackSlot = 0;
+	};
+
+	//Slot allocator for one array binding
+	struct BindlessSlots
+	{
+		uint32_t Capacity = 0;
+		uint32_t NextUnused = 0;
+		std::vector<uint32_t> FreeSlots;
+	};
+
+	//A released slot waiting for the frames that might read it to finish
+	struct BindlessRelease
+	{
+		uint32_t Binding = 0;
+		uint32_t Slot = 0;
+		uint64_t Frame = 0;
+	};
+
+	//One update-after-bind set holding every texture, sampler and storage buffer, bound once per frame
+	//Materials refer to resources by slot, so draws only change push constants
+	struct BindlessTable
+	{
+		BindlessConfig Config;
+
+		//Layout is owned by the layout cache it came from
+		VkDescriptorSetLayout Layout = VK_NULL_HANDLE;
+		VkDescriptorPool Pool = VK_NULL_HANDLE;
+		VkDescriptorSet Set = VK_NULL_HANDLE;
+
+		BindlessSlots Slots[BindlessBindingCount];
+		std::vector<BindlessRelease> PendingReleases;
+		DescriptorWriter Writes;
+		uint64_t FrameNumber = 0;
+	};
+
+	//Requires GFXDevice.bSupportsDescriptorIndexing
+	BindlessTable CreateBindlessTable(GraphicsDevice& GFXDevice, DescriptorLayoutCache& LayoutCache, const BindlessConfig& Config);
+
+	//Each returns the slot to index its array with, or BindlessInvalidIndex when full
+	//The write is queued and lands on the next FlushBindlessWrites
+	uint32_t RegisterBindlessTexture(BindlessTable& Table, VkImageView View, const VkImageLayout Layout);
+	uint32_t RegisterBindlessSampler(BindlessTable& Table, VkSampler Sampler);
+	uint32_t RegisterBindlessStorageBuffer(BindlessTable& Table, VkBuffer Buffer, const VkDeviceSize Offset, const VkDeviceSize Range);
+
+	//Returns Slot of Binding to the free list once FramesInFlight frames have passed
+	void ReleaseBindlessSlot(BindlessTable& Table, const uint32_t Binding, const uint32_t Slot);
+
+	//Call once per frame after the frame timeline wait, recycles slots no frame in flight can still read
+	void BeginBindlessFrame(BindlessTable& Table);
+
+	//Applies queued writes, must happen before submitting work that reads the new slots
+	//Update-after-bind makes this legal while the set is bound in pending command buffers
+	void FlushBindlessWrites(GraphicsDevice& GFXDevice, BindlessTable& Table);
+
+	//Binds the table as set 0 of PipelineLayout
+	void CmdBindBindlessTable(VkCommandBuffer CommandBuffer, const BindlessTable& Table, VkPipelineLayout PipelineLayout, const VkPipelineBindPoint BindPoint);
+
+	//Device must be idle
+	void DestroyBindlessTable(GraphicsDevice& GFXDevice, BindlessTable& Table);
+}
@@ -0,0 +1,73 @@
+#include "DeletionQueue.h"
+#include "VulkanInitializers.h"
+#include "Sync.h"
+
+namespace VulkanCore
+{
+	DeletionQueue CreateDeletionQueue(QueueTimeline& Timeline)
+	{
+		DeletionQueue RetVal;
+		RetVal.Timeline = &Timeline;
+		return RetVal;
+	}
+
+	void DeferDeletion(DeletionQueue& Queue, std::function<void(GraphicsDevice&)> Destroy)
+	{
+		DeletionQueue::Entry Entry;
+		Entry.Value = Queue.Timeline->LastSubmitted + 1;
+		Entry.Destroy = std::move(Destroy);
+		Queue.Entries.push_back(std::move(Entry));
+	}
+
+	void DeferDestroyBuffer(DeletionQueue& Queue, VkBuffer Buffer, VkDeviceMemory Memory)
+	{
+		DeferDeletion(Queue, [Buffer, Memory](GraphicsDevice& GFXDevice)
+		{
+			vkDestroyBuffer(GFXDevice.Device, Buffer, nullptr);
+			vkFreeMemory(GFXDevice.Device, Memory, nullptr);
+		});
+	}
+
+	void DeferDestroyPipeline(DeletionQueue& Queue, const PipelineData& Pipeline)
+	{
+		const PipelineData Released = Pipeline;
+		DeferDeletion(Queue, [Released](GraphicsDevice& GFXDevice)
+		{
+			vkDestroyPipeline(GFXDevice.Device, Released.Pipeline, nullptr);
+		});
+	}
+
+	void DeferDestroyFramebuffer(DeletionQueue& Queue, VkFramebuffer Framebuffer)
+	{
+		DeferDeletion(Queue, [Framebuffer](GraphicsDevice& GFXDevice)
+		{
+			vkDestroyFramebuffer(GFXDevice.Device, Framebuffer, nullptr);
+		});
+	}
+
+	void FlushDeletionQueue(GraphicsDevice& GFXDevice, DeletionQueue& Queue)
+	{
+		if (Queue.Entries.empty())
+		{
+			return;
+		}
+
+		const uint64_t Completed = GetCompletedTimelineValue(GFXDevice, *Queue.Timeline);
+		while (!Queue.Entries.empty() && Queue.Entries.front().Value <= Completed)
+		{
+			Queue.Entries.front().Destroy(GFXDevice);
+			Queue.Entries.pop_front();
+			++Queue.DestroyedCount;
+		}
+	}
+
+	void DestroyDeletionQueue(GraphicsDevice& GFXDevice, DeletionQueue& Queue)
+	{
+		for (DeletionQueue::Entry& Entry : Queue.Entries)
+		{
+			Entry.Destroy(GFXDevice);
+			++Queue.DestroyedCount;
+		}
+		Queue = DeletionQueue();
+	}
+}
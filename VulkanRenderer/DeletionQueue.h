@@ -0,0 +1,47 @@
+#pragma once
+
+#include "vulkan\vulkan.h"
+#include <deque>
+#include <functional>
+
+namespace VulkanCore
+{
+	struct GraphicsDevice;
+	struct QueueTimeline;
+	struct PipelineData;
+
+	//Resources released while frames are in flight, each destroyed once its queue's timeline passes the value it was tagged with
+	//A release is tagged with the value of the next submission on the timeline, the last one that can still reference it
+	//Lets assets be unloaded at runtime without vkDeviceWaitIdle
+	struct DeletionQueue
+	{
+		struct Entry
+		{
+			uint64_t Value = 0;
+			std::function<void(GraphicsDevice&)> Destroy;
+		};
+
+		//Timeline values only grow, so entries are in completion order
+		QueueTimeline* Timeline = nullptr;
+		std::deque<Entry> Entries;
+
+		uint64_t DestroyedCount = 0;
+	};
+
+	//Releases are tracked against Timeline, which must outlive the queue
+	DeletionQueue CreateDeletionQueue(QueueTimeline& Timeline);
+
+	//Runs Destroy once everything submitted so far and the next submission have completed
+	void DeferDeletion(DeletionQueue& Queue, std::function<void(GraphicsDevice&)> Destroy);
+
+	//Handles may be VK_NULL_HANDLE
+	void DeferDestroyBuffer(DeletionQueue& Queue, VkBuffer Buffer, VkDeviceMemory Memory);
+	void DeferDestroyPipeline(DeletionQueue& Queue, const PipelineData& Pipeline);
+	void DeferDestroyFramebuffer(DeletionQueue& Queue, VkFramebuffer Framebuffer);
+
+	//Call once per frame, never blocks: destroys every release whose timeline value has completed
+	void FlushDeletionQueue(GraphicsDevice& GFXDevice, DeletionQueue& Queue);
+
+	//Device must be idle, destroys everything still queued
+	void DestroyDeletionQueue(GraphicsDevice& GFXDevice, DeletionQueue& Queue);
+}
@@ -0,0 +1,309 @@
+#include "Descriptors.h"
+#include "VulkanInitializers.h"
+#include <iostream>
+#include <algorithm>
+#include <functional>
+
+namespace VulkanCore
+{
+	bool DescriptorLayoutKey::operator==(const DescriptorLayoutKey& Other) const
+	{
+		if (Flags != Other.Flags || Bindings.size() != Other.Bindings.size() || BindingFlags != Other.BindingFlags)
+		{
+			return false;
+		}
+
+		for (size_t i = 0; i < Bindings.size(); ++i)
+		{
+			const VkDescriptorSetLayoutBinding& A = Bindings[i];
+			const VkDescriptorSetLayoutBinding& B = Other.Bindings[i];
+			if (A.binding != B.binding || A.descriptorType != B.descriptorType || A.descriptorCount != B.descriptorCount || A.stageFlags != B.stageFlags)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	size_t DescriptorLayoutKeyHash::operator()(const DescriptorLayoutKey& Key) const
+	{
+		size_t Hash = std::hash<uint32_t>()(Key.Flags);
+		auto Combine = [&Hash](size_t Value) { Hash ^= Value + 0x9e3779b9 + (Hash << 6) + (Hash >> 2); };
+
+		for (const VkDescriptorSetLayoutBinding& Binding : Key.Bindings)
+		{
+			//Binding index, type and stages pack into one word, count gets its own
+			Combine(std::hash<uint32_t>()(Binding.binding | (Binding.descriptorType << 8) | (Binding.stageFlags << 16)));
+			Combine(std::hash<uint32_t>()(Binding.descriptorCount));
+		}
+		for (const VkDescriptorBindingFlags BindingFlags : Key.BindingFlags)
+		{
+			Combine(std::hash<uint32_t>()(BindingFlags));
+		}
+		return Hash;
+	}
+
+	bool PipelineLayoutKey::operator==(const PipelineLayoutKey& Other) const
+	{
+		if (SetLayouts != Other.SetLayouts || PushConstantRanges.size() != Other.PushConstantRanges.size())
+		{
+			return false;
+		}
+
+		for (size_t i = 0; i < PushConstantRanges.size(); ++i)
+		{
+			const VkPushConstantRange& A = PushConstantRanges[i];
+			const VkPushConstantRange& B = Other.PushConstantRanges[i];
+			if (A.stageFlags != B.stageFlags || A.offset != B.offset || A.size != B.size)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	size_t PipelineLayoutKeyHash::operator()(const PipelineLayoutKey& Key) const
+	{
+		size_t Hash = std::hash<size_t>()(Key.SetLayouts.size());
+		auto Combine = [&Hash](size_t Value) { Hash ^= Value + 0x9e3779b9 + (Hash << 6) + (Hash >> 2); };
+
+		for (VkDescriptorSetLayout SetLayout : Key.SetLayouts)
+		{
+			Combine(std::hash<const void*>()(SetLayout));
+		}
+		for (const VkPushConstantRange& Range : Key.PushConstantRanges)
+		{
+			Combine(std::hash<uint32_t>()(Range.stageFlags));
+			Combine(std::hash<uint32_t>()(Range.offset | (Range.size << 16)));
+		}
+		return Hash;
+	}
+
+	VkDescriptorSetLayout GetDescriptorSetLayout(GraphicsDevice& GFXDevice, DescriptorLayoutCache& Cache, const std::vector<VkDescriptorSetLayoutBinding>& Bindings,
+		const VkDescriptorSetLayoutCreateFlags Flags, const std::vector<VkDescriptorBindingFlags>& BindingFlags)
+	{
+		//Sort an index list so the binding flags follow their bindings
+		std::vector<size_t> Order(Bindings.size());
+		for (size_t i = 0; i < Order.size(); ++i)
+		{
+			Order[i] = i;
+		}
+		std::sort(Order.begin(), Order.end(), [&Bindings](const size_t A, const size_t B)
+		{
+			return Bindings[A].binding < Bindings[B].binding;
+		});
+
+		DescriptorLayoutKey Key;
+		Key.Flags = Flags;
+		for (const size_t Index : Order)
+		{
+			Key.Bindings.push_back(Bindings[Index]);
+			if (!BindingFlags.empty())
+			{
+				Key.BindingFlags.push_back(BindingFlags[Index]);
+			}
+		}
+
+		auto Found = Cache.Layouts.find(Key);
+		if (Found != Cache.Layouts.end())
+		{
+			return Found->second;
+		}
+
+		VkDescriptorSetLayout Layout = CreateDescriptorSetLayout(GFXDevice, Key.Bindings, Flags, Key.BindingFlags);
+		if (Layout != VK_NULL_HANDLE)
+		{
+			Cache.Layouts[Key] = Layout;
+		}
+		return Layout;
+	}
+
+	VkPipelineLayout GetPipelineLayout(GraphicsDevice& GFXDevice, DescriptorLayoutCache& Cache, const PipelineLayoutDesc& LayoutDesc)
+	{
+		PipelineLayoutKey Key;
+		Key.SetLayouts = LayoutDesc.SetLayouts;
+		Key.PushConstantRanges = LayoutDesc.PushConstantRanges;
+
+		auto Found = Cache.PipelineLayouts.find(Key);
+		if (Found != Cache.PipelineLayouts.end())
+		{
+			return Found->second;
+		}
+
+		VkPipelineLayout Layout = CreatePipelineLayout(GFXDevice, LayoutDesc);
+		if (Layout != VK_NULL_HANDLE)
+		{
+			Cache.PipelineLayouts[Key] = Layout;
+		}
+		return Layout;
+	}
+
+	void DestroyDescriptorLayoutCache(GraphicsDevice& GFXDevice, DescriptorLayoutCache& Cache)
+	{
+		//Pipeline layouts reference the set layouts, so they go first
+		for (auto& Entry : Cache.PipelineLayouts)
+		{
+			vkDestroyPipelineLayout(GFXDevice.Device, Entry.second, nullptr);
+		}
+		Cache.PipelineLayouts.clear();
+
+		for (auto& Entry : Cache.Layouts)
+		{
+			vkDestroyDescriptorSetLayout(GFXDevice.Device, Entry.second, nullptr);
+		}
+		Cache.Layouts.clear();
+	}
+
+	DescriptorAllocator CreateDescriptorAllocator(GraphicsDevice& GFXDevice, const uint32_t FrameCount, const uint32_t SetsPerPool)
+	{
+		DescriptorAllocator RetVal;
+		RetVal.Frames.resize(FrameCount);
+		RetVal.SetsPerPool = SetsPerPool;
+
+		//Rough mix of what a set needs on average, pools are cheap to add when one type runs out first
+		RetVal.PoolRatios = {
+			{ VK_DESCRIPTOR_TYPE_SAMPLER, 2 },
+			{ VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 4 },
+			{ VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, 4 },
+			{ VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1 },
+			{ VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 2 },
+			{ VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 1 },
+			{ VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 2 }
+		};
+
+		return RetVal;
+	}
+
+	void BeginDescriptorFrame(GraphicsDevice& GFXDevice, DescriptorAllocator& Allocator, const uint32_t FrameIndex)
+	{
+		Allocator.CurrentFrame = FrameIndex;
+		DescriptorPoolChain& Chain = Allocator.Frames[FrameIndex];
+
+		//Resetting a pool frees every set in it at once, far cheaper than freeing sets one by one
+		for (VkDescriptorPool Pool : Chain.UsedPools)
+		{
+			vkResetDescriptorPool(GFXDevice.Device, Pool, 0);
+			Chain.FreePools.push_back(Pool);
+		}
+		Chain.UsedPools.clear();
+		Chain.SetsAllocated = 0;
+	}
+
+	VkDescriptorSet AllocateFrameDescriptorSet(GraphicsDevice& GFXDevice, DescriptorAllocator& Allocator, VkDescriptorSetLayout Layout)
+	{
+		DescriptorPoolChain& Chain = Allocator.Frames[Allocator.CurrentFrame];
+
+		VkDescriptorSetAllocateInfo AllocateInfo = {};
+		AllocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+		AllocateInfo.descriptorSetCount = 1;
+		AllocateInfo.pSetLayouts = &Layout;
+
+		VkDescriptorSet Set = VK_NULL_HANDLE;
+
+		//Try the newest pool first, then grow the chain once if it's exhausted
+		for (int Attempt = 0; Attempt < 2; ++Attempt)
+		{
+			if (Attempt > 0 || Chain.UsedPools.empty())
+			{
+				if (!Chain.FreePools.empty())
+				{
+					Chain.UsedPools.push_back(Chain.FreePools.back());
+					Chain.FreePools.pop_back();
+				}
+				else
+				{
+					std::vector<VkDescriptorPoolSize> PoolSizes = Allocator.PoolRatios;
+					for (VkDescriptorPoolSize& PoolSize : PoolSizes)
+					{
+						PoolSize.descriptorCount *= Allocator.SetsPerPool;
+					}
+					Chain.UsedPools.push_back(CreateDescriptorPool(GFXDevice, PoolSizes, Allocator.SetsPerPool));
+				}
+			}
+
+			AllocateInfo.descriptorPool = Chain.UsedPools.back();
+			VkResult R = vkAllocateDescriptorSets(GFXDevice.Device, &AllocateInfo, &Set);
+			if (R == VK_SUCCESS)
+			{
+				++Chain.SetsAllocated;
+				return Set;
+			}
+			if (R != VK_ERROR_OUT_OF_POOL_MEMORY && R != VK_ERROR_FRAGMENTED_POOL)
+			{
+				std::cout << "Descriptor set allocation failed with error: " << R << std::endl;
+				return VK_NULL_HANDLE;
+			}
+		}
+
+		std::cout << "Descriptor set allocation failed: layout doesn't fit in an empty pool" << std::endl;
+		return VK_NULL_HANDLE;
+	}
+
+	void DestroyDescriptorAllocator(GraphicsDevice& GFXDevice, DescriptorAllocator& Allocator)
+	{
+		for (DescriptorPoolChain& Chain : Allocator.Frames)
+		{
+			for (VkDescriptorPool Pool : Chain.UsedPools)
+			{
+				vkDestroyDescriptorPool(GFXDevice.Device, Pool, nullptr);
+			}
+			for (VkDescriptorPool Pool : Chain.FreePools)
+			{
+				vkDestroyDescriptorPool(GFXDevice.Device, Pool, nullptr);
+			}
+		}
+		Allocator.Frames.clear();
+	}
+
+	void WriteImage(DescriptorWriter& Writer, VkDescriptorSet Set, const uint32_t Binding, const VkDescriptorType Type,
+		VkImageView View, const VkImageLayout Layout, VkSampler Sampler, const uint32_t ArrayElement)
+	{
+		VkDescriptorImageInfo ImageInfo = {};
+		ImageInfo.imageView = View;
+		ImageInfo.imageLayout = Layout;
+		ImageInfo.sampler = Sampler;
+		Writer.ImageInfos.push_back(ImageInfo);
+
+		VkWriteDescriptorSet Write = {};
+		Write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+		Write.dstSet = Set;
+		Write.dstBinding = Binding;
+		Write.dstArrayElement = ArrayElement;
+		Write.descriptorCount = 1;
+		Write.descriptorType = Type;
+		Write.pImageInfo = &Writer.ImageInfos.back();
+		Writer.Writes.push_back(Write);
+	}
+
+	void WriteBuffer(DescriptorWriter& Writer, VkDescriptorSet Set, const uint32_t Binding, const VkDescriptorType Type,
+		VkBuffer Buffer, const VkDeviceSize Offset, const VkDeviceSize Range, const uint32_t ArrayElement)
+	{
+		VkDescriptorBufferInfo BufferInfo = {};
+		BufferInfo.buffer = Buffer;
+		BufferInfo.offset = Offset;
+		BufferInfo.range = Range;
+		Writer.BufferInfos.push_back(BufferInfo);
+
+		VkWriteDescriptorSet Write = {};
+		Write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+		Write.dstSet = Set;
+		Write.dstBinding = Binding;
+		Write.dstArrayElement = ArrayElement;
+		Write.descriptorCount = 1;
+		Write.descriptorType = Type;
+		Write.pBufferInfo = &Writer.BufferInfos.back();
+		Writer.Writes.push_back(Write);
+	}
+
+	void FlushDescriptorWrites(GraphicsDevice& GFXDevice, DescriptorWriter& Writer)
+	{
+		if (!Writer.Writes.empty())
+		{
+			vkUpdateDescriptorSets(GFXDevice.Device, static_cast<uint32_t> (Writer.Writes.size()), Writer.Writes.data(), 0, nullptr);
+		}
+
+		Writer.Writes.clear();
+		Writer.ImageInfos.clear();
+		Writer.BufferInfos.clear();
+	}
+}
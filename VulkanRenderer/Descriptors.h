@@ -0,0 +1,113 @@
+#pragma once
+
+#include "vulkan\vulkan.h"
+#include <vector>
+#include <deque>
+#include <unordered_map>
+
+namespace VulkanCore
+{
+	struct GraphicsDevice;
+	struct PipelineLayoutDesc;
+
+	//Bindings sorted by binding index plus create and per-binding flags, identifies a set layout
+	struct DescriptorLayoutKey
+	{
+		VkDescriptorSetLayoutCreateFlags Flags = 0;
+		std::vector<VkDescriptorSetLayoutBinding> Bindings;
+
+		//Empty, or one entry per binding in the same order
+		std::vector<VkDescriptorBindingFlags> BindingFlags;
+
+		bool operator==(const DescriptorLayoutKey& Other) const;
+	};
+
+	struct DescriptorLayoutKeyHash
+	{
+		size_t operator()(const DescriptorLayoutKey& Key) const;
+	};
+
+	//Set layouts by set index plus push constant ranges in declaration order, identifies a pipeline layout
+	struct PipelineLayoutKey
+	{
+		std::vector<VkDescriptorSetLayout> SetLayouts;
+		std::vector<VkPushConstantRange> PushConstantRanges;
+
+		bool operator==(const PipelineLayoutKey& Other) const;
+	};
+
+	struct PipelineLayoutKeyHash
+	{
+		size_t operator()(const PipelineLayoutKey& Key) const;
+	};
+
+	//Shares one VkDescriptorSetLayout between every user of the same bindings, and one VkPipelineLayout between every pipeline built from the same sets and ranges
+	struct DescriptorLayoutCache
+	{
+		std::unordered_map<DescriptorLayoutKey, VkDescriptorSetLayout, DescriptorLayoutKeyHash> Layouts;
+		std::unordered_map<PipelineLayoutKey, VkPipelineLayout, PipelineLayoutKeyHash> PipelineLayouts;
+	};
+
+	//Returns the cached layout for Bindings (order doesn't matter), creating it on first use
+	//Immutable samplers aren't part of the key, so bindings using them shouldn't go through the cache
+	//BindingFlags, if given, must line up with Bindings and is reordered along with them
+	VkDescriptorSetLayout GetDescriptorSetLayout(GraphicsDevice& GFXDevice, DescriptorLayoutCache& Cache, const std::vector<VkDescriptorSetLayoutBinding>& Bindings,
+		const VkDescriptorSetLayoutCreateFlags Flags = 0, const std::vector<VkDescriptorBindingFlags>& BindingFlags = std::vector<VkDescriptorBindingFlags>());
+
+	//Returns the cached pipeline layout for LayoutDesc, creating it on first use
+	//The cache owns it, pipelines created with it must be destroyed before DestroyDescriptorLayoutCache
+	VkPipelineLayout GetPipelineLayout(GraphicsDevice& GFXDevice, DescriptorLayoutCache& Cache, const PipelineLayoutDesc& LayoutDesc);
+
+	void DestroyDescriptorLayoutCache(GraphicsDevice& GFXDevice, DescriptorLayoutCache& Cache);
+
+	//Pools owned by one frame, all reset together once that frame's timeline value has completed
+	struct DescriptorPoolChain
+	{
+		std::vector<VkDescriptorPool> UsedPools;
+		std::vector<VkDescriptorPool> FreePools;
+		uint32_t SetsAllocated = 0;
+	};
+
+	//Hands out transient descriptor sets from per-frame pool chains that grow on demand
+	struct DescriptorAllocator
+	{
+		std::vector<DescriptorPoolChain> Frames;
+		uint32_t CurrentFrame = 0;
+
+		//Descriptors of each type per set, scaled by SetsPerPool when a pool is created
+		std::vector<VkDescriptorPoolSize> PoolRatios;
+		uint32_t SetsPerPool = 0;
+	};
+
+	DescriptorAllocator CreateDescriptorAllocator(GraphicsDevice& GFXDevice, const uint32_t FrameCount, const uint32_t SetsPerPool = 256);
+
+	//Makes FrameIndex current and resets its pools wholesale, the frame's timeline value must have completed
+	void BeginDescriptorFrame(GraphicsDevice& GFXDevice, DescriptorAllocator& Allocator, const uint32_t FrameIndex);
+
+	//Allocates a set valid until the current frame comes around again, growing the chain when a pool runs out
+	VkDescriptorSet AllocateFrameDescriptorSet(GraphicsDevice& GFXDevice, DescriptorAllocator& Allocator, VkDescriptorSetLayout Layout);
+
+	void DestroyDescriptorAllocator(GraphicsDevice& GFXDevice, DescriptorAllocator& Allocator);
+
+	//Collects descriptor writes so a whole frame's worth goes through one vkUpdateDescriptorSets
+	struct DescriptorWriter
+	{
+		std::vector<VkWriteDescriptorSet> Writes;
+
+		//Deques so pointers held by Writes stay valid as more are added
+		std::deque<VkDescriptorImageInfo> ImageInfos;
+		std::deque<VkDescriptorBufferInfo> BufferInfos;
+	};
+
+	//Queues an image and/or sampler write (SAMPLED_IMAGE, SAMPLER, COMBINED_IMAGE_SAMPLER, STORAGE_IMAGE)
+	//ArrayElement selects the slot within an arrayed binding
+	void WriteImage(DescriptorWriter& Writer, VkDescriptorSet Set, const uint32_t Binding, const VkDescriptorType Type,
+		VkImageView View, const VkImageLayout Layout, VkSampler Sampler, const uint32_t ArrayElement = 0);
+
+	//Queues a buffer write (UNIFORM / STORAGE, dynamic or not)
+	void WriteBuffer(DescriptorWriter& Writer, VkDescriptorSet Set, const uint32_t Binding, const VkDescriptorType Type,
+		VkBuffer Buffer, const VkDeviceSize Offset, const VkDeviceSize Range, const uint32_t ArrayElement = 0);
+
+	//Submits every queued write in a single call and clears the writer for reuse
+	void FlushDescriptorWrites(GraphicsDevice& GFXDevice, DescriptorWriter& Writer);
+}
@@ -0,0 +1,195 @@
+#include "DrawQueue.h"
+#include <algorithm>
+#include <cstring>
+
+namespace VulkanCore
+{
+	uint64_t MakeDrawKey(const uint32_t Pass, const uint32_t PipelineId, const uint32_t MaterialId, const uint32_t MeshId, const float Depth,
+		const bool bBackToFront)
+	{
+		const uint32_t DepthMax = (1u << DrawKeyDepthBits) - 1;
+		uint32_t QuantizedDepth = static_cast<uint32_t> (std::min(std::max(Depth, 0.0f), 1.0f) * DepthMax);
+		if (bBackToFront)
+		{
+			QuantizedDepth = DepthMax - QuantizedDepth;
+		}
+
+		uint64_t Key = Pass & ((1u << DrawKeyPassBits) - 1);
+		Key = (Key << DrawKeyPipelineBits) | (PipelineId & ((1u << DrawKeyPipelineBits) - 1));
+		Key = (Key << DrawKeyMaterialBits) | (MaterialId & ((1u << DrawKeyMaterialBits) - 1));
+		Key = (Key << DrawKeyMeshBits) | (MeshId & ((1u << DrawKeyMeshBits) - 1));
+		Key = (Key << DrawKeyDepthBits) | QuantizedDepth;
+		return Key;
+	}
+
+	void ResetDrawQueue(DrawQueue& Queue, const uint32_t DrawDataSize)
+	{
+		Queue.Items.clear();
+		Queue.SortKeys.clear();
+		Queue.SortIndices.clear();
+		Queue.DrawData.clear();
+		Queue.DrawDataSize = DrawDataSize;
+	}
+
+	void AddDraw(DrawQueue& Queue, const DrawItem& Item, const void* Data)
+	{
+		const uint32_t Index = static_cast<uint32_t> (Queue.Items.size());
+		Queue.Items.push_back(Item);
+		Queue.SortKeys.push_back(Item.Key);
+		Queue.SortIndices.push_back(Index);
+
+		const size_t Offset = Queue.DrawData.size();
+		Queue.Items.back().DrawDataOffset = static_cast<uint32_t> (Offset);
+		if (Queue.DrawDataSize > 0)
+		{
+			Queue.DrawData.resize(Offset + Queue.DrawDataSize);
+			memcpy(Queue.DrawData.data() + Offset, Data, Queue.DrawDataSize);
+		}
+	}
+
+	void SortDrawQueue(DrawQueue& Queue)
+	{
+		const uint32_t Count = static_cast<uint32_t> (Queue.SortKeys.size());
+		if (Count < 2)
+		{
+			return;
+		}
+		Queue.ScratchKeys.resize(Count);
+		Queue.ScratchIndices.resize(Count);
+
+		//Histograms of all 8 bytes in a single read of the keys
+		uint32_t Histograms[8][256] = {};
+		for (uint64_t Key : Queue.SortKeys)
+		{
+			for (int Byte = 0; Byte < 8; ++Byte)
+			{
+				++Histograms[Byte][(Key >> (Byte * 8)) & 0xFF];
+			}
+		}
+
+		uint64_t* Keys = Queue.SortKeys.data();
+		uint32_t* Indices = Queue.SortIndices.data();
+		uint64_t* OutKeys = Queue.ScratchKeys.data();
+		uint32_t* OutIndices = Queue.ScratchIndices.data();
+		for (int Byte = 0; Byte < 8; ++Byte)
+		{
+			//Unused high bits (small ids, one pass) are common, those bytes don't reorder anything
+			uint32_t* Histogram = Histograms[Byte];
+			const uint64_t FirstValue = (Keys[0] >> (Byte * 8)) & 0xFF;
+			if (Histogram[FirstValue] == Count)
+			{
+				continue;
+			}
+
+			uint32_t Offset = 0;
+			for (int Bucket = 0; Bucket < 256; ++Bucket)
+			{
+				const uint32_t BucketCount = Histogram[Bucket];
+				Histogram[Bucket] = Offset;
+				Offset += BucketCount;
+			}
+
+			for (uint32_t i = 0; i < Count; ++i)
+			{
+				const uint32_t Destination = Histogram[(Keys[i] >> (Byte * 8)) & 0xFF]++;
+				OutKeys[Destination] = Keys[i];
+				OutIndices[Destination] = Indices[i];
+			}
+			std::swap(Keys, OutKeys);
+			std::swap(Indices, OutIndices);
+		}
+
+		//An odd number of passes leaves the result in the scratch arrays
+		if (Keys != Queue.SortKeys.data())
+		{
+			Queue.SortKeys.swap(Queue.ScratchKeys);
+			Queue.SortIndices.swap(Queue.ScratchIndices);
+		}
+	}
+
+	void CmdSubmitDrawQueue(GraphicsDevice& GFXDevice, VkCommandBuffer CommandBuffer, DrawQueue& Queue, const DrawDataPath& Path, UniformAllocator& Allocator)
+	{
+		DrawQueueStats Stats;
+		VkPipeline BoundPipeline = VK_NULL_HANDLE;
+		VkPipelineLayout BoundLayout = VK_NULL_HANDLE;
+		VkDescriptorSet BoundSet = VK_NULL_HANDLE;
+		VkBuffer BoundVertexBuffer = VK_NULL_HANDLE;
+		VkBuffer BoundIndexBuffer = VK_NULL_HANDLE;
+
+		for (uint32_t Index : Queue.SortIndices)
+		{
+			const DrawItem& Item = Queue.Items[Index];
+
+			if (Item.Pipeline != BoundPipeline)
+			{
+				vkCmdBindPipeline(CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, Item.Pipeline);
+				BoundPipeline = Item.Pipeline;
+				++Stats.PipelineBinds;
+			}
+			else
+			{
+				++Stats.SkippedBinds;
+			}
+
+			//Sets bound with another layout may be disturbed, don't rely on them across a layout change
+			if (Item.Layout != BoundLayout)
+			{
+				BoundLayout = Item.Layout;
+				BoundSet = VK_NULL_HANDLE;
+			}
+			if (Item.MaterialSet != VK_NULL_HANDLE)
+			{
+				if (Item.MaterialSet != BoundSet)
+				{
+					vkCmdBindDescriptorSets(CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, Item.Layout, 0, 1, &Item.MaterialSet, 0, nullptr);
+					BoundSet = Item.MaterialSet;
+					++Stats.DescriptorBinds;
+				}
+				else
+				{
+					++Stats.SkippedBinds;
+				}
+			}
+
+			if (Item.VertexBuffer != BoundVertexBuffer)
+			{
+				VkDeviceSize Offsets[] = { 0 };
+				vkCmdBindVertexBuffers(CommandBuffer, 0, 1, &Item.VertexBuffer, Offsets);
+				BoundVertexBuffer = Item.VertexBuffer;
+				++Stats.VertexBufferBinds;
+			}
+			else
+			{
+				++Stats.SkippedBinds;
+			}
+
+			if (Item.IndexBuffer != BoundIndexBuffer)
+			{
+				vkCmdBindIndexBuffer(CommandBuffer, Item.IndexBuffer, 0, VK_INDEX_TYPE_UINT32);
+				BoundIndexBuffer = Item.IndexBuffer;
+				++Stats.IndexBufferBinds;
+			}
+			else
+			{
+				++Stats.SkippedBinds;
+			}
+
+			if (Queue.DrawDataSize > 0)
+			{
+				CmdWriteDrawData(CommandBuffer, Item.Layout, Path, Allocator, Queue.DrawData.data() + Item.DrawDataOffset);
+			}
+
+			if (Item.IndirectBuffer != VK_NULL_HANDLE)
+			{
+				CmdDrawIndirect(GFXDevice, CommandBuffer, Item.IndirectBuffer, Item.DrawCount);
+			}
+			else
+			{
+				vkCmdDrawIndexed(CommandBuffer, Item.IndexCount, 1, Item.FirstIndex, Item.VertexOffset, 0);
+			}
+			++Stats.Draws;
+		}
+
+		Queue.Stats = Stats;
+	}
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "vulkan\vulkan.h"
+#include "Meshlets.h"
+#include "UniformAllocator.h"
+#include <vector>
+
+namespace VulkanCore
+{
+	struct GraphicsDevice;
+
+	//Sort key layout, most significant first: pass | pipeline | material | mesh | depth
+	//Sorting by key groups draws by the state that is most expensive to change, depth orders draws within the same state
+	static const uint32_t DrawKeyPassBits = 4;
+	static const uint32_t DrawKeyPipelineBits = 12;
+	static const uint32_t DrawKeyMaterialBits = 16;
+	static const uint32_t DrawKeyMeshBits = 12;
+	static const uint32_t DrawKeyDepthBits = 20;
+
+	//Ids are truncated to their field's width, Depth is view depth normalized to 0..1 (clamped)
+	//bBackToFront flips the depth field for blended passes
+	uint64_t MakeDrawKey(const uint32_t Pass, const uint32_t PipelineId, const uint32_t MaterialId, const uint32_t MeshId, const float Depth,
+		const bool bBackToFront = false);
+
+	//Everything a draw binds, the recorder only rebinds what differs from the previous draw in key order
+	struct DrawItem
+	{
+		uint64_t Key = 0;
+
+		VkPipeline Pipeline = VK_NULL_HANDLE;
+		VkPipelineLayout Layout = VK_NULL_HANDLE;
+
+		//Bound at set 0 when not VK_NULL_HANDLE (bindless draws leave it empty, their table is bound once by the pass)
+		VkDescriptorSet MaterialSet = VK_NULL_HANDLE;
+
+		VkBuffer VertexBuffer = VK_NULL_HANDLE;
+		VkBuffer IndexBuffer = VK_NULL_HANDLE;
+
+		//Indirect draws from an IndirectDrawBuffer's VkBuffer when set, a single indexed draw otherwise
+		VkBuffer IndirectBuffer = VK_NULL_HANDLE;
+		uint32_t DrawCount = 0;
+		uint32_t FirstIndex = 0;
+		uint32_t IndexCount = 0;
+		int32_t VertexOffset = 0;
+
+		//Offset of this draw's block in DrawQueue::DrawData, written with CmdWriteDrawData
+		uint32_t DrawDataOffset = 0;
+	};
+
+	//State changes of the last submitted queue
+	struct DrawQueueStats
+	{
+		uint32_t Draws = 0;
+		uint32_t PipelineBinds = 0;
+		uint32_t DescriptorBinds = 0;
+		uint32_t VertexBufferBinds = 0;
+		uint32_t IndexBufferBinds = 0;
+
+		//Binds skipped because the previous draw had already bound the same object
+		uint32_t SkippedBinds = 0;
+	};
+
+	//Draws are queued in any order during the frame, sorted by key, then recorded with redundant binds removed
+	struct DrawQueue
+	{
+		std::vector<DrawItem> Items;
+
+		//Key and item index pairs, sorted in place each frame (Scratch is the radix sort's ping-pong buffer)
+		std::vector<uint64_t> SortKeys;
+		std::vector<uint32_t> SortIndices;
+		std::vector<uint64_t> ScratchKeys;
+		std::vector<uint32_t> ScratchIndices;
+
+		//Per-draw data blocks, all DrawDataSize bytes
+		std::vector<uint8_t> DrawData;
+		uint32_t DrawDataSize = 0;
+
+		DrawQueueStats Stats;
+	};
+
+	//Empties the queue for a new frame, DrawDataSize is the size of every draw's data block (DrawDataPath::Size)
+	void ResetDrawQueue(DrawQueue& Queue, const uint32_t DrawDataSize);
+
+	//Copies Item and its DrawDataSize bytes of Data into the queue
+	void AddDraw(DrawQueue& Queue, const DrawItem& Item, const void* Data);
+
+	//LSD radix sort of the keys, 8 bits per pass, passes where every key has the same byte are skipped
+	void SortDrawQueue(DrawQueue& Queue);
+
+	//Records every draw in sorted order, binding pipelines, sets and buffers only when they change
+	void CmdSubmitDrawQueue(GraphicsDevice& GFXDevice, VkCommandBuffer CommandBuffer, DrawQueue& Queue, const DrawDataPath& Path, UniformAllocator& Allocator);
+}
@@ -0,0 +1,167 @@
+#include "GeometryBuffer.h"
+#include "VulkanInitializers.h"
+#include "ResourceRegistry.h"
+#include <iostream>
+#include <cstring>
+#include <algorithm>
+
+namespace VulkanCore
+{
+	namespace
+	{
+		BufferHandle CreateArena(GraphicsDevice& GFXDevice, ResourceRegistry& Registry, std::vector<MemoryTypeInfo>& MemoryHeaps, const VkDeviceSize Size,
+			const VkBufferUsageFlagBits Usage, void** OutMapping)
+		{
+			VkBuffer Buffer = AllocateBuffer(GFXDevice.Device, static_cast<int> (Size), Usage);
+
+			VkMemoryRequirements MemoryRequirements = {};
+			vkGetBufferMemoryRequirements(GFXDevice.Device, Buffer, &MemoryRequirements);
+			VkDeviceMemory Memory = AllocateMemory(GFXDevice.Device, MemoryHeaps, MemoryRequirements, false);
+
+			VkResult R = vkBindBufferMemory(GFXDevice.Device, Buffer, Memory, 0);
+			if (R != VK_SUCCESS)
+			{
+				std::cout << "Geometry buffer memory bind failed with error: " << R << std::endl;
+			}
+
+			vkMapMemory(GFXDevice.Device, Memory, 0, VK_WHOLE_SIZE, 0, OutMapping);
+			return RegisterBuffer(Registry, Buffer, Memory, MemoryRequirements.size);
+		}
+	}
+
+	uint32_t AllocateGeometryRange(GeometryFreeList& List, const uint32_t Count)
+	{
+		if (Count == 0)
+		{
+			return GeometryAllocationFailed;
+		}
+
+		//Smallest range that fits keeps large ranges whole for large meshes
+		size_t Best = List.Free.size();
+		for (size_t i = 0; i < List.Free.size(); ++i)
+		{
+			if (List.Free[i].Count >= Count && (Best == List.Free.size() || List.Free[i].Count < List.Free[Best].Count))
+			{
+				Best = i;
+				if (List.Free[i].Count == Count)
+				{
+					break;
+				}
+			}
+		}
+		if (Best == List.Free.size())
+		{
+			return GeometryAllocationFailed;
+		}
+
+		GeometryFreeList::Range& Range = List.Free[Best];
+		const uint32_t Offset = Range.Offset;
+		Range.Offset += Count;
+		Range.Count -= Count;
+		if (Range.Count == 0)
+		{
+			List.Free.erase(List.Free.begin() + Best);
+		}
+		List.Used += Count;
+		return Offset;
+	}
+
+	void FreeGeometryRange(GeometryFreeList& List, const uint32_t Offset, const uint32_t Count)
+	{
+		auto Next = std::lower_bound(List.Free.begin(), List.Free.end(), Offset,
+			[](const GeometryFreeList::Range& Range, const uint32_t Value) { return Range.Offset < Value; });
+
+		const bool bMergePrevious = Next != List.Free.begin() && (Next - 1)->Offset + (Next - 1)->Count == Offset;
+		const bool bMergeNext = Next != List.Free.end() && Offset + Count == Next->Offset;
+		if (bMergePrevious && bMergeNext)
+		{
+			(Next - 1)->Count += Count + Next->Count;
+			List.Free.erase(Next);
+		}
+		else if (bMergePrevious)
+		{
+			(Next - 1)->Count += Count;
+		}
+		else if (bMergeNext)
+		{
+			Next->Offset = Offset;
+			Next->Count += Count;
+		}
+		else
+		{
+			GeometryFreeList::Range Range;
+			Range.Offset = Offset;
+			Range.Count = Count;
+			List.Free.insert(Next, Range);
+		}
+		List.Used -= Count;
+	}
+
+	GeometryBuffer CreateGeometryBuffer(GraphicsDevice& GFXDevice, ResourceRegistry& Registry, const uint32_t VertexStride, const uint32_t MaxVertices,
+		const uint32_t MaxIndices)
+	{
+		GeometryBuffer RetVal;
+		RetVal.VertexStride = VertexStride;
+
+		std::vector<MemoryTypeInfo> MemoryHeaps = EnumerateHeaps(GFXDevice.PhysicalDevice);
+		void* Mapping = nullptr;
+		RetVal.VertexBuffer = CreateArena(GFXDevice, Registry, MemoryHeaps, static_cast<VkDeviceSize> (VertexStride) * MaxVertices,
+			VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, &Mapping);
+		RetVal.VertexData = static_cast<uint8_t*> (Mapping);
+		RetVal.IndexBuffer = CreateArena(GFXDevice, Registry, MemoryHeaps, static_cast<VkDeviceSize> (sizeof(uint32_t)) * MaxIndices,
+			VK_BUFFER_USAGE_INDEX_BUFFER_BIT, &Mapping);
+		RetVal.IndexData = static_cast<uint32_t*> (Mapping);
+
+		RetVal.Vertices.Capacity = MaxVertices;
+		RetVal.Vertices.Free.push_back({ 0, MaxVertices });
+		RetVal.Indices.Capacity = MaxIndices;
+		RetVal.Indices.Free.push_back({ 0, MaxIndices });
+
+		return RetVal;
+	}
+
+	GeometryAllocation AllocateGeometry(GeometryBuffer& Geometry, const void* Vertices, const uint32_t VertexCount, const uint32_t* Indices, const uint32_t IndexCount)
+	{
+		GeometryAllocation RetVal;
+
+		const uint32_t VertexOffset = AllocateGeometryRange(Geometry.Vertices, VertexCount);
+		if (VertexOffset == GeometryAllocationFailed)
+		{
+			std::cout << "Geometry buffer out of vertex space for " << VertexCount << " vertices" << std::endl;
+			return RetVal;
+		}
+		const uint32_t FirstIndex = AllocateGeometryRange(Geometry.Indices, IndexCount);
+		if (FirstIndex == GeometryAllocationFailed)
+		{
+			std::cout << "Geometry buffer out of index space for " << IndexCount << " indices" << std::endl;
+			FreeGeometryRange(Geometry.Vertices, VertexOffset, VertexCount);
+			return RetVal;
+		}
+
+		memcpy(Geometry.VertexData + static_cast<size_t> (VertexOffset) * Geometry.VertexStride, Vertices, static_cast<size_t> (VertexCount) * Geometry.VertexStride);
+		memcpy(Geometry.IndexData + FirstIndex, Indices, IndexCount * sizeof(uint32_t));
+
+		RetVal.VertexOffset = static_cast<int32_t> (VertexOffset);
+		RetVal.VertexCount = VertexCount;
+		RetVal.FirstIndex = FirstIndex;
+		RetVal.IndexCount = IndexCount;
+		return RetVal;
+	}
+
+	void FreeGeometry(GeometryBuffer& Geometry, GeometryAllocation& Allocation)
+	{
+		if (Allocation.IndexCount > 0)
+		{
+			FreeGeometryRange(Geometry.Vertices, static_cast<uint32_t> (Allocation.VertexOffset), Allocation.VertexCount);
+			FreeGeometryRange(Geometry.Indices, Allocation.FirstIndex, Allocation.IndexCount);
+		}
+		Allocation = GeometryAllocation();
+	}
+
+	void DestroyGeometryBuffer(ResourceRegistry& Registry, DeletionQueue& Deletions, GeometryBuffer& Geometry)
+	{
+		ReleaseBuffer(Registry, Deletions, Geometry.VertexBuffer);
+		ReleaseBuffer(Registry, Deletions, Geometry.IndexBuffer);
+		Geometry = GeometryBuffer();
+	}
+}
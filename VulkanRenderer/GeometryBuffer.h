@@ -0,0 +1,74 @@
+#pragma once
+
+#include "vulkan\vulkan.h"
+#include "ResourceHandles.h"
+#include <vector>
+
+namespace VulkanCore
+{
+	struct GraphicsDevice;
+	struct DeletionQueue;
+
+	//Returned in place of an offset when no free range is large enough
+	static const uint32_t GeometryAllocationFailed = 0xFFFFFFFF;
+
+	//Free ranges of one arena in elements (vertices or indices), sorted by offset and merged on free
+	struct GeometryFreeList
+	{
+		struct Range
+		{
+			uint32_t Offset = 0;
+			uint32_t Count = 0;
+		};
+
+		std::vector<Range> Free;
+		uint32_t Capacity = 0;
+		uint32_t Used = 0;
+	};
+
+	//Best fit, returns the offset of Count elements or GeometryAllocationFailed
+	uint32_t AllocateGeometryRange(GeometryFreeList& List, const uint32_t Count);
+
+	//Returns a range from AllocateGeometryRange, merging it with its free neighbours
+	void FreeGeometryRange(GeometryFreeList& List, const uint32_t Offset, const uint32_t Count);
+
+	//Where a mesh lives inside the arenas, passed straight to vkCmdDrawIndexed / VkDrawIndexedIndirectCommand
+	//Indices stay relative to the mesh's own vertices, VertexOffset rebases them
+	struct GeometryAllocation
+	{
+		int32_t VertexOffset = 0;
+		uint32_t VertexCount = 0;
+		uint32_t FirstIndex = 0;
+		uint32_t IndexCount = 0;
+	};
+
+	//One vertex buffer and one index buffer shared by every mesh, so draws never rebind buffers
+	//and any set of meshes can go out in a single (multi) indirect draw
+	//Both arenas are persistently mapped, meshes are written in place when allocated
+	//The arenas are owned by a ResourceRegistry, draws look their VkBuffers up through the handles
+	struct GeometryBuffer
+	{
+		BufferHandle VertexBuffer;
+		BufferHandle IndexBuffer;
+		uint8_t* VertexData = nullptr;
+		uint32_t* IndexData = nullptr;
+
+		//Every mesh in the arena shares this vertex layout
+		uint32_t VertexStride = 0;
+
+		GeometryFreeList Vertices;
+		GeometryFreeList Indices;
+	};
+
+	GeometryBuffer CreateGeometryBuffer(GraphicsDevice& GFXDevice, ResourceRegistry& Registry, const uint32_t VertexStride, const uint32_t MaxVertices,
+		const uint32_t MaxIndices);
+
+	//Copies a mesh into the arenas, returns an allocation with IndexCount 0 when either arena is full
+	GeometryAllocation AllocateGeometry(GeometryBuffer& Geometry, const void* Vertices, const uint32_t VertexCount, const uint32_t* Indices, const uint32_t IndexCount);
+
+	//Unloads a mesh, no frame in flight may still draw it
+	void FreeGeometry(GeometryBuffer& Geometry, GeometryAllocation& Allocation);
+
+	//Releases both arenas to Deletions, their memory is unmapped when it's freed
+	void DestroyGeometryBuffer(ResourceRegistry& Registry, DeletionQueue& Deletions, GeometryBuffer& Geometry);
+}
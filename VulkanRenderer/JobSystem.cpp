@@ -0,0 +1,470 @@
+#include "JobSystem.h"
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <algorithm>
+
+namespace VulkanCore
+{
+	namespace
+	{
+		//Deque of the calling thread, null on threads that aren't part of a system
+		thread_local JobWorker* CurrentWorker = nullptr;
+
+		//Idle loops before a worker goes to sleep
+		const uint32_t SpinsBeforeSleep = 64;
+
+		bool PushBottom(JobDeque& Deque, Job* NewJob)
+		{
+			const int64_t Bottom = Deque.Bottom.load(std::memory_order_relaxed);
+			const int64_t Top = Deque.Top.load(std::memory_order_acquire);
+			if (Bottom - Top >= JobDeque::Capacity)
+			{
+				return false;
+			}
+
+			Deque.Slots[Bottom & (JobDeque::Capacity - 1)].store(NewJob, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			Deque.Bottom.store(Bottom + 1, std::memory_order_relaxed);
+			return true;
+		}
+
+		Job* PopBottom(JobDeque& Deque)
+		{
+			const int64_t Bottom = Deque.Bottom.load(std::memory_order_relaxed) - 1;
+			Deque.Bottom.store(Bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t Top = Deque.Top.load(std::memory_order_relaxed);
+
+			if (Top > Bottom)
+			{
+				//Empty
+				Deque.Bottom.store(Bottom + 1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			Job* Found = Deque.Slots[Bottom & (JobDeque::Capacity - 1)].load(std::memory_order_relaxed);
+			if (Top == Bottom)
+			{
+				//Last job, race thieves for it through Top
+				if (!Deque.Top.compare_exchange_strong(Top, Top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				{
+					Found = nullptr;
+				}
+				Deque.Bottom.store(Bottom + 1, std::memory_order_relaxed);
+			}
+			return Found;
+		}
+
+		Job* StealTop(JobDeque& Deque)
+		{
+			int64_t Top = Deque.Top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			const int64_t Bottom = Deque.Bottom.load(std::memory_order_acquire);
+
+			if (Top >= Bottom)
+			{
+				return nullptr;
+			}
+
+			Job* Found = Deque.Slots[Top & (JobDeque::Capacity - 1)].load(std::memory_order_relaxed);
+			if (!Deque.Top.compare_exchange_strong(Top, Top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			{
+				//Lost against the owner or another thief
+				return nullptr;
+			}
+			return Found;
+		}
+
+		void WakeWorker(JobSystemShared& Shared)
+		{
+			if (Shared.Sleeping.load() > 0)
+			{
+				//Taking the lock orders this against a worker checking Pending before it waits
+				std::lock_guard<std::mutex> Guard(Shared.SleepLock);
+				Shared.WakeUp.notify_one();
+			}
+		}
+
+		void RunAndFinish(JobSystemShared& Shared, Job* Done);
+
+		void QueueJob(JobSystemShared& Shared, Job* NewJob)
+		{
+			Shared.InFlight.fetch_add(1);
+
+			//Own deque when the thread has one, the shared queue otherwise
+			if (CurrentWorker)
+			{
+				Shared.Pending.fetch_add(1);
+				if (!PushBottom(CurrentWorker->Deque, NewJob))
+				{
+					Shared.Pending.fetch_sub(1);
+					RunAndFinish(Shared, NewJob);
+					return;
+				}
+			}
+			else
+			{
+				std::lock_guard<std::mutex> Guard(Shared.InjectedLock);
+				Shared.Pending.fetch_add(1);
+				Shared.Injected.push_back(NewJob);
+				Shared.InjectedCount.fetch_add(1);
+			}
+			WakeWorker(Shared);
+		}
+
+		void RunAndFinish(JobSystemShared& Shared, Job* Done)
+		{
+			Done->Function();
+			if (CurrentWorker)
+			{
+				CurrentWorker->JobsExecuted.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			JobCounter* Counter = Done->Counter;
+			delete Done;
+
+			if (!Counter)
+			{
+				Shared.InFlight.fetch_sub(1);
+				return;
+			}
+
+			//The transition to 0 and taking the waiting jobs happen under the lock, so a job added
+			//as dependent either sees a non-zero counter here or is queued directly by RunJob
+			std::vector<Job*> Released;
+			{
+				std::lock_guard<std::mutex> Guard(Counter->Lock);
+				if (Counter->Value.fetch_sub(1) == 1)
+				{
+					Released.swap(Counter->Waiting);
+				}
+			}
+
+			for (Job* Dependent : Released)
+			{
+				QueueJob(Shared, Dependent);
+			}
+			Shared.InFlight.fetch_sub(1);
+		}
+
+		Job* FindJob(JobSystemShared& Shared, JobWorker* Worker)
+		{
+			Job* Found = Worker ? PopBottom(Worker->Deque) : nullptr;
+
+			if (!Found && Shared.InjectedCount.load() > 0)
+			{
+				std::lock_guard<std::mutex> Guard(Shared.InjectedLock);
+				if (!Shared.Injected.empty())
+				{
+					Found = Shared.Injected.front();
+					Shared.Injected.pop_front();
+					Shared.InjectedCount.fetch_sub(1);
+				}
+			}
+
+			if (!Found)
+			{
+				//Start at a different victim per thief so they don't all hammer the same deque
+				const size_t WorkerCount = Shared.Workers.size();
+				const size_t First = std::hash<std::thread::id>()(std::this_thread::get_id()) % std::max<size_t>(WorkerCount, 1);
+				for (size_t i = 0; i < WorkerCount && !Found; ++i)
+				{
+					JobWorker* Victim = Shared.Workers[(First + i) % WorkerCount];
+					if (Victim != Worker)
+					{
+						Found = StealTop(Victim->Deque);
+					}
+				}
+				if (Found && Worker)
+				{
+					Worker->JobsStolen.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+
+			if (Found)
+			{
+				Shared.Pending.fetch_sub(1);
+			}
+			return Found;
+		}
+
+		void WorkerLoop(JobSystemShared* Shared, JobWorker* Worker)
+		{
+			CurrentWorker = Worker;
+
+			uint32_t IdleSpins = 0;
+			while (!Shared->bQuit.load())
+			{
+				if (Job* Found = FindJob(*Shared, Worker))
+				{
+					RunAndFinish(*Shared, Found);
+					IdleSpins = 0;
+					continue;
+				}
+
+				if (++IdleSpins < SpinsBeforeSleep)
+				{
+					std::this_thread::yield();
+					continue;
+				}
+
+				Shared->Sleeping.fetch_add(1);
+				{
+					std::unique_lock<std::mutex> Lock(Shared->SleepLock);
+					Shared->WakeUp.wait(Lock, [Shared]() { return Shared->Pending.load() > 0 || Shared->bQuit.load(); });
+				}
+				Shared->Sleeping.fetch_sub(1);
+				IdleSpins = 0;
+			}
+
+			CurrentWorker = nullptr;
+		}
+	}
+
+	JobSystem CreateJobSystem(const uint32_t WorkerThreads, const bool bMainThreadParticipates)
+	{
+		JobSystem RetVal;
+		RetVal.Shared.reset(new JobSystemShared());
+		RetVal.Shared->bMainThreadParticipates = bMainThreadParticipates;
+
+		const uint32_t DequeCount = WorkerThreads + (bMainThreadParticipates ? 1 : 0);
+		for (uint32_t i = 0; i < DequeCount; ++i)
+		{
+			RetVal.Workers.emplace_back(new JobWorker());
+			RetVal.Shared->Workers.push_back(RetVal.Workers.back().get());
+		}
+
+		if (bMainThreadParticipates)
+		{
+			CurrentWorker = RetVal.Workers[0].get();
+		}
+
+		//Start threads only once every deque exists, they steal from all of them
+		for (uint32_t i = bMainThreadParticipates ? 1 : 0; i < DequeCount; ++i)
+		{
+			RetVal.Workers[i]->Thread = std::thread(WorkerLoop, RetVal.Shared.get(), RetVal.Workers[i].get());
+		}
+
+		return RetVal;
+	}
+
+	void RunJob(JobSystem& System, std::function<void()> Function, JobCounter* Counter, JobCounter* Dependency)
+	{
+		Job* NewJob = new Job();
+		NewJob->Function = std::move(Function);
+		NewJob->Counter = Counter;
+
+		if (Counter)
+		{
+			Counter->Value.fetch_add(1);
+		}
+
+		if (Dependency)
+		{
+			std::lock_guard<std::mutex> Guard(Dependency->Lock);
+			if (Dependency->Value.load() > 0)
+			{
+				Dependency->Waiting.push_back(NewJob);
+				return;
+			}
+		}
+
+		QueueJob(*System.Shared, NewJob);
+	}
+
+	void ParallelFor(JobSystem& System, const uint32_t Count, const uint32_t BatchSize, std::function<void(uint32_t, uint32_t)> Function, JobCounter& Counter)
+	{
+		//Shared between the batches instead of copied into each
+		std::shared_ptr<std::function<void(uint32_t, uint32_t)>> Shared = std::make_shared<std::function<void(uint32_t, uint32_t)>>(std::move(Function));
+
+		const uint32_t Batch = std::max(BatchSize, 1u);
+		for (uint32_t Begin = 0; Begin < Count; Begin += Batch)
+		{
+			const uint32_t End = std::min(Begin + Batch, Count);
+			RunJob(System, [Shared, Begin, End]() { (*Shared)(Begin, End); }, &Counter);
+		}
+	}
+
+	void WaitForCounter(JobSystem& System, JobCounter& Counter)
+	{
+		JobSystemShared& Shared = *System.Shared;
+		while (Counter.Value.load() > 0)
+		{
+			Job* Found = CurrentWorker ? FindJob(Shared, CurrentWorker) : nullptr;
+			if (Found)
+			{
+				RunAndFinish(Shared, Found);
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+		}
+
+		//The job that brought it to 0 may still hold the lock, the counter can go away once it's released
+		std::lock_guard<std::mutex> Guard(Counter.Lock);
+	}
+
+	void DestroyJobSystem(JobSystem& System)
+	{
+		if (!System.Shared)
+		{
+			return;
+		}
+
+		//Pending alone can reach 0 while a running job is about to release its dependents
+		JobSystemShared& Shared = *System.Shared;
+		while (Shared.InFlight.load() > 0)
+		{
+			Job* Found = CurrentWorker ? FindJob(Shared, CurrentWorker) : nullptr;
+			if (Found)
+			{
+				RunAndFinish(Shared, Found);
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+		}
+
+		{
+			std::lock_guard<std::mutex> Guard(Shared.SleepLock);
+			Shared.bQuit.store(true);
+			Shared.WakeUp.notify_all();
+		}
+
+		for (std::unique_ptr<JobWorker>& Worker : System.Workers)
+		{
+			if (Worker->Thread.joinable())
+			{
+				Worker->Thread.join();
+			}
+		}
+
+		if (Shared.bMainThreadParticipates)
+		{
+			CurrentWorker = nullptr;
+		}
+		System = JobSystem();
+	}
+
+	namespace
+	{
+		//Fixed amount of arithmetic standing in for a job's real work
+		float BusyWork(const uint32_t Seed, const uint32_t Iterations)
+		{
+			float Value = static_cast<float> (Seed);
+			for (uint32_t i = 0; i < Iterations; ++i)
+			{
+				Value = std::sqrt(Value * 1.0001f + 1.0f);
+			}
+			return Value;
+		}
+
+		//Sphere vs 6 plane tests over every element, in batches like frustum culling would
+		double BenchmarkCulling(JobSystem& System, const std::vector<float>& Spheres, std::vector<uint8_t>& Visible)
+		{
+			static const float Planes[6][4] =
+			{
+				{ 1.0f, 0.0f, 0.0f, 50.0f }, { -1.0f, 0.0f, 0.0f, 50.0f },
+				{ 0.0f, 1.0f, 0.0f, 50.0f }, { 0.0f, -1.0f, 0.0f, 50.0f },
+				{ 0.0f, 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, -1.0f, 100.0f }
+			};
+
+			const uint32_t Count = static_cast<uint32_t> (Visible.size());
+			auto Start = std::chrono::high_resolution_clock::now();
+
+			JobCounter Counter;
+			ParallelFor(System, Count, 1024, [&Spheres, &Visible](uint32_t Begin, uint32_t End)
+			{
+				for (uint32_t i = Begin; i < End; ++i)
+				{
+					const float* Sphere = &Spheres[i * 4];
+					bool bInside = true;
+					for (uint32_t p = 0; p < 6; ++p)
+					{
+						bInside &= Planes[p][0] * Sphere[0] + Planes[p][1] * Sphere[1] + Planes[p][2] * Sphere[2] + Planes[p][3] >= -Sphere[3];
+					}
+					Visible[i] = bInside ? 1 : 0;
+				}
+			}, Counter);
+			WaitForCounter(System, Counter);
+
+			return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - Start).count();
+		}
+
+		//Independent chains whose links each wait for the previous one, exercising counters and dependency release
+		double BenchmarkChains(JobSystem& System, const uint32_t ChainCount, const uint32_t ChainLength, std::vector<float>& Results)
+		{
+			auto Start = std::chrono::high_resolution_clock::now();
+
+			std::unique_ptr<JobCounter[]> Links(new JobCounter[ChainCount * ChainLength]);
+			JobCounter AllDone;
+			for (uint32_t Chain = 0; Chain < ChainCount; ++Chain)
+			{
+				for (uint32_t Link = 0; Link < ChainLength; ++Link)
+				{
+					JobCounter* Previous = Link > 0 ? &Links[Chain * ChainLength + Link - 1] : nullptr;
+					JobCounter* Counter = Link + 1 < ChainLength ? &Links[Chain * ChainLength + Link] : &AllDone;
+					RunJob(System, [&Results, Chain]() { Results[Chain] = BusyWork(static_cast<uint32_t> (Results[Chain]), 2000); }, Counter, Previous);
+				}
+			}
+			WaitForCounter(System, AllDone);
+
+			return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - Start).count();
+		}
+	}
+
+	void RunJobSystemBenchmark()
+	{
+		const uint32_t MaxThreads = std::max(std::thread::hardware_concurrency(), 1u);
+		const uint32_t SphereCount = 1 << 22;
+		const uint32_t ChainCount = 256;
+		const uint32_t ChainLength = 16;
+		const uint32_t Runs = 10;
+
+		std::vector<float> Spheres(SphereCount * 4);
+		for (uint32_t i = 0; i < SphereCount * 4; ++i)
+		{
+			Spheres[i] = BusyWork(i, 1) * 10.0f - 60.0f;
+		}
+		std::vector<uint8_t> Visible(SphereCount);
+		std::vector<float> Results(ChainCount);
+
+		std::cout << "Job system scaling, " << SphereCount << " spheres culled in batches of 1024, "
+			<< ChainCount << " chains of " << ChainLength << " dependent jobs, best of " << Runs << " runs" << std::endl;
+
+		double CullingBase = 0.0;
+		double ChainsBase = 0.0;
+		for (uint32_t Threads = 1; Threads <= MaxThreads; ++Threads)
+		{
+			//The main thread is always one of the threads
+			JobSystem System = CreateJobSystem(Threads - 1, true);
+
+			double CullingMs = 1e9;
+			double ChainsMs = 1e9;
+			for (uint32_t Run = 0; Run < Runs; ++Run)
+			{
+				CullingMs = std::min(CullingMs, BenchmarkCulling(System, Spheres, Visible));
+				ChainsMs = std::min(ChainsMs, BenchmarkChains(System, ChainCount, ChainLength, Results));
+			}
+
+			uint64_t Stolen = 0;
+			for (std::unique_ptr<JobWorker>& Worker : System.Workers)
+			{
+				Stolen += Worker->JobsStolen.load();
+			}
+			DestroyJobSystem(System);
+
+			if (Threads == 1)
+			{
+				CullingBase = CullingMs;
+				ChainsBase = ChainsMs;
+			}
+
+			std::cout << Threads << " threads: culling " << CullingMs << " ms (" << CullingBase / CullingMs << "x), chains "
+				<< ChainsMs << " ms (" << ChainsBase / ChainsMs << "x), " << Stolen << " jobs stolen" << std::endl;
+		}
+	}
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
+namespace VulkanCore
+{
+	struct Job;
+
+	//Number of outstanding jobs counted by it, jobs that depend on it are queued once it drops to 0
+	//Not copyable, has to outlive every job counted by or depending on it
+	struct JobCounter
+	{
+		std::atomic<uint32_t> Value{ 0 };
+
+		//Guards Waiting and the transition to 0
+		std::mutex Lock;
+		std::vector<Job*> Waiting;
+	};
+
+	struct Job
+	{
+		std::function<void()> Function;
+
+		//Decremented once Function returns
+		JobCounter* Counter = nullptr;
+	};
+
+	//Chase-Lev work stealing deque: the owning thread pushes and pops at the bottom, other threads steal from the top
+	//Fixed capacity, a push onto a full deque fails and the job is run right away instead
+	struct JobDeque
+	{
+		static const int64_t Capacity = 4096;
+
+		std::atomic<int64_t> Top{ 0 };
+		std::atomic<int64_t> Bottom{ 0 };
+		std::atomic<Job*> Slots[Capacity];
+	};
+
+	struct JobWorker
+	{
+		JobDeque Deque;
+		std::thread Thread;
+
+		//Written by the owning thread only
+		std::atomic<uint64_t> JobsExecuted{ 0 };
+		std::atomic<uint64_t> JobsStolen{ 0 };
+	};
+
+	//State every thread of a system shares, heap allocated so the JobSystem itself can be moved
+	struct JobSystemShared
+	{
+		//Worker 0 is the main thread when it participates
+		std::vector<JobWorker*> Workers;
+		bool bMainThreadParticipates = false;
+
+		//Jobs submitted by threads without a deque
+		std::mutex InjectedLock;
+		std::deque<Job*> Injected;
+		std::atomic<uint32_t> InjectedCount{ 0 };
+
+		//Jobs queued anywhere and not yet taken, idle workers sleep while it is 0
+		std::atomic<uint32_t> Pending{ 0 };
+
+		//Jobs queued or running, a running job only leaves it after queueing the dependents it released
+		std::atomic<uint32_t> InFlight{ 0 };
+		std::atomic<uint32_t> Sleeping{ 0 };
+		std::mutex SleepLock;
+		std::condition_variable WakeUp;
+
+		std::atomic<bool> bQuit{ false };
+	};
+
+	//Work stealing scheduler shared by culling, command recording, asset decode and pipeline compilation
+	//Every worker thread owns a deque: jobs it submits go to its own bottom, and idle workers steal from the others' tops
+	//With bMainThreadParticipates the creating thread gets a deque as well and runs jobs while it waits on a counter
+	struct JobSystem
+	{
+		std::vector<std::unique_ptr<JobWorker>> Workers;
+		std::unique_ptr<JobSystemShared> Shared;
+	};
+
+	//Must be called on the main thread, WorkerThreads may be 0 when the main thread participates
+	JobSystem CreateJobSystem(const uint32_t WorkerThreads, const bool bMainThreadParticipates);
+
+	//Queues Function, counting it in Counter when given, and holds it back until Dependency reaches 0 when given
+	void RunJob(JobSystem& System, std::function<void()> Function, JobCounter* Counter = nullptr, JobCounter* Dependency = nullptr);
+
+	//Splits [0, Count) into jobs of BatchSize elements, each calling Function(Begin, End), all counted in Counter
+	void ParallelFor(JobSystem& System, const uint32_t Count, const uint32_t BatchSize, std::function<void(uint32_t, uint32_t)> Function, JobCounter& Counter);
+
+	//Returns once Counter is 0, worker threads and the participating main thread run other jobs meanwhile
+	void WaitForCounter(JobSystem& System, JobCounter& Counter);
+
+	//Runs every queued job to completion, then stops and joins the workers
+	void DestroyJobSystem(JobSystem& System);
+
+	//Times a culling style ParallelFor and dependent job chains with 1 to hardware_concurrency threads and prints the scaling
+	void RunJobSystemBenchmark();
+}
@@ -0,0 +1,435 @@
+#include "MeshLOD.h"
+#include <iostream>
+#include <cmath>
+#include <cfloat>
+#include <algorithm>
+#include <queue>
+#include <unordered_map>
+
+namespace VulkanCore
+{
+	//Boundary edges get a perpendicular constraint plane so open borders don't shrink inwards
+	static const double BoundaryWeight = 10.0;
+
+	//Minimum cosine between a triangle's normal before and after a collapse, anything less is treated as a flip
+	static const double MinFlipCosine = 0.2;
+
+	//Symmetric 4x4 error quadric, stored as the upper triangle: a2 ab ac ad b2 bc bd c2 cd d2
+	struct Quadric
+	{
+		double Q[10] = {};
+
+		void AddPlane(const double a, const double b, const double c, const double d, const double Weight)
+		{
+			Q[0] += Weight * a * a; Q[1] += Weight * a * b; Q[2] += Weight * a * c; Q[3] += Weight * a * d;
+			Q[4] += Weight * b * b; Q[5] += Weight * b * c; Q[6] += Weight * b * d;
+			Q[7] += Weight * c * c; Q[8] += Weight * c * d;
+			Q[9] += Weight * d * d;
+		}
+
+		void Add(const Quadric& Other)
+		{
+			for (int i = 0; i < 10; ++i)
+			{
+				Q[i] += Other.Q[i];
+			}
+		}
+
+		double Evaluate(const float* P) const
+		{
+			const double x = P[0], y = P[1], z = P[2];
+			return Q[0] * x * x + 2.0 * Q[1] * x * y + 2.0 * Q[2] * x * z + 2.0 * Q[3] * x
+				+ Q[4] * y * y + 2.0 * Q[5] * y * z + 2.0 * Q[6] * y
+				+ Q[7] * z * z + 2.0 * Q[8] * z
+				+ Q[9];
+		}
+	};
+
+	static const float* GetVertex(const float* Positions, const size_t VertexStride, const uint32_t Index)
+	{
+		return reinterpret_cast<const float*> (reinterpret_cast<const uint8_t*> (Positions) + VertexStride * Index);
+	}
+
+	//Unnormalized triangle normal (length is twice the area)
+	static void TriangleNormal(const float* A, const float* B, const float* C, double* N)
+	{
+		double E1[3] = { B[0] - A[0], B[1] - A[1], B[2] - A[2] };
+		double E2[3] = { C[0] - A[0], C[1] - A[1], C[2] - A[2] };
+		N[0] = E1[1] * E2[2] - E1[2] * E2[1];
+		N[1] = E1[2] * E2[0] - E1[0] * E2[2];
+		N[2] = E1[0] * E2[1] - E1[1] * E2[0];
+	}
+
+	//A pending half-edge collapse From -> To, versions detect candidates made stale by earlier collapses
+	struct CollapseCandidate
+	{
+		double Cost;
+		uint32_t From;
+		uint32_t To;
+		uint32_t FromVersion;
+		uint32_t ToVersion;
+
+		bool operator>(const CollapseCandidate& Other) const { return Cost > Other.Cost; }
+	};
+
+	std::vector<uint32_t> SimplifyMesh(const float* Positions, const size_t VertexCount, const size_t VertexStride, const uint32_t* Indices, const size_t IndexCount,
+		const size_t TargetIndexCount, const float MaxError, float* OutError)
+	{
+		const size_t TriangleCount = IndexCount / 3;
+		std::vector<uint32_t> Triangles(Indices, Indices + TriangleCount * 3);
+		std::vector<uint8_t> TriangleDead(TriangleCount, 0);
+		std::vector<std::vector<uint32_t>> VertexTriangles(VertexCount);
+		std::vector<Quadric> Quadrics(VertexCount);
+
+		//Face planes
+		for (uint32_t t = 0; t < TriangleCount; ++t)
+		{
+			const uint32_t* Tri = &Triangles[t * 3];
+			const float* A = GetVertex(Positions, VertexStride, Tri[0]);
+
+			double N[3];
+			TriangleNormal(A, GetVertex(Positions, VertexStride, Tri[1]), GetVertex(Positions, VertexStride, Tri[2]), N);
+			double Length = sqrt(N[0] * N[0] + N[1] * N[1] + N[2] * N[2]);
+
+			for (int v = 0; v < 3; ++v)
+			{
+				VertexTriangles[Tri[v]].push_back(t);
+			}
+
+			if (Length <= 0.0)
+			{
+				continue;
+			}
+
+			N[0] /= Length; N[1] /= Length; N[2] /= Length;
+			double D = -(N[0] * A[0] + N[1] * A[1] + N[2] * A[2]);
+			for (int v = 0; v < 3; ++v)
+			{
+				Quadrics[Tri[v]].AddPlane(N[0], N[1], N[2], D, 1.0);
+			}
+		}
+
+		//Edges used by a single triangle are on the border
+		std::unordered_map<uint64_t, uint32_t> EdgeUse;
+		auto EdgeKey = [](uint32_t A, uint32_t B) { return (static_cast<uint64_t> (std::min(A, B)) << 32) | std::max(A, B); };
+		for (size_t i = 0; i < Triangles.size(); i += 3)
+		{
+			for (int e = 0; e < 3; ++e)
+			{
+				++EdgeUse[EdgeKey(Triangles[i + e], Triangles[i + (e + 1) % 3])];
+			}
+		}
+
+		for (uint32_t t = 0; t < TriangleCount; ++t)
+		{
+			const uint32_t* Tri = &Triangles[t * 3];
+			double N[3];
+			TriangleNormal(GetVertex(Positions, VertexStride, Tri[0]), GetVertex(Positions, VertexStride, Tri[1]), GetVertex(Positions, VertexStride, Tri[2]), N);
+
+			for (int e = 0; e < 3; ++e)
+			{
+				uint32_t A = Tri[e];
+				uint32_t B = Tri[(e + 1) % 3];
+				if (EdgeUse[EdgeKey(A, B)] != 1)
+				{
+					continue;
+				}
+
+				const float* PA = GetVertex(Positions, VertexStride, A);
+				const float* PB = GetVertex(Positions, VertexStride, B);
+				double Edge[3] = { PB[0] - PA[0], PB[1] - PA[1], PB[2] - PA[2] };
+
+				//Plane containing the edge and perpendicular to the face
+				double P[3] = { Edge[1] * N[2] - Edge[2] * N[1], Edge[2] * N[0] - Edge[0] * N[2], Edge[0] * N[1] - Edge[1] * N[0] };
+				double Length = sqrt(P[0] * P[0] + P[1] * P[1] + P[2] * P[2]);
+				if (Length <= 0.0)
+				{
+					continue;
+				}
+
+				P[0] /= Length; P[1] /= Length; P[2] /= Length;
+				double D = -(P[0] * PA[0] + P[1] * PA[1] + P[2] * PA[2]);
+				Quadrics[A].AddPlane(P[0], P[1], P[2], D, BoundaryWeight);
+				Quadrics[B].AddPlane(P[0], P[1], P[2], D, BoundaryWeight);
+			}
+		}
+
+		std::vector<uint32_t> Version(VertexCount, 0);
+		std::vector<uint8_t> Removed(VertexCount, 0);
+		std::priority_queue<CollapseCandidate, std::vector<CollapseCandidate>, std::greater<CollapseCandidate>> Queue;
+
+		//Queue the cheaper direction of the edge A-B
+		auto PushEdge = [&](uint32_t A, uint32_t B)
+		{
+			Quadric Sum = Quadrics[A];
+			Sum.Add(Quadrics[B]);
+
+			double CostAB = Sum.Evaluate(GetVertex(Positions, VertexStride, B));
+			double CostBA = Sum.Evaluate(GetVertex(Positions, VertexStride, A));
+
+			CollapseCandidate Candidate;
+			Candidate.Cost = std::max(0.0, std::min(CostAB, CostBA));
+			Candidate.From = CostAB <= CostBA ? A : B;
+			Candidate.To = CostAB <= CostBA ? B : A;
+			Candidate.FromVersion = Version[Candidate.From];
+			Candidate.ToVersion = Version[Candidate.To];
+			Queue.push(Candidate);
+		};
+
+		for (auto& Edge : EdgeUse)
+		{
+			PushEdge(static_cast<uint32_t> (Edge.first >> 32), static_cast<uint32_t> (Edge.first & 0xFFFFFFFF));
+		}
+
+		size_t AliveIndexCount = TriangleCount * 3;
+		const double MaxCost = static_cast<double> (MaxError) * MaxError;
+		double WorstCost = 0.0;
+
+		while (AliveIndexCount > TargetIndexCount && !Queue.empty())
+		{
+			CollapseCandidate Candidate = Queue.top();
+			Queue.pop();
+
+			if (Removed[Candidate.From] || Removed[Candidate.To] ||
+				Version[Candidate.From] != Candidate.FromVersion || Version[Candidate.To] != Candidate.ToVersion)
+			{
+				continue;
+			}
+
+			if (Candidate.Cost > MaxCost)
+			{
+				break;
+			}
+
+			//Reject collapses that would flip or degenerate a surviving triangle
+			const float* ToPosition = GetVertex(Positions, VertexStride, Candidate.To);
+			bool bFlips = false;
+			for (uint32_t t : VertexTriangles[Candidate.From])
+			{
+				const uint32_t* Tri = &Triangles[t * 3];
+				if (TriangleDead[t] || Tri[0] == Candidate.To || Tri[1] == Candidate.To || Tri[2] == Candidate.To)
+				{
+					continue;
+				}
+
+				const float* Before[3];
+				const float* After[3];
+				for (int v = 0; v < 3; ++v)
+				{
+					Before[v] = GetVertex(Positions, VertexStride, Tri[v]);
+					After[v] = Tri[v] == Candidate.From ? ToPosition : Before[v];
+				}
+
+				double N0[3], N1[3];
+				TriangleNormal(Before[0], Before[1], Before[2], N0);
+				TriangleNormal(After[0], After[1], After[2], N1);
+				double Dot = N0[0] * N1[0] + N0[1] * N1[1] + N0[2] * N1[2];
+				double Lengths = sqrt(N0[0] * N0[0] + N0[1] * N0[1] + N0[2] * N0[2]) * sqrt(N1[0] * N1[0] + N1[1] * N1[1] + N1[2] * N1[2]);
+				if (Lengths <= 0.0 || Dot < MinFlipCosine * Lengths)
+				{
+					bFlips = true;
+					break;
+				}
+			}
+
+			if (bFlips)
+			{
+				continue;
+			}
+
+			//Collapse From into To
+			for (uint32_t t : VertexTriangles[Candidate.From])
+			{
+				if (TriangleDead[t])
+				{
+					continue;
+				}
+
+				uint32_t* Tri = &Triangles[t * 3];
+				if (Tri[0] == Candidate.To || Tri[1] == Candidate.To || Tri[2] == Candidate.To)
+				{
+					TriangleDead[t] = 1;
+					AliveIndexCount -= 3;
+					continue;
+				}
+
+				for (int v = 0; v < 3; ++v)
+				{
+					if (Tri[v] == Candidate.From)
+					{
+						Tri[v] = Candidate.To;
+					}
+				}
+				VertexTriangles[Candidate.To].push_back(t);
+			}
+
+			Quadrics[Candidate.To].Add(Quadrics[Candidate.From]);
+			Removed[Candidate.From] = 1;
+			VertexTriangles[Candidate.From].clear();
+			++Version[Candidate.To];
+			WorstCost = std::max(WorstCost, Candidate.Cost);
+
+			//Re-queue every edge around the surviving vertex with its new quadric
+			for (uint32_t t : VertexTriangles[Candidate.To])
+			{
+				if (TriangleDead[t])
+				{
+					continue;
+				}
+
+				for (int v = 0; v < 3; ++v)
+				{
+					uint32_t Neighbor = Triangles[t * 3 + v];
+					if (Neighbor != Candidate.To)
+					{
+						PushEdge(Candidate.To, Neighbor);
+					}
+				}
+			}
+		}
+
+		std::vector<uint32_t> Result;
+		Result.reserve(AliveIndexCount);
+		for (uint32_t t = 0; t < TriangleCount; ++t)
+		{
+			if (!TriangleDead[t])
+			{
+				Result.insert(Result.end(), &Triangles[t * 3], &Triangles[t * 3] + 3);
+			}
+		}
+
+		if (OutError)
+		{
+			*OutError = static_cast<float> (sqrt(WorstCost));
+		}
+
+		return Result;
+	}
+
+	MeshLODChain BuildLODChain(const float* Positions, const size_t VertexCount, const size_t VertexStride, const uint32_t* Indices, const size_t IndexCount,
+		const uint32_t MaxLevels, const float ReductionPerLevel)
+	{
+		MeshLODChain Chain;
+
+		//Bounding sphere centered on the AABB
+		float Min[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+		float Max[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+		for (size_t v = 0; v < VertexCount; ++v)
+		{
+			const float* P = GetVertex(Positions, VertexStride, static_cast<uint32_t> (v));
+			for (int i = 0; i < 3; ++i)
+			{
+				Min[i] = std::min(Min[i], P[i]);
+				Max[i] = std::max(Max[i], P[i]);
+			}
+		}
+
+		float RadiusSq = 0.0f;
+		for (int i = 0; i < 3; ++i)
+		{
+			Chain.Center[i] = (Min[i] + Max[i]) * 0.5f;
+		}
+		for (size_t v = 0; v < VertexCount; ++v)
+		{
+			const float* P = GetVertex(Positions, VertexStride, static_cast<uint32_t> (v));
+			float D[3] = { P[0] - Chain.Center[0], P[1] - Chain.Center[1], P[2] - Chain.Center[2] };
+			RadiusSq = std::max(RadiusSq, D[0] * D[0] + D[1] * D[1] + D[2] * D[2]);
+		}
+		Chain.Radius = sqrtf(RadiusSq);
+
+		std::vector<uint32_t> LevelIndices(Indices, Indices + IndexCount);
+		float LevelError = 0.0f;
+		size_t TargetIndexCount = IndexCount;
+
+		for (uint32_t Level = 0; Level < MaxLevels; ++Level)
+		{
+			if (Level > 0)
+			{
+				//Always simplify from the source mesh so the error is measured against the original surface
+				//Deviating by more than the mesh's own size makes a level useless, so that bounds the error
+				TargetIndexCount = static_cast<size_t> (TargetIndexCount * ReductionPerLevel) / 3 * 3;
+
+				float Error = 0.0f;
+				std::vector<uint32_t> Simplified = SimplifyMesh(Positions, VertexCount, VertexStride, Indices, IndexCount, TargetIndexCount, Chain.Radius, &Error);
+
+				//Not worth another level if the simplifier got stuck
+				if (Simplified.empty() || Simplified.size() > LevelIndices.size() * 95 / 100)
+				{
+					break;
+				}
+
+				LevelIndices.swap(Simplified);
+				LevelError = std::max(LevelError, Error);
+			}
+
+			MeshLODLevel LOD;
+			LOD.Error = LevelError;
+			LOD.FirstIndex = static_cast<uint32_t> (Chain.Indices.size());
+			LOD.Meshlets = BuildMeshlets(Positions, VertexCount, VertexStride, LevelIndices.data(), LevelIndices.size());
+			LOD.IndexCount = static_cast<uint32_t> (LOD.Meshlets.Indices.size());
+
+			//Rebase meshlets onto the shared index buffer, the per-level copy isn't needed after that
+			for (Meshlet& Cluster : LOD.Meshlets.Meshlets)
+			{
+				Cluster.FirstIndex += LOD.FirstIndex;
+			}
+			Chain.Indices.insert(Chain.Indices.end(), LOD.Meshlets.Indices.begin(), LOD.Meshlets.Indices.end());
+			std::vector<uint32_t>().swap(LOD.Meshlets.Indices);
+
+			Chain.Levels.push_back(std::move(LOD));
+		}
+
+		std::cout << "Built " << Chain.Levels.size() << " LOD levels:";
+		for (const MeshLODLevel& LOD : Chain.Levels)
+		{
+			std::cout << " [" << LOD.IndexCount / 3 << " tris, error " << LOD.Error << "]";
+		}
+		std::cout << std::endl;
+
+		return Chain;
+	}
+
+	float ComputeLODProjectionScale(const float VerticalFov, const uint32_t ScreenHeight)
+	{
+		return static_cast<float> (ScreenHeight) / (2.0f * tanf(VerticalFov * 0.5f));
+	}
+
+	uint32_t SelectLOD(const MeshLODChain& Chain, const float Distance, const float ProjectionScale, LODSelection& Selection,
+		const float PixelError, const float Hysteresis)
+	{
+		if (Chain.Levels.empty())
+		{
+			return 0;
+		}
+
+		//Distance to the nearest point of the bounds, inside the bounds always use the finest level
+		const float NearestDistance = Distance - Chain.Radius;
+		if (NearestDistance <= 0.0f)
+		{
+			Selection.Level = 0;
+			return 0;
+		}
+
+		auto ProjectedError = [&](uint32_t Level)
+		{
+			return Chain.Levels[Level].Error / NearestDistance * ProjectionScale;
+		};
+
+		uint32_t Level = std::min<uint32_t>(Selection.Level, static_cast<uint32_t> (Chain.Levels.size()) - 1);
+
+		//Refine as soon as the current level is visibly wrong
+		while (Level > 0 && ProjectedError(Level) > PixelError)
+		{
+			--Level;
+		}
+
+		//Only coarsen once the next level fits with some margin
+		while (Level + 1 < Chain.Levels.size() && ProjectedError(Level + 1) <= PixelError * (1.0f - Hysteresis))
+		{
+			++Level;
+		}
+
+		Selection.Level = Level;
+		return Level;
+	}
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Meshlets.h"
+#include <vector>
+
+namespace VulkanCore
+{
+	//One level of detail: a meshlet set whose indices live in the chain's shared index buffer
+	struct MeshLODLevel
+	{
+		uint32_t FirstIndex = 0;
+		uint32_t IndexCount = 0;
+
+		//Object space deviation from the source mesh introduced by simplification
+		float Error = 0.0f;
+
+		//Meshlet FirstIndex values are absolute within MeshLODChain::Indices
+		MeshletMesh Meshlets;
+	};
+
+	//All levels of a mesh, finest first. Every level references the same vertices, so only indices differ
+	struct MeshLODChain
+	{
+		std::vector<MeshLODLevel> Levels;
+
+		//Every level's meshlet ordered indices back to back, uploaded as a single index buffer
+		std::vector<uint32_t> Indices;
+
+		//Bounds of the whole mesh used for projected size
+		float Center[3];
+		float Radius = 0.0f;
+	};
+
+	//Quadric error metric edge collapse, removes triangles until TargetIndexCount or MaxError is reached
+	//Returns the simplified index list and the error it introduced through OutError
+	std::vector<uint32_t> SimplifyMesh(const float* Positions, const size_t VertexCount, const size_t VertexStride, const uint32_t* Indices, const size_t IndexCount,
+		const size_t TargetIndexCount, const float MaxError, float* OutError);
+
+	//Builds up to MaxLevels levels, each with roughly ReductionPerLevel of the previous level's triangles
+	//Stops early once a level can't be reduced meaningfully
+	MeshLODChain BuildLODChain(const float* Positions, const size_t VertexCount, const size_t VertexStride, const uint32_t* Indices, const size_t IndexCount,
+		const uint32_t MaxLevels, const float ReductionPerLevel = 0.5f);
+
+	//Per-instance selection state, carried between frames for hysteresis
+	struct LODSelection
+	{
+		uint32_t Level = 0;
+	};
+
+	//Projection scale for a perspective camera: ScreenHeight / (2 * tan(VerticalFov / 2))
+	float ComputeLODProjectionScale(const float VerticalFov, const uint32_t ScreenHeight);
+
+	//Picks the coarsest level whose error projects to at most PixelError pixels at Distance
+	//Moving to a coarser level requires the error to fit within PixelError * (1 - Hysteresis) so levels don't flicker at the boundary
+	uint32_t SelectLOD(const MeshLODChain& Chain, const float Distance, const float ProjectionScale, LODSelection& Selection,
+		const float PixelError = 1.0f, const float Hysteresis = 0.25f);
+}
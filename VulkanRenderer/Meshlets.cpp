@@ -0,0 +1,327 @@
+#include "Meshlets.h"
+#include "VulkanInitializers.h"
+#include "ResourceRegistry.h"
+#include <iostream>
+#include <cmath>
+#include <cfloat>
+#include <cstring>
+#include <algorithm>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <xmmintrin.h>
+#define MESHLETS_SSE 1
+#endif
+
+namespace VulkanCore
+{
+	static const float* GetPosition(const float* Positions, const size_t VertexStride, const uint32_t Index)
+	{
+		return reinterpret_cast<const float*> (reinterpret_cast<const uint8_t*> (Positions) + VertexStride * Index);
+	}
+
+	static void ComputeMeshletBounds(Meshlet& Cluster, const float* Positions, const size_t VertexStride, const uint32_t* ClusterIndices, const std::vector<uint32_t>& ClusterVertices)
+	{
+		//Bounding sphere centered on the AABB
+		float Min[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+		float Max[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+		for (uint32_t Vertex : ClusterVertices)
+		{
+			const float* P = GetPosition(Positions, VertexStride, Vertex);
+			for (int i = 0; i < 3; ++i)
+			{
+				Min[i] = std::min(Min[i], P[i]);
+				Max[i] = std::max(Max[i], P[i]);
+			}
+		}
+
+		for (int i = 0; i < 3; ++i)
+		{
+			Cluster.Center[i] = (Min[i] + Max[i]) * 0.5f;
+		}
+
+		float RadiusSq = 0.0f;
+		for (uint32_t Vertex : ClusterVertices)
+		{
+			const float* P = GetPosition(Positions, VertexStride, Vertex);
+			float D[3] = { P[0] - Cluster.Center[0], P[1] - Cluster.Center[1], P[2] - Cluster.Center[2] };
+			RadiusSq = std::max(RadiusSq, D[0] * D[0] + D[1] * D[1] + D[2] * D[2]);
+		}
+		Cluster.Radius = sqrtf(RadiusSq);
+
+		//Normal cone: axis is the average triangle normal, spread is the widest deviation from it
+		std::vector<float> Normals;
+		Normals.reserve(Cluster.TriangleCount * 3);
+		float Axis[3] = { 0.0f, 0.0f, 0.0f };
+
+		for (uint32_t t = 0; t < Cluster.TriangleCount; ++t)
+		{
+			const float* A = GetPosition(Positions, VertexStride, ClusterIndices[t * 3 + 0]);
+			const float* B = GetPosition(Positions, VertexStride, ClusterIndices[t * 3 + 1]);
+			const float* C = GetPosition(Positions, VertexStride, ClusterIndices[t * 3 + 2]);
+
+			float E1[3] = { B[0] - A[0], B[1] - A[1], B[2] - A[2] };
+			float E2[3] = { C[0] - A[0], C[1] - A[1], C[2] - A[2] };
+			float N[3] = { E1[1] * E2[2] - E1[2] * E2[1], E1[2] * E2[0] - E1[0] * E2[2], E1[0] * E2[1] - E1[1] * E2[0] };
+
+			float Length = sqrtf(N[0] * N[0] + N[1] * N[1] + N[2] * N[2]);
+
+			//Degenerate triangles don't constrain the cone
+			if (Length <= 1e-12f)
+			{
+				continue;
+			}
+
+			for (int i = 0; i < 3; ++i)
+			{
+				N[i] /= Length;
+				Axis[i] += N[i];
+				Normals.push_back(N[i]);
+			}
+		}
+
+		float AxisLength = sqrtf(Axis[0] * Axis[0] + Axis[1] * Axis[1] + Axis[2] * Axis[2]);
+		Cluster.ConeCutoff = 1.0f;
+		Cluster.ConeAxis[0] = 0.0f;
+		Cluster.ConeAxis[1] = 0.0f;
+		Cluster.ConeAxis[2] = 1.0f;
+
+		if (AxisLength <= 1e-6f || Normals.empty())
+		{
+			return;
+		}
+
+		for (int i = 0; i < 3; ++i)
+		{
+			Cluster.ConeAxis[i] = Axis[i] / AxisLength;
+		}
+
+		float MinDot = 1.0f;
+		for (size_t n = 0; n < Normals.size(); n += 3)
+		{
+			float Dot = Normals[n] * Cluster.ConeAxis[0] + Normals[n + 1] * Cluster.ConeAxis[1] + Normals[n + 2] * Cluster.ConeAxis[2];
+			MinDot = std::min(MinDot, Dot);
+		}
+
+		//Cone wider than a hemisphere can never be fully back-facing
+		if (MinDot > 0.0f)
+		{
+			Cluster.ConeCutoff = sqrtf(1.0f - MinDot * MinDot);
+		}
+	}
+
+	MeshletMesh BuildMeshlets(const float* Positions, const size_t VertexCount, const size_t VertexStride, const uint32_t* Indices, const size_t IndexCount)
+	{
+		MeshletMesh Result;
+		Result.Indices.reserve(IndexCount);
+
+		//Maps a vertex to its slot in the meshlet being built, -1 when not yet referenced
+		std::vector<int> LocalSlot(VertexCount, -1);
+		std::vector<uint32_t> ClusterVertices;
+		ClusterVertices.reserve(MaxMeshletVertices);
+
+		Meshlet Current;
+		Current.FirstIndex = 0;
+
+		auto Flush = [&]()
+		{
+			if (Current.TriangleCount == 0)
+			{
+				return;
+			}
+
+			Current.VertexCount = static_cast<uint32_t> (ClusterVertices.size());
+			ComputeMeshletBounds(Current, Positions, VertexStride, &Result.Indices[Current.FirstIndex], ClusterVertices);
+			Result.Meshlets.push_back(Current);
+
+			for (uint32_t Vertex : ClusterVertices)
+			{
+				LocalSlot[Vertex] = -1;
+			}
+			ClusterVertices.clear();
+
+			Current = Meshlet();
+			Current.FirstIndex = static_cast<uint32_t> (Result.Indices.size());
+		};
+
+		for (size_t i = 0; i + 2 < IndexCount; i += 3)
+		{
+			const uint32_t* Triangle = &Indices[i];
+
+			uint32_t NewVertices = 0;
+			for (int v = 0; v < 3; ++v)
+			{
+				//Also catches a vertex repeated within this triangle
+				bool bSeen = LocalSlot[Triangle[v]] >= 0 || (v > 0 && Triangle[v] == Triangle[0]) || (v > 1 && Triangle[v] == Triangle[1]);
+				NewVertices += bSeen ? 0 : 1;
+			}
+
+			if (ClusterVertices.size() + NewVertices > MaxMeshletVertices || Current.TriangleCount + 1 > MaxMeshletTriangles)
+			{
+				Flush();
+			}
+
+			for (int v = 0; v < 3; ++v)
+			{
+				if (LocalSlot[Triangle[v]] < 0)
+				{
+					LocalSlot[Triangle[v]] = static_cast<int> (ClusterVertices.size());
+					ClusterVertices.push_back(Triangle[v]);
+				}
+				Result.Indices.push_back(Triangle[v]);
+			}
+
+			++Current.TriangleCount;
+		}
+
+		Flush();
+
+		//SoA bounds, padded with spheres that always fail the frustum test
+		size_t PaddedCount = RoundToNextMultiple<size_t>(Result.Meshlets.size(), 4);
+		Result.CenterX.assign(PaddedCount, 0.0f);
+		Result.CenterY.assign(PaddedCount, 0.0f);
+		Result.CenterZ.assign(PaddedCount, 0.0f);
+		Result.Radius.assign(PaddedCount, -FLT_MAX);
+
+		for (size_t m = 0; m < Result.Meshlets.size(); ++m)
+		{
+			Result.CenterX[m] = Result.Meshlets[m].Center[0];
+			Result.CenterY[m] = Result.Meshlets[m].Center[1];
+			Result.CenterZ[m] = Result.Meshlets[m].Center[2];
+			Result.Radius[m] = Result.Meshlets[m].Radius;
+		}
+
+		std::cout << "Built " << Result.Meshlets.size() << " meshlets from " << IndexCount / 3 << " triangles" << std::endl;
+
+		return Result;
+	}
+
+	//Returns a 4 bit mask of which meshlets in [First, First + 4) have a sphere intersecting the frustum
+	static int FrustumTestSpheres4(const MeshletMesh& Mesh, const Frustum& ViewFrustum, const size_t First)
+	{
+#ifdef MESHLETS_SSE
+		__m128 X = _mm_loadu_ps(&Mesh.CenterX[First]);
+		__m128 Y = _mm_loadu_ps(&Mesh.CenterY[First]);
+		__m128 Z = _mm_loadu_ps(&Mesh.CenterZ[First]);
+		__m128 NegRadius = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(&Mesh.Radius[First]));
+
+		__m128 Inside = _mm_cmpeq_ps(X, X);
+		for (int p = 0; p < 6; ++p)
+		{
+			const float* Plane = ViewFrustum.Planes[p];
+			__m128 Distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, _mm_set1_ps(Plane[0])), _mm_mul_ps(Y, _mm_set1_ps(Plane[1]))),
+				_mm_add_ps(_mm_mul_ps(Z, _mm_set1_ps(Plane[2])), _mm_set1_ps(Plane[3])));
+			Inside = _mm_and_ps(Inside, _mm_cmpge_ps(Distance, NegRadius));
+		}
+
+		return _mm_movemask_ps(Inside);
+#else
+		int Mask = 0;
+		for (size_t Lane = 0; Lane < 4; ++Lane)
+		{
+			const size_t m = First + Lane;
+			bool bInside = true;
+			for (int p = 0; p < 6 && bInside; ++p)
+			{
+				const float* Plane = ViewFrustum.Planes[p];
+				float Distance = Mesh.CenterX[m] * Plane[0] + Mesh.CenterY[m] * Plane[1] + Mesh.CenterZ[m] * Plane[2] + Plane[3];
+				bInside = Distance >= -Mesh.Radius[m];
+			}
+			Mask |= bInside ? (1 << Lane) : 0;
+		}
+		return Mask;
+#endif
+	}
+
+	uint32_t CullMeshlets(const MeshletMesh& Mesh, const Frustum& ViewFrustum, const float CameraPosition[3], const uint32_t FirstIndex, const int32_t VertexOffset,
+		VkDrawIndexedIndirectCommand* OutCommands)
+	{
+		uint32_t DrawCount = 0;
+		const size_t PaddedCount = Mesh.CenterX.size();
+
+		for (size_t First = 0; First < PaddedCount; First += 4)
+		{
+			int Mask = FrustumTestSpheres4(Mesh, ViewFrustum, First);
+
+			for (size_t Lane = 0; Lane < 4; ++Lane)
+			{
+				//Padding lanes have a negative radius and never pass
+				if ((Mask & (1 << Lane)) == 0)
+				{
+					continue;
+				}
+
+				const Meshlet& Cluster = Mesh.Meshlets[First + Lane];
+
+				//Back-face cone test against the bounding sphere
+				float ToCenter[3] = { Cluster.Center[0] - CameraPosition[0], Cluster.Center[1] - CameraPosition[1], Cluster.Center[2] - CameraPosition[2] };
+				float Distance = sqrtf(ToCenter[0] * ToCenter[0] + ToCenter[1] * ToCenter[1] + ToCenter[2] * ToCenter[2]);
+				float AxisDot = ToCenter[0] * Cluster.ConeAxis[0] + ToCenter[1] * Cluster.ConeAxis[1] + ToCenter[2] * Cluster.ConeAxis[2];
+				if (AxisDot >= Cluster.ConeCutoff * Distance + Cluster.Radius)
+				{
+					continue;
+				}
+
+				VkDrawIndexedIndirectCommand& Command = OutCommands[DrawCount++];
+				Command.indexCount = Cluster.TriangleCount * 3;
+				Command.instanceCount = 1;
+				Command.firstIndex = FirstIndex + Cluster.FirstIndex;
+				Command.vertexOffset = VertexOffset;
+				Command.firstInstance = 0;
+			}
+		}
+
+		return DrawCount;
+	}
+
+	IndirectDrawBuffer CreateIndirectDrawBuffer(GraphicsDevice& GFXDevice, ResourceRegistry& Registry, const uint32_t MaxDraws)
+	{
+		IndirectDrawBuffer RetVal;
+		RetVal.MaxDraws = MaxDraws;
+
+		std::vector<MemoryTypeInfo> MemoryHeaps = EnumerateHeaps(GFXDevice.PhysicalDevice);
+
+		const int Size = static_cast<int> (sizeof(VkDrawIndexedIndirectCommand) * MaxDraws);
+		VkBuffer Buffer = AllocateBuffer(GFXDevice.Device, Size, VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT);
+
+		VkMemoryRequirements MemoryRequirements = {};
+		vkGetBufferMemoryRequirements(GFXDevice.Device, Buffer, &MemoryRequirements);
+		VkDeviceMemory DeviceMemory = AllocateMemory(GFXDevice.Device, MemoryHeaps, static_cast<int> (MemoryRequirements.size));
+
+		VkResult R = vkBindBufferMemory(GFXDevice.Device, Buffer, DeviceMemory, 0);
+		if (R != VK_SUCCESS)
+		{
+			std::cout << "Indirect buffer memory bind failed with error: " << R << std::endl;
+		}
+
+		//Left mapped for the lifetime of the buffer, the culling stage writes straight into it
+		void* Mapping = nullptr;
+		vkMapMemory(GFXDevice.Device, DeviceMemory, 0, VK_WHOLE_SIZE, 0, &Mapping);
+		RetVal.Commands = static_cast<VkDrawIndexedIndirectCommand*> (Mapping);
+		RetVal.Buffer = RegisterBuffer(Registry, Buffer, DeviceMemory, MemoryRequirements.size);
+
+		return RetVal;
+	}
+
+	void CmdDrawIndirect(GraphicsDevice& GFXDevice, VkCommandBuffer CommandBuffer, VkBuffer Buffer, const uint32_t DrawCount)
+	{
+		const uint32_t Stride = sizeof(VkDrawIndexedIndirectCommand);
+
+		if (GFXDevice.bSupportsMultiDrawIndirect)
+		{
+			vkCmdDrawIndexedIndirect(CommandBuffer, Buffer, 0, DrawCount, Stride);
+		}
+		else
+		{
+			for (uint32_t i = 0; i < DrawCount; ++i)
+			{
+				vkCmdDrawIndexedIndirect(CommandBuffer, Buffer, i * Stride, 1, Stride);
+			}
+		}
+	}
+
+	void DestroyIndirectDrawBuffer(ResourceRegistry& Registry, DeletionQueue& Deletions, IndirectDrawBuffer& IndirectBuffer)
+	{
+		ReleaseBuffer(Registry, Deletions, IndirectBuffer.Buffer);
+		IndirectBuffer = IndirectDrawBuffer();
+	}
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "vulkan\vulkan.h"
+#include "VectorMath.h"
+#include "ResourceHandles.h"
+#include <vector>
+
+namespace VulkanCore
+{
+	struct GraphicsDevice;
+	struct DeletionQueue;
+
+	//Cluster size limits (64 verts / 124 tris keeps a meshlet's index data within a mesh shader's output budget)
+	static const uint32_t MaxMeshletVertices = 64;
+	static const uint32_t MaxMeshletTriangles = 124;
+
+	//A small cluster of triangles that is culled as a single unit
+	struct Meshlet
+	{
+		//Range of this cluster within the reordered index buffer
+		uint32_t FirstIndex = 0;
+		uint32_t TriangleCount = 0;
+		uint32_t VertexCount = 0;
+
+		//Bounding sphere
+		float Center[3];
+		float Radius = 0.0f;
+
+		//Normal cone: cluster is back-facing when viewed from inside the cone's negative space
+		//ConeCutoff is sin(cone half-angle), 1.0 means the cone is too wide to ever cull
+		float ConeAxis[3];
+		float ConeCutoff = 1.0f;
+	};
+
+	struct MeshletMesh
+	{
+		std::vector<Meshlet> Meshlets;
+
+		//Source indices reordered so every meshlet is a contiguous range
+		std::vector<uint32_t> Indices;
+
+		//SoA copy of the bounds for SIMD culling, padded to a multiple of 4
+		std::vector<float> CenterX;
+		std::vector<float> CenterY;
+		std::vector<float> CenterZ;
+		std::vector<float> Radius;
+	};
+
+	//Splits an index buffer into meshlets of at most MaxMeshletVertices / MaxMeshletTriangles and computes their bounds
+	MeshletMesh BuildMeshlets(const float* Positions, const size_t VertexCount, const size_t VertexStride, const uint32_t* Indices, const size_t IndexCount);
+
+	//Rejects off-frustum and back-facing meshlets, writes one indirect command per surviving meshlet and returns the count
+	//FirstIndex and VertexOffset place the mesh inside a shared geometry buffer (see GeometryAllocation)
+	uint32_t CullMeshlets(const MeshletMesh& Mesh, const Frustum& ViewFrustum, const float CameraPosition[3], const uint32_t FirstIndex, const int32_t VertexOffset,
+		VkDrawIndexedIndirectCommand* OutCommands);
+
+	//Persistently mapped buffer of indirect draw commands written by the CPU culling stage
+	//The buffer is owned by a ResourceRegistry
+	struct IndirectDrawBuffer
+	{
+		BufferHandle Buffer;
+		VkDrawIndexedIndirectCommand* Commands = nullptr;
+		uint32_t MaxDraws = 0;
+	};
+
+	//Creates a host visible indirect buffer large enough for MaxDraws commands
+	IndirectDrawBuffer CreateIndirectDrawBuffer(GraphicsDevice& GFXDevice, ResourceRegistry& Registry, const uint32_t MaxDraws);
+
+	//Records DrawCount indirect draws (single multi-draw when supported, one call per draw otherwise)
+	//Buffer is the indirect buffer's VkBuffer, looked up through its handle
+	void CmdDrawIndirect(GraphicsDevice& GFXDevice, VkCommandBuffer CommandBuffer, VkBuffer Buffer, const uint32_t DrawCount);
+
+	//Releases the buffer to Deletions, its memory is unmapped when it's freed
+	void DestroyIndirectDrawBuffer(ResourceRegistry& Registry, DeletionQueue& Deletions, IndirectDrawBuffer& IndirectBuffer);
+}
@@ -0,0 +1,243 @@
+#include "Particles.h"
+#include "SpirvReflection.h"
+#include "BasicShaders.h"
+#include "VulkanTextures.h"
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+
+namespace VulkanCore
+{
+	namespace
+	{
+		void CreateParticleBuffer(GraphicsDevice& GFXDevice, std::vector<MemoryTypeInfo>& MemoryHeaps, const VkDeviceSize Size, const VkBufferUsageFlagBits Usage,
+			const bool bDeviceLocal, VkBuffer& OutBuffer, VkDeviceMemory& OutMemory)
+		{
+			OutBuffer = AllocateBuffer(GFXDevice.Device, static_cast<int> (Size), Usage);
+
+			VkMemoryRequirements MemoryRequirements = {};
+			vkGetBufferMemoryRequirements(GFXDevice.Device, OutBuffer, &MemoryRequirements);
+			OutMemory = AllocateMemory(GFXDevice.Device, MemoryHeaps, MemoryRequirements, bDeviceLocal);
+
+			VkResult R = vkBindBufferMemory(GFXDevice.Device, OutBuffer, OutMemory, 0);
+			if (R != VK_SUCCESS)
+			{
+				std::cout << "Particle buffer memory bind failed with error: " << R << std::endl;
+			}
+		}
+	}
+
+	ParticleSystem CreateParticleSystem(GraphicsDevice& GFXDevice, DescriptorLayoutCache& LayoutCache, ShaderModuleCache& Shaders, AsyncComputeQueue& Compute,
+		const uint32_t Count, const uint32_t SnapshotCount, const uint32_t FrameCount)
+	{
+		ParticleSystem RetVal;
+		RetVal.Count = Count;
+		RetVal.SnapshotCount = std::min(SnapshotCount, Count);
+		RetVal.SnapshotWritten.resize(FrameCount, false);
+
+		const VkDeviceSize BufferSize = Count * sizeof(Particle);
+		const VkDeviceSize SnapshotSize = RetVal.SnapshotCount * sizeof(Particle) * FrameCount;
+		std::vector<MemoryTypeInfo> MemoryHeaps = EnumerateHeaps(GFXDevice.PhysicalDevice);
+		CreateParticleBuffer(GFXDevice, MemoryHeaps, BufferSize,
+			static_cast<VkBufferUsageFlagBits> (VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT),
+			true, RetVal.Buffer, RetVal.DeviceMemory);
+		CreateParticleBuffer(GFXDevice, MemoryHeaps, SnapshotSize,
+			static_cast<VkBufferUsageFlagBits> (VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT), true, RetVal.SnapshotBuffer, RetVal.SnapshotMemory);
+		CreateParticleBuffer(GFXDevice, MemoryHeaps, SnapshotSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT, false, RetVal.ReadbackBuffer, RetVal.ReadbackMemory);
+
+		void* Mapping = nullptr;
+		vkMapMemory(GFXDevice.Device, RetVal.ReadbackMemory, 0, VK_WHOLE_SIZE, 0, &Mapping);
+		RetVal.ReadbackMapped = static_cast<const Particle*> (Mapping);
+
+		std::vector<Particle> Initial(Count);
+		const uint32_t Side = static_cast<uint32_t> (std::ceil(std::sqrt(static_cast<float> (Count))));
+		for (uint32_t i = 0; i < Count; ++i)
+		{
+			Particle& P = Initial[i];
+			P.Position[0] = static_cast<float> (i % Side) - Side * 0.5f;
+			P.Position[1] = 1.0f + static_cast<float> (i % 7);
+			P.Position[2] = static_cast<float> (i / Side) - Side * 0.5f;
+			P.Position[3] = 1.0f;
+			P.Velocity[0] = 0.0f;
+			P.Velocity[1] = static_cast<float> (i % 5);
+			P.Velocity[2] = 0.0f;
+			P.Velocity[3] = 0.0f;
+		}
+
+		//Uploaded from the compute queue itself, which owns the buffer from then on, so no ownership transfer is needed
+		StagingBuffer Staging = CreateStagingBuffer(GFXDevice, Initial.data(), BufferSize);
+		VkCommandBuffer UploadCommandBuffer = AllocateCommandBuffers(GFXDevice, Compute.CommandPool, 1)[0];
+
+		VkCommandBufferBeginInfo BeginInfo = {};
+		BeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+		BeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+		vkBeginCommandBuffer(UploadCommandBuffer, &BeginInfo);
+
+		VkBufferCopy Region = {};
+		Region.size = BufferSize;
+		vkCmdCopyBuffer(UploadCommandBuffer, Staging.Buffer, RetVal.Buffer, 1, &Region);
+
+		//The first step's own barrier only covers shader writes, the copy is made visible to it here
+		VkBufferMemoryBarrier Barrier = {};
+		Barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+		Barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		Barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+		Barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		Barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		Barrier.buffer = RetVal.Buffer;
+		Barrier.size = VK_WHOLE_SIZE;
+		vkCmdPipelineBarrier(UploadCommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr, 1, &Barrier, 0, nullptr);
+		vkEndCommandBuffer(UploadCommandBuffer);
+
+		//Setup time, so simply wait before the staging buffer goes
+		TimelineSubmitInfo UploadSubmitInfo;
+		UploadSubmitInfo.CommandBuffers.push_back(UploadCommandBuffer);
+		WaitForTimeline(GFXDevice, Compute.Timeline, SubmitToTimeline(GFXDevice, Compute.Timeline, UploadSubmitInfo));
+		vkFreeCommandBuffers(GFXDevice.Device, Compute.CommandPool, 1, &UploadCommandBuffer);
+		DestroyStagingBuffer(GFXDevice, Staging);
+
+		//Set 0 (the particle storage buffer) and the push block { float DeltaTime; uint Count; } as the shader declares them
+		RetVal.Shader = LoadShaderFile(GFXDevice, Shaders, "Shaders/Particles.comp.spv", ParticleComputeShader, sizeof(ParticleComputeShader));
+		const CachedShaderModule* Code = FindCachedShader(Shaders, RetVal.Shader);
+		const ShaderReflection Reflection = ReflectSpirv(Code->Code, Code->WordCount);
+		PipelineLayoutDesc LayoutDesc = BuildReflectedLayout(GFXDevice, LayoutCache, { &Reflection });
+		RetVal.Layout = LayoutDesc.SetLayouts[0];
+
+		std::vector<VkDescriptorPoolSize> PoolSizes(1);
+		PoolSizes[0].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		PoolSizes[0].descriptorCount = 1;
+		RetVal.Pool = CreateDescriptorPool(GFXDevice, PoolSizes, 1);
+		RetVal.Set = AllocateDescriptorSet(GFXDevice, RetVal.Pool, RetVal.Layout);
+
+		DescriptorWriter Writer;
+		WriteBuffer(Writer, RetVal.Set, 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, RetVal.Buffer, 0, VK_WHOLE_SIZE);
+		FlushDescriptorWrites(GFXDevice, Writer);
+
+		RetVal.Pipeline = CreateComputePipeline(GFXDevice, RetVal.Shader, GetPipelineLayout(GFXDevice, LayoutCache, LayoutDesc));
+
+		return RetVal;
+	}
+
+	void CmdSimulateParticles(VkCommandBuffer CommandBuffer, const ParticleSystem& Particles, const float DeltaTime)
+	{
+		//Submissions on one queue aren't ordered for memory, wait for the previous step's writes
+		VkBufferMemoryBarrier Barrier = {};
+		Barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+		Barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+		Barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+		Barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		Barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		Barrier.buffer = Particles.Buffer;
+		Barrier.size = VK_WHOLE_SIZE;
+		vkCmdPipelineBarrier(CommandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr, 1, &Barrier, 0, nullptr);
+
+		struct
+		{
+			float DeltaTime;
+			uint32_t Count;
+		} Constants = { DeltaTime, Particles.Count };
+
+		vkCmdBindPipeline(CommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, Particles.Pipeline.Pipeline);
+		vkCmdBindDescriptorSets(CommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, Particles.Pipeline.Layout, 0, 1, &Particles.Set, 0, nullptr);
+		vkCmdPushConstants(CommandBuffer, Particles.Pipeline.Layout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(Constants), &Constants);
+		vkCmdDispatch(CommandBuffer, (Particles.Count + ParticleGroupSize - 1) / ParticleGroupSize, 1, 1);
+	}
+
+	void CmdHandOffParticleSnapshot(AsyncComputeQueue& Compute, const ParticleSystem& Particles)
+	{
+		VkCommandBuffer CommandBuffer = Compute.CommandBuffers[Compute.CurrentFrame];
+		const VkDeviceSize SliceSize = Particles.SnapshotCount * sizeof(Particle);
+		const VkDeviceSize SliceOffset = Compute.CurrentFrame * SliceSize;
+
+		//The step's writes have to land before the copy reads them
+		VkBufferMemoryBarrier Barrier = {};
+		Barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+		Barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+		Barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+		Barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		Barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		Barrier.buffer = Particles.Buffer;
+		Barrier.size = SliceSize;
+		vkCmdPipelineBarrier(CommandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 1, &Barrier, 0, nullptr);
+
+		//The slice was last read by this frame slot's graphics submission, which completed before the slot was reused
+		VkBufferCopy Region = {};
+		Region.dstOffset = SliceOffset;
+		Region.size = SliceSize;
+		vkCmdCopyBuffer(CommandBuffer, Particles.Buffer, Particles.SnapshotBuffer, 1, &Region);
+
+		CmdHandOffBufferToGraphics(Compute, Particles.SnapshotBuffer, SliceOffset, SliceSize, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+			VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+	}
+
+	void CmdReadBackParticleSnapshot(VkCommandBuffer GraphicsCommandBuffer, ParticleSystem& Particles, const uint32_t FrameIndex)
+	{
+		const VkDeviceSize SliceSize = Particles.SnapshotCount * sizeof(Particle);
+
+		VkBufferCopy Region = {};
+		Region.srcOffset = FrameIndex * SliceSize;
+		Region.dstOffset = FrameIndex * SliceSize;
+		Region.size = SliceSize;
+		vkCmdCopyBuffer(GraphicsCommandBuffer, Particles.SnapshotBuffer, Particles.ReadbackBuffer, 1, &Region);
+
+		//Made visible to the host, which reads it once the frame's timeline value has completed
+		VkBufferMemoryBarrier Barrier = {};
+		Barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+		Barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		Barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+		Barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		Barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		Barrier.buffer = Particles.ReadbackBuffer;
+		Barrier.offset = Region.dstOffset;
+		Barrier.size = SliceSize;
+		vkCmdPipelineBarrier(GraphicsCommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr, 1, &Barrier, 0, nullptr);
+
+		Particles.SnapshotWritten[FrameIndex] = true;
+	}
+
+	bool ReadParticleSnapshot(GraphicsDevice& GFXDevice, const ParticleSystem& Particles, const uint32_t FrameIndex, ParticleStats& OutStats)
+	{
+		if (Particles.ReadbackMapped == nullptr || !Particles.SnapshotWritten[FrameIndex])
+		{
+			return false;
+		}
+
+		//Readback memory may not be host coherent
+		VkMappedMemoryRange Range = {};
+		Range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+		Range.memory = Particles.ReadbackMemory;
+		Range.size = VK_WHOLE_SIZE;
+		vkInvalidateMappedMemoryRanges(GFXDevice.Device, 1, &Range);
+
+		OutStats = ParticleStats();
+		OutStats.Sampled = Particles.SnapshotCount;
+		const Particle* Snapshot = Particles.ReadbackMapped + FrameIndex * Particles.SnapshotCount;
+		float HeightSum = 0.0f;
+		for (uint32_t i = 0; i < Particles.SnapshotCount; ++i)
+		{
+			const float Height = Snapshot[i].Position[1];
+			HeightSum += Height;
+			OutStats.MaxHeight = std::max(OutStats.MaxHeight, Height);
+			if (Height < 0.01f && std::fabs(Snapshot[i].Velocity[1]) < 0.1f)
+			{
+				++OutStats.Resting;
+			}
+		}
+		OutStats.AverageHeight = Particles.SnapshotCount > 0 ? HeightSum / Particles.SnapshotCount : 0.0f;
+		return true;
+	}
+
+	void DestroyParticleSystem(GraphicsDevice& GFXDevice, ParticleSystem& Particles)
+	{
+		vkDestroyPipeline(GFXDevice.Device, Particles.Pipeline.Pipeline, nullptr);
+		vkDestroyDescriptorPool(GFXDevice.Device, Particles.Pool, nullptr);
+		vkDestroyBuffer(GFXDevice.Device, Particles.Buffer, nullptr);
+		vkFreeMemory(GFXDevice.Device, Particles.DeviceMemory, nullptr);
+		vkDestroyBuffer(GFXDevice.Device, Particles.SnapshotBuffer, nullptr);
+		vkFreeMemory(GFXDevice.Device, Particles.SnapshotMemory, nullptr);
+		vkUnmapMemory(GFXDevice.Device, Particles.ReadbackMemory);
+		vkDestroyBuffer(GFXDevice.Device, Particles.ReadbackBuffer, nullptr);
+		vkFreeMemory(GFXDevice.Device, Particles.ReadbackMemory, nullptr);
+		Particles = ParticleSystem();
+	}
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "vulkan\vulkan.h"
+#include "Descriptors.h"
+#include "VulkanInitializers.h"
+#include "ShaderCache.h"
+#include "AsyncCompute.h"
+#include <vector>
+
+namespace VulkanCore
+{
+	//Matches the Particle struct in ParticleComputeShader (std430, 32 bytes)
+	struct Particle
+	{
+		float Position[4];
+		float Velocity[4];
+	};
+
+	//What the graphics queue read back of the sampled particles
+	struct ParticleStats
+	{
+		uint32_t Sampled = 0;
+		uint32_t Resting = 0;
+		float AverageHeight = 0.0f;
+		float MaxHeight = 0.0f;
+	};
+
+	//Particles falling under gravity and bouncing off y = 0, simulated in place by a compute shader on the async compute queue
+	//After each step the first SnapshotCount particles are copied into that frame's snapshot slice and handed to the graphics queue,
+	//which copies them on into host memory, so the simulation never waits for a reader of the live buffer
+	struct ParticleSystem
+	{
+		//Device local, only ever touched by the compute queue so it never changes queue family
+		VkBuffer Buffer = VK_NULL_HANDLE;
+		VkDeviceMemory DeviceMemory = VK_NULL_HANDLE;
+		uint32_t Count = 0;
+
+		//One slice of SnapshotCount particles per frame in flight: device local ones the compute queue writes, host visible ones graphics copies them into
+		VkBuffer SnapshotBuffer = VK_NULL_HANDLE;
+		VkDeviceMemory SnapshotMemory = VK_NULL_HANDLE;
+		VkBuffer ReadbackBuffer = VK_NULL_HANDLE;
+		VkDeviceMemory ReadbackMemory = VK_NULL_HANDLE;
+		const Particle* ReadbackMapped = nullptr;
+		uint32_t SnapshotCount = 0;
+
+		//Per frame slot, true once its readback has been recorded at least once
+		std::vector<bool> SnapshotWritten;
+
+		PipelineData Pipeline;
+
+		//Owned by the shader cache
+		VkShaderModule Shader = VK_NULL_HANDLE;
+
+		//Layout is owned by the layout cache it came from
+		VkDescriptorSetLayout Layout = VK_NULL_HANDLE;
+		VkDescriptorPool Pool = VK_NULL_HANDLE;
+		VkDescriptorSet Set = VK_NULL_HANDLE;
+	};
+
+	//Local size of ParticleComputeShader
+	static const uint32_t ParticleGroupSize = 64;
+
+	//Uploads Count particles spread over a grid above the floor through the compute queue and waits for it, the compute shader module comes from (and stays owned by) Shaders
+	//SnapshotCount of them are sampled every frame, FrameCount is the number of frames in flight
+	ParticleSystem CreateParticleSystem(GraphicsDevice& GFXDevice, DescriptorLayoutCache& LayoutCache, ShaderModuleCache& Shaders, AsyncComputeQueue& Compute,
+		const uint32_t Count, const uint32_t SnapshotCount, const uint32_t FrameCount);
+
+	//Records one simulation step, ordered after the previous step recorded into the same queue
+	void CmdSimulateParticles(VkCommandBuffer CommandBuffer, const ParticleSystem& Particles, const float DeltaTime);
+
+	//Copies the sampled particles into the current compute frame's snapshot slice and hands it to the graphics queue, record after CmdSimulateParticles
+	void CmdHandOffParticleSnapshot(AsyncComputeQueue& Compute, const ParticleSystem& Particles);
+
+	//Copies FrameIndex's snapshot into host memory, recorded on the graphics queue after CmdAcquireAsyncCompute and outside a render pass
+	void CmdReadBackParticleSnapshot(VkCommandBuffer GraphicsCommandBuffer, ParticleSystem& Particles, const uint32_t FrameIndex);
+
+	//Summarizes FrameIndex's readback, whose graphics submission must have completed, false when it was never written
+	bool ReadParticleSnapshot(GraphicsDevice& GFXDevice, const ParticleSystem& Particles, const uint32_t FrameIndex, ParticleStats& OutStats);
+
+	//Device must be idle
+	void DestroyParticleSystem(GraphicsDevice& GFXDevice, ParticleSystem& Particles);
+}
@@ -0,0 +1,217 @@
+#include "PipelineCache.h"
+#include "SpirvReflection.h"
+#include "Descriptors.h"
+#include "DeletionQueue.h"
+#include "JobSystem.h"
+#include <iostream>
+#include <functional>
+#include <algorithm>
+
+namespace VulkanCore
+{
+	namespace
+	{
+		bool SameLayout(const PipelineLayoutDesc& A, const PipelineLayoutDesc& B)
+		{
+			auto SameRange = [](const VkPushConstantRange& X, const VkPushConstantRange& Y)
+			{
+				return X.stageFlags == Y.stageFlags && X.offset == Y.offset && X.size == Y.size;
+			};
+			return A.SetLayouts == B.SetLayouts && A.PushConstantRanges.size() == B.PushConstantRanges.size() &&
+				std::equal(A.PushConstantRanges.begin(), A.PushConstantRanges.end(), B.PushConstantRanges.begin(), SameRange);
+		}
+
+		bool SameVertexInput(const VertexInputLayout& A, const VertexInputLayout& B)
+		{
+			auto SameBinding = [](const VkVertexInputBindingDescription& X, const VkVertexInputBindingDescription& Y)
+			{
+				return X.binding == Y.binding && X.stride == Y.stride && X.inputRate == Y.inputRate;
+			};
+			auto SameAttribute = [](const VkVertexInputAttributeDescription& X, const VkVertexInputAttributeDescription& Y)
+			{
+				return X.location == Y.location && X.binding == Y.binding && X.format == Y.format && X.offset == Y.offset;
+			};
+			return A.Bindings.size() == B.Bindings.size() && std::equal(A.Bindings.begin(), A.Bindings.end(), B.Bindings.begin(), SameBinding) &&
+				A.Attributes.size() == B.Attributes.size() && std::equal(A.Attributes.begin(), A.Attributes.end(), B.Attributes.begin(), SameAttribute);
+		}
+
+		GraphicsPipelineKey NormalizeKey(const GraphicsPipelineKey& Key)
+		{
+			GraphicsPipelineKey RetVal = Key;
+			RetVal.Features &= Key.DeclaredFeatures;
+			return RetVal;
+		}
+
+		//Safe to call from any thread, the device and the driver cache synchronize internally
+		PipelineData CompilePermutation(GraphicsDevice& GFXDevice, VkPipelineCache DriverCache, VkPipelineLayout Layout, const GraphicsPipelineKey& Key)
+		{
+			VkRenderPass RenderPass = Key.RenderPass;
+			VkShaderModule VertexShader = Key.VertexShader;
+			VkShaderModule FragmentShader = Key.FragmentShader;
+			VkExtent2D Extent = Key.Extent;
+
+			ShaderSpecialization Specialization;
+			BuildShaderSpecialization(Key.Features, Specialization);
+			return CreatePipeline(GFXDevice, RenderPass, VertexShader, FragmentShader, Extent, Layout, Key.VertexInput, &Specialization.Info, DriverCache, Key.bDepthTest);
+		}
+	}
+
+	void BuildShaderSpecialization(const ShaderFeatures Features, ShaderSpecialization& Out)
+	{
+		for (uint32_t i = 0; i < MaxShaderFeatures; ++i)
+		{
+			Out.Entries[i].constantID = i;
+			Out.Entries[i].offset = i * sizeof(VkBool32);
+			Out.Entries[i].size = sizeof(VkBool32);
+			Out.Values[i] = (Features >> i) & 1 ? VK_TRUE : VK_FALSE;
+		}
+		Out.Info.mapEntryCount = MaxShaderFeatures;
+		Out.Info.pMapEntries = Out.Entries;
+		Out.Info.dataSize = sizeof(Out.Values);
+		Out.Info.pData = Out.Values;
+	}
+
+	ShaderFeatures GetDeclaredFeatures(const ShaderReflection& Reflection)
+	{
+		ShaderFeatures RetVal = 0;
+		for (uint32_t Id : Reflection.SpecConstantIds)
+		{
+			if (Id < MaxShaderFeatures)
+			{
+				RetVal |= 1u << Id;
+			}
+		}
+		return RetVal;
+	}
+
+	bool GraphicsPipelineKey::operator==(const GraphicsPipelineKey& Other) const
+	{
+		return RenderPass == Other.RenderPass && VertexShader == Other.VertexShader && FragmentShader == Other.FragmentShader &&
+			Extent.width == Other.Extent.width && Extent.height == Other.Extent.height && Features == Other.Features && bDepthTest == Other.bDepthTest &&
+			SameLayout(Layout, Other.Layout) && SameVertexInput(VertexInput, Other.VertexInput);
+	}
+
+	size_t GraphicsPipelineKeyHash::operator()(const GraphicsPipelineKey& Key) const
+	{
+		//Permutations of one pipeline differ in Features alone, the handles and it spread them well enough
+		size_t Hash = std::hash<uint32_t>()(Key.Features);
+		auto Combine = [&Hash](size_t Value) { Hash ^= Value + 0x9e3779b9 + (Hash << 6) + (Hash >> 2); };
+
+		Combine(std::hash<const void*>()(Key.RenderPass));
+		Combine(std::hash<const void*>()(Key.VertexShader));
+		Combine(std::hash<const void*>()(Key.FragmentShader));
+		Combine(std::hash<uint32_t>()(Key.Extent.width));
+		Combine(std::hash<uint32_t>()(Key.Extent.height));
+		for (VkDescriptorSetLayout SetLayout : Key.Layout.SetLayouts)
+		{
+			Combine(std::hash<const void*>()(SetLayout));
+		}
+		return Hash;
+	}
+
+	PipelineCache CreatePipelineCache(GraphicsDevice& GFXDevice, DescriptorLayoutCache& Layouts)
+	{
+		PipelineCache RetVal;
+		RetVal.Layouts = &Layouts;
+
+		VkPipelineCacheCreateInfo PipelineCacheCreateInfo = {};
+		PipelineCacheCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+		VkResult R = vkCreatePipelineCache(GFXDevice.Device, &PipelineCacheCreateInfo, nullptr, &RetVal.DriverCache);
+		if (R != VK_SUCCESS)
+		{
+			//Pipelines still compile without one, just without sharing work
+			std::cout << "Pipeline cache creation failed with error: " << R << std::endl;
+			RetVal.DriverCache = VK_NULL_HANDLE;
+		}
+		return RetVal;
+	}
+
+	PipelineHandle GetGraphicsPipeline(GraphicsDevice& GFXDevice, PipelineCache& Cache, ResourceRegistry& Registry, const GraphicsPipelineKey& Key,
+		uint32_t* OutIndex)
+	{
+		//Looked up every frame, the key is only copied when it has bits to drop
+		if (Key.Features & ~Key.DeclaredFeatures)
+		{
+			return GetGraphicsPipeline(GFXDevice, Cache, Registry, NormalizeKey(Key), OutIndex);
+		}
+
+		auto Found = Cache.Pipelines.find(Key);
+		if (Found != Cache.Pipelines.end())
+		{
+			++Cache.CacheHits;
+			if (OutIndex)
+			{
+				*OutIndex = Found->second.Index;
+			}
+			return Found->second.Handle;
+		}
+
+		VkPipelineLayout Layout = GetPipelineLayout(GFXDevice, *Cache.Layouts, Key.Layout);
+		CachedPipeline& Entry = Cache.Pipelines[Key];
+		Entry.Handle = RegisterPipeline(Registry, CompilePermutation(GFXDevice, Cache.DriverCache, Layout, Key));
+		Entry.Index = Cache.PipelinesCreated++;
+		if (OutIndex)
+		{
+			*OutIndex = Entry.Index;
+		}
+		return Entry.Handle;
+	}
+
+	void PrecompilePipelines(GraphicsDevice& GFXDevice, PipelineCache& Cache, ResourceRegistry& Registry, JobSystem& Jobs, const std::vector<GraphicsPipelineKey>& Keys)
+	{
+		std::vector<GraphicsPipelineKey> Pending;
+		for (const GraphicsPipelineKey& Key : Keys)
+		{
+			const GraphicsPipelineKey Normalized = NormalizeKey(Key);
+			if (Cache.Pipelines.find(Normalized) == Cache.Pipelines.end() && std::find(Pending.begin(), Pending.end(), Normalized) == Pending.end())
+			{
+				Pending.push_back(Normalized);
+			}
+		}
+		if (Pending.empty())
+		{
+			return;
+		}
+
+		//Neither the layout cache nor the registry is thread safe, so layouts are looked up before and results registered after the jobs
+		std::vector<VkPipelineLayout> Layouts(Pending.size());
+		for (size_t i = 0; i < Pending.size(); ++i)
+		{
+			Layouts[i] = GetPipelineLayout(GFXDevice, *Cache.Layouts, Pending[i].Layout);
+		}
+
+		//One job per permutation, compiles are long enough that batching buys nothing
+		std::vector<PipelineData> Compiled(Pending.size());
+		VkPipelineCache DriverCache = Cache.DriverCache;
+		JobCounter Done;
+		ParallelFor(Jobs, static_cast<uint32_t> (Pending.size()), 1, [&GFXDevice, &Pending, &Layouts, &Compiled, DriverCache](uint32_t First, uint32_t Last)
+		{
+			for (uint32_t i = First; i < Last; ++i)
+			{
+				Compiled[i] = CompilePermutation(GFXDevice, DriverCache, Layouts[i], Pending[i]);
+			}
+		}, Done);
+		WaitForCounter(Jobs, Done);
+
+		for (size_t i = 0; i < Pending.size(); ++i)
+		{
+			CachedPipeline& Entry = Cache.Pipelines[Pending[i]];
+			Entry.Handle = RegisterPipeline(Registry, Compiled[i]);
+			Entry.Index = Cache.PipelinesCreated++;
+		}
+		Cache.PipelinesPrecompiled += static_cast<uint32_t> (Pending.size());
+	}
+
+	void DestroyPipelineCache(GraphicsDevice& GFXDevice, PipelineCache& Cache, ResourceRegistry& Registry, DeletionQueue& Deletions)
+	{
+		for (auto& Entry : Cache.Pipelines)
+		{
+			ReleasePipeline(Registry, Deletions, Entry.second.Handle);
+		}
+
+		//Pipelines don't depend on the cache they were created with, it can go right away
+		//Their layouts stay with the DescriptorLayoutCache
+		vkDestroyPipelineCache(GFXDevice.Device, Cache.DriverCache, nullptr);
+		Cache = PipelineCache();
+	}
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "vulkan\vulkan.h"
+#include "VulkanInitializers.h"
+#include "ResourceRegistry.h"
+#include <vector>
+#include <unordered_map>
+
+namespace VulkanCore
+{
+	struct JobSystem;
+	struct DeletionQueue;
+	struct ShaderReflection;
+	struct DescriptorLayoutCache;
+
+	//Optional parts of a shader, bit i is the VkBool32 specialization constant with constant_id i
+	//One SPIR-V module covers every combination, a permutation is a pipeline specialized for one set of bits
+	enum ShaderFeatureBits : uint32_t
+	{
+		//Sample the material texture, show the vertex UVs as a color otherwise
+		ShaderFeatureTextured = 1 << 0,
+	};
+	typedef uint32_t ShaderFeatures;
+
+	//constant_ids 0 to MaxShaderFeatures - 1 are feature bits, shaders are free to use higher ones for anything else
+	static const uint32_t MaxShaderFeatures = 8;
+
+	//Info points into the struct itself, fill it with BuildShaderSpecialization where it will be used and don't copy it
+	struct ShaderSpecialization
+	{
+		VkSpecializationMapEntry Entries[MaxShaderFeatures];
+		VkBool32 Values[MaxShaderFeatures];
+		VkSpecializationInfo Info;
+	};
+
+	//Maps every feature bit to its constant_id, constants a shader doesn't declare are ignored by the driver
+	void BuildShaderSpecialization(const ShaderFeatures Features, ShaderSpecialization& Out);
+
+	//Feature bits a shader declares a specialization constant for
+	ShaderFeatures GetDeclaredFeatures(const ShaderReflection& Reflection);
+
+	//Everything a graphics pipeline is built from
+	//Features is masked with DeclaredFeatures before lookup, so requests differing only in bits neither shader reads share one pipeline
+	struct GraphicsPipelineKey
+	{
+		VkRenderPass RenderPass = VK_NULL_HANDLE;
+		VkShaderModule VertexShader = VK_NULL_HANDLE;
+		VkShaderModule FragmentShader = VK_NULL_HANDLE;
+		VkExtent2D Extent = {};
+		PipelineLayoutDesc Layout;
+		VertexInputLayout VertexInput;
+		ShaderFeatures Features = 0;
+
+		//Depth test and write against the render pass's depth attachment
+		bool bDepthTest = false;
+
+		//GetDeclaredFeatures of both shaders, all bits (nothing shared) when unknown
+		ShaderFeatures DeclaredFeatures = ~0u;
+
+		bool operator==(const GraphicsPipelineKey& Other) const;
+	};
+
+	struct GraphicsPipelineKeyHash
+	{
+		size_t operator()(const GraphicsPipelineKey& Key) const;
+	};
+
+	//A compiled permutation and its index, assigned in creation order and stable for the cache's lifetime (draw sort keys group by it)
+	struct CachedPipeline
+	{
+		PipelineHandle Handle;
+		uint32_t Index = 0;
+	};
+
+	//Graphics pipelines by key, each permutation compiled once and owned by a ResourceRegistry
+	//Not thread safe, only PrecompilePipelines fans the compilation itself out to worker threads
+	struct PipelineCache
+	{
+		//Passed to every vkCreateGraphicsPipelines, permutations of one shader pair reuse what the driver already compiled
+		VkPipelineCache DriverCache = VK_NULL_HANDLE;
+
+		//Hands out the pipeline layouts, so permutations with the same Key.Layout share one
+		DescriptorLayoutCache* Layouts = nullptr;
+
+		std::unordered_map<GraphicsPipelineKey, CachedPipeline, GraphicsPipelineKeyHash> Pipelines;
+
+		uint32_t PipelinesCreated = 0;
+		uint32_t PipelinesPrecompiled = 0;
+		uint32_t CacheHits = 0;
+	};
+
+	//Layouts must outlive the cache and every pipeline it creates
+	PipelineCache CreatePipelineCache(GraphicsDevice& GFXDevice, DescriptorLayoutCache& Layouts);
+
+	//Returns the pipeline for Key, compiling it on the calling thread the first time (a hitch mid-frame, precompile the hot set instead)
+	//OutIndex, when given, receives the permutation's CachedPipeline::Index
+	PipelineHandle GetGraphicsPipeline(GraphicsDevice& GFXDevice, PipelineCache& Cache, ResourceRegistry& Registry, const GraphicsPipelineKey& Key,
+		uint32_t* OutIndex = nullptr);
+
+	//Compiles every key that isn't cached yet in parallel on Jobs and returns once all are registered, duplicates are compiled once
+	void PrecompilePipelines(GraphicsDevice& GFXDevice, PipelineCache& Cache, ResourceRegistry& Registry, JobSystem& Jobs, const std::vector<GraphicsPipelineKey>& Keys);
+
+	//Releases every cached pipeline to Deletions and destroys the driver cache
+	void DestroyPipelineCache(GraphicsDevice& GFXDevice, PipelineCache& Cache, ResourceRegistry& Registry, DeletionQueue& Deletions);
+}
@@ -0,0 +1,828 @@
+#include "RenderGraph.h"
+#include "VulkanInitializers.h"
+#include <iostream>
+#include <algorithm>
+
+namespace VulkanCore
+{
+	namespace
+	{
+		const VkAccessFlags WriteAccessMask = VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT |
+			VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_HOST_WRITE_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+
+		//Where a resource stands while the compiler walks the passes in execution order
+		struct ResourceState
+		{
+			VkImageLayout Layout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+			//Last write, and every read since then (what the next write has to wait for)
+			VkPipelineStageFlags WriteStages = 0;
+			VkAccessFlags WriteAccess = 0;
+			VkPipelineStageFlags ReadStages = 0;
+
+			//Stages and accesses the last write has already been made visible to
+			VkPipelineStageFlags SyncedStages = 0;
+			VkAccessFlags SyncedAccess = 0;
+		};
+
+		//Everything placed in one allocation, TypeBits narrows to what all of them accept
+		struct AliasHeap
+		{
+			uint32_t TypeBits = 0;
+			VkDeviceSize Size = 0;
+			VkDeviceSize Alignment = 1;
+		};
+
+		bool IsDepthFormat(const VkFormat Format)
+		{
+			return Format == VK_FORMAT_D16_UNORM || Format == VK_FORMAT_X8_D24_UNORM_PACK32 || Format == VK_FORMAT_D32_SFLOAT ||
+				Format == VK_FORMAT_D16_UNORM_S8_UINT || Format == VK_FORMAT_D24_UNORM_S8_UINT || Format == VK_FORMAT_D32_SFLOAT_S8_UINT;
+		}
+
+		VkImageUsageFlags ImageUsageFromLayout(const VkImageLayout Layout)
+		{
+			switch (Layout)
+			{
+			case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL: return VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+			case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL: return VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+			case VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL: return VK_IMAGE_USAGE_SAMPLED_BIT;
+			case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL: return VK_IMAGE_USAGE_SAMPLED_BIT;
+			case VK_IMAGE_LAYOUT_GENERAL: return VK_IMAGE_USAGE_STORAGE_BIT;
+			case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL: return VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+			case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL: return VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+			default: return 0;
+			}
+		}
+
+		VkBufferUsageFlags BufferUsageFromAccess(const VkAccessFlags Access)
+		{
+			VkBufferUsageFlags Usage = 0;
+			Usage |= (Access & VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT) ? VK_BUFFER_USAGE_VERTEX_BUFFER_BIT : 0;
+			Usage |= (Access & VK_ACCESS_INDEX_READ_BIT) ? VK_BUFFER_USAGE_INDEX_BUFFER_BIT : 0;
+			Usage |= (Access & VK_ACCESS_INDIRECT_COMMAND_READ_BIT) ? VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT : 0;
+			Usage |= (Access & VK_ACCESS_UNIFORM_READ_BIT) ? VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT : 0;
+			Usage |= (Access & (VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT)) ? VK_BUFFER_USAGE_STORAGE_BUFFER_BIT : 0;
+			Usage |= (Access & VK_ACCESS_TRANSFER_READ_BIT) ? VK_BUFFER_USAGE_TRANSFER_SRC_BIT : 0;
+			Usage |= (Access & VK_ACCESS_TRANSFER_WRITE_BIT) ? VK_BUFFER_USAGE_TRANSFER_DST_BIT : 0;
+			return Usage;
+		}
+
+		uint32_t AddResource(RenderGraph& Graph, const RenderGraphResource& Resource)
+		{
+			Graph.Resources.push_back(Resource);
+			return static_cast<uint32_t> (Graph.Resources.size() - 1);
+		}
+
+		//Merges with an earlier use of the same resource in the pass, conflicting layouts fall back to GENERAL
+		//Only transients collect usage, an imported resource's is fixed by whoever created it
+		void AddUse(RenderGraph& Graph, const uint32_t Pass, const RenderGraphUse& Use)
+		{
+			RenderGraphResource& Resource = Graph.Resources[Use.Resource];
+			if (!Resource.bImported && Resource.bImage)
+			{
+				Resource.ImageUsage |= ImageUsageFromLayout(Use.Layout);
+			}
+			else if (!Resource.bImported)
+			{
+				Resource.BufferUsage |= BufferUsageFromAccess(Use.Access);
+			}
+
+			for (RenderGraphUse& Existing : Graph.Passes[Pass].Uses)
+			{
+				if (Existing.Resource == Use.Resource)
+				{
+					Existing.Stages |= Use.Stages;
+					Existing.Access |= Use.Access;
+					Existing.Layout = Existing.Layout == Use.Layout ? Existing.Layout : VK_IMAGE_LAYOUT_GENERAL;
+					Existing.bRead |= Use.bRead;
+					Existing.bWrite |= Use.bWrite;
+					Existing.bAttachment |= Use.bAttachment;
+					return;
+				}
+			}
+			Graph.Passes[Pass].Uses.push_back(Use);
+		}
+
+		//Updates State for Use and returns whether Use has to wait on anything (a layout change always does)
+		//SrcStages/SrcAccess receive what it waits for, OldLayout the layout it comes from
+		bool ResolveHazard(ResourceState& State, const RenderGraphUse& Use, const bool bImage,
+			VkImageLayout& OldLayout, VkPipelineStageFlags& SrcStages, VkAccessFlags& SrcAccess)
+		{
+			OldLayout = State.Layout;
+			SrcStages = 0;
+			SrcAccess = 0;
+
+			const bool bLayoutChange = bImage && Use.Layout != State.Layout;
+			if (Use.bWrite || bLayoutChange)
+			{
+				//Write after write/read, a layout transition counts as a write
+				SrcStages = State.WriteStages | State.ReadStages;
+				SrcAccess = State.WriteAccess;
+				if (bImage)
+				{
+					State.Layout = Use.Layout;
+				}
+
+				State.WriteStages = Use.Stages;
+				if (Use.bWrite)
+				{
+					State.WriteAccess = Use.Access & WriteAccessMask;
+					State.ReadStages = Use.bRead ? Use.Stages : 0;
+					State.SyncedStages = 0;
+					State.SyncedAccess = 0;
+				}
+				else
+				{
+					//Only the transition was written and its barrier already made it visible to this use
+					State.WriteAccess = 0;
+					State.ReadStages = Use.Stages;
+					State.SyncedStages = Use.Stages;
+					State.SyncedAccess = Use.Access;
+				}
+				return SrcStages != 0 || bLayoutChange;
+			}
+
+			//Read after write, skipped when an earlier read already covered these stages and accesses
+			State.ReadStages |= Use.Stages;
+			if (State.WriteStages == 0 || ((Use.Stages & ~State.SyncedStages) == 0 && (Use.Access & ~State.SyncedAccess) == 0))
+			{
+				return false;
+			}
+			SrcStages = State.WriteStages;
+			SrcAccess = State.WriteAccess;
+			State.SyncedStages |= Use.Stages;
+			State.SyncedAccess |= Use.Access;
+			return true;
+		}
+
+		//Lowest offset in Heap where Resource doesn't overlap anything placed whose lifetime overlaps its own
+		VkDeviceSize FindHeapOffset(const RenderGraph& Graph, const std::vector<uint32_t>& Placed, const uint32_t Heap, const RenderGraphResource& Resource,
+			const VkDeviceSize Alignment)
+		{
+			std::vector<std::pair<VkDeviceSize, VkDeviceSize>> Taken;
+			for (uint32_t Index : Placed)
+			{
+				const RenderGraphResource& Other = Graph.Resources[Index];
+				if (Other.Heap == Heap && Other.FirstUse <= Resource.LastUse && Resource.FirstUse <= Other.LastUse)
+				{
+					Taken.push_back(std::make_pair(Other.HeapOffset, Other.HeapOffset + Other.Requirements.size));
+				}
+			}
+			std::sort(Taken.begin(), Taken.end());
+
+			VkDeviceSize Offset = 0;
+			for (const std::pair<VkDeviceSize, VkDeviceSize>& Range : Taken)
+			{
+				if (Offset + Resource.Requirements.size <= Range.first)
+				{
+					break;
+				}
+				Offset = std::max(Offset, RoundToNextMultiple(Range.second, Alignment));
+			}
+			return Offset;
+		}
+
+		bool CreateTransientResource(GraphicsDevice& GFXDevice, RenderGraphResource& Resource)
+		{
+			VkResult R = VK_SUCCESS;
+			if (Resource.bImage)
+			{
+				VkImageCreateInfo ImageCreateInfo = {};
+				ImageCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+				ImageCreateInfo.imageType = VK_IMAGE_TYPE_2D;
+				ImageCreateInfo.format = Resource.Format;
+				ImageCreateInfo.extent.width = Resource.Extent.width;
+				ImageCreateInfo.extent.height = Resource.Extent.height;
+				ImageCreateInfo.extent.depth = 1;
+				ImageCreateInfo.mipLevels = 1;
+				ImageCreateInfo.arrayLayers = 1;
+				ImageCreateInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+				ImageCreateInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+				ImageCreateInfo.usage = Resource.ImageUsage;
+				ImageCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+				ImageCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+				R = vkCreateImage(GFXDevice.Device, &ImageCreateInfo, nullptr, &Resource.Image);
+				vkGetImageMemoryRequirements(GFXDevice.Device, Resource.Image, &Resource.Requirements);
+			}
+			else
+			{
+				VkBufferCreateInfo BufferCreateInfo = {};
+				BufferCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+				BufferCreateInfo.size = Resource.Size;
+				BufferCreateInfo.usage = Resource.BufferUsage;
+				BufferCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+				R = vkCreateBuffer(GFXDevice.Device, &BufferCreateInfo, nullptr, &Resource.Buffer);
+				vkGetBufferMemoryRequirements(GFXDevice.Device, Resource.Buffer, &Resource.Requirements);
+			}
+
+			if (R != VK_SUCCESS)
+			{
+				std::cout << "Render graph resource " << Resource.Name << " creation failed with error: " << R << std::endl;
+				return false;
+			}
+			return true;
+		}
+
+		void AddBarrier(RenderGraphBarrierBatch& Batch, const RenderGraphResource& Resource, const uint32_t ResourceIndex, const RenderGraphUse& Use,
+			const VkImageLayout OldLayout, const VkPipelineStageFlags SrcStages, const VkAccessFlags SrcAccess)
+		{
+			Batch.SrcStages |= SrcStages != 0 ? SrcStages : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+			Batch.DstStages |= Use.Stages;
+
+			//Nothing to make visible and no transition: the stage masks alone order the two
+			if (Resource.bImage && (OldLayout != Use.Layout || SrcAccess != 0))
+			{
+				VkImageMemoryBarrier Barrier = {};
+				Barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+				Barrier.srcAccessMask = SrcAccess;
+				Barrier.dstAccessMask = Use.Access;
+				Barrier.oldLayout = OldLayout;
+				Barrier.newLayout = Use.Layout;
+				Barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+				Barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+				Barrier.subresourceRange.aspectMask = IsDepthFormat(Resource.Format) ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
+				Barrier.subresourceRange.levelCount = 1;
+				Barrier.subresourceRange.layerCount = 1;
+				Batch.ImageBarriers.push_back(Barrier);
+				Batch.ImageResources.push_back(ResourceIndex);
+			}
+			else if (!Resource.bImage && SrcAccess != 0)
+			{
+				VkBufferMemoryBarrier Barrier = {};
+				Barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+				Barrier.srcAccessMask = SrcAccess;
+				Barrier.dstAccessMask = Use.Access;
+				Barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+				Barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+				Barrier.size = VK_WHOLE_SIZE;
+				Batch.BufferBarriers.push_back(Barrier);
+				Batch.BufferResources.push_back(ResourceIndex);
+			}
+		}
+
+		//Color attachments in declaration order (as the pipeline's outputs expect) followed by depth, the render pass's attachment order
+		std::vector<const RenderGraphAttachment*> GetPassAttachments(const RenderGraphPass& Pass)
+		{
+			std::vector<const RenderGraphAttachment*> Attachments;
+			for (const RenderGraphAttachment& Color : Pass.ColorAttachments)
+			{
+				Attachments.push_back(&Color);
+			}
+			if (Pass.DepthAttachment.Resource != RenderGraphNone)
+			{
+				Attachments.push_back(&Pass.DepthAttachment);
+			}
+			return Attachments;
+		}
+
+		const RenderGraphUse& FindUse(const RenderGraphPass& Pass, const uint32_t Resource)
+		{
+			return *std::find_if(Pass.Uses.begin(), Pass.Uses.end(), [Resource](const RenderGraphUse& Use) { return Use.Resource == Resource; });
+		}
+
+		void CountBatch(RenderGraphStats& Stats, const RenderGraphBarrierBatch& Batch)
+		{
+			if (Batch.DstStages != 0)
+			{
+				++Stats.BarrierBatches;
+				Stats.ImageBarriers += static_cast<uint32_t> (Batch.ImageBarriers.size());
+				Stats.BufferBarriers += static_cast<uint32_t> (Batch.BufferBarriers.size());
+			}
+		}
+
+		void CmdBarrierBatch(VkCommandBuffer CommandBuffer, RenderGraph& Graph, RenderGraphBarrierBatch& Batch)
+		{
+			if (Batch.DstStages == 0)
+			{
+				return;
+			}
+
+			for (size_t i = 0; i < Batch.ImageBarriers.size(); ++i)
+			{
+				Batch.ImageBarriers[i].image = Graph.Resources[Batch.ImageResources[i]].Image;
+			}
+			for (size_t i = 0; i < Batch.BufferBarriers.size(); ++i)
+			{
+				Batch.BufferBarriers[i].buffer = Graph.Resources[Batch.BufferResources[i]].Buffer;
+			}
+
+			vkCmdPipelineBarrier(CommandBuffer, Batch.SrcStages, Batch.DstStages, 0, 0, nullptr,
+				static_cast<uint32_t> (Batch.BufferBarriers.size()), Batch.BufferBarriers.data(),
+				static_cast<uint32_t> (Batch.ImageBarriers.size()), Batch.ImageBarriers.data());
+		}
+	}
+
+	uint32_t CreateGraphImage(RenderGraph& Graph, const char* Name, const VkFormat Format, const VkExtent2D Extent)
+	{
+		RenderGraphResource Resource;
+		Resource.Name = Name;
+		Resource.Format = Format;
+		Resource.Extent = Extent;
+		return AddResource(Graph, Resource);
+	}
+
+	uint32_t CreateGraphBuffer(RenderGraph& Graph, const char* Name, const VkDeviceSize Size)
+	{
+		RenderGraphResource Resource;
+		Resource.Name = Name;
+		Resource.bImage = false;
+		Resource.Size = Size;
+		return AddResource(Graph, Resource);
+	}
+
+	uint32_t ImportGraphImage(RenderGraph& Graph, const char* Name, const VkFormat Format, const VkExtent2D Extent,
+		const VkImageLayout InitialLayout, const VkImageLayout FinalLayout, const VkPipelineStageFlags InitialStages, const VkImageUsageFlags Usage)
+	{
+		RenderGraphResource Resource;
+		Resource.Name = Name;
+		Resource.bImported = true;
+		Resource.Format = Format;
+		Resource.Extent = Extent;
+		Resource.ImageUsage = Usage;
+		Resource.InitialLayout = InitialLayout;
+		Resource.FinalLayout = FinalLayout;
+		Resource.InitialStages = InitialStages;
+		return AddResource(Graph, Resource);
+	}
+
+	uint32_t ImportGraphBuffer(RenderGraph& Graph, const char* Name, const VkDeviceSize Size, const VkPipelineStageFlags InitialStages)
+	{
+		RenderGraphResource Resource;
+		Resource.Name = Name;
+		Resource.bImage = false;
+		Resource.bImported = true;
+		Resource.Size = Size;
+		Resource.InitialStages = InitialStages;
+		return AddResource(Graph, Resource);
+	}
+
+	void SetGraphImage(RenderGraph& Graph, const uint32_t Resource, VkImage Image, VkImageView View)
+	{
+		Graph.Resources[Resource].Image = Image;
+		Graph.Resources[Resource].View = View;
+	}
+
+	void SetGraphBuffer(RenderGraph& Graph, const uint32_t Resource, VkBuffer Buffer)
+	{
+		Graph.Resources[Resource].Buffer = Buffer;
+	}
+
+	uint32_t AddGraphPass(RenderGraph& Graph, const char* Name, std::function<void(VkCommandBuffer)> Execute)
+	{
+		RenderGraphPass Pass;
+		Pass.Name = Name;
+		Pass.Execute = Execute;
+		Graph.Passes.push_back(Pass);
+		return static_cast<uint32_t> (Graph.Passes.size() - 1);
+	}
+
+	void AddColorOutput(RenderGraph& Graph, const uint32_t Pass, const uint32_t Image, const VkAttachmentLoadOp LoadOp, const VkClearColorValue& Clear)
+	{
+		RenderGraphAttachment Attachment;
+		Attachment.Resource = Image;
+		Attachment.LoadOp = LoadOp;
+		Attachment.Clear.color = Clear;
+		Graph.Passes[Pass].ColorAttachments.push_back(Attachment);
+
+		RenderGraphUse Use;
+		Use.Resource = Image;
+		Use.Stages = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+		Use.Access = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | (LoadOp == VK_ATTACHMENT_LOAD_OP_LOAD ? VK_ACCESS_COLOR_ATTACHMENT_READ_BIT : 0);
+		Use.Layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+		Use.bRead = LoadOp == VK_ATTACHMENT_LOAD_OP_LOAD;
+		Use.bWrite = true;
+		Use.bAttachment = true;
+		AddUse(Graph, Pass, Use);
+	}
+
+	void AddDepthOutput(RenderGraph& Graph, const uint32_t Pass, const uint32_t Image, const VkAttachmentLoadOp LoadOp, const float ClearDepth)
+	{
+		RenderGraphAttachment Attachment;
+		Attachment.Resource = Image;
+		Attachment.LoadOp = LoadOp;
+		Attachment.Clear.depthStencil.depth = ClearDepth;
+		Graph.Passes[Pass].DepthAttachment = Attachment;
+
+		//Depth tests read what the pass itself wrote, only LOAD reads an earlier pass's depth
+		RenderGraphUse Use;
+		Use.Resource = Image;
+		Use.Stages = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+		Use.Access = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+		Use.Layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+		Use.bRead = LoadOp == VK_ATTACHMENT_LOAD_OP_LOAD;
+		Use.bWrite = true;
+		Use.bAttachment = true;
+		AddUse(Graph, Pass, Use);
+	}
+
+	void ReadGraphResource(RenderGraph& Graph, const uint32_t Pass, const uint32_t Resource, const VkPipelineStageFlags Stages, const VkAccessFlags Access,
+		const VkImageLayout Layout)
+	{
+		RenderGraphUse Use;
+		Use.Resource = Resource;
+		Use.Stages = Stages;
+		Use.Access = Access;
+		Use.Layout = Layout;
+		Use.bRead = true;
+		AddUse(Graph, Pass, Use);
+	}
+
+	void WriteGraphResource(RenderGraph& Graph, const uint32_t Pass, const uint32_t Resource, const VkPipelineStageFlags Stages, const VkAccessFlags Access,
+		const VkImageLayout Layout)
+	{
+		RenderGraphUse Use;
+		Use.Resource = Resource;
+		Use.Stages = Stages;
+		Use.Access = Access;
+		Use.Layout = Layout;
+		Use.bRead = (Access & ~WriteAccessMask) != 0;
+		Use.bWrite = true;
+		AddUse(Graph, Pass, Use);
+	}
+
+	bool CompileRenderGraph(GraphicsDevice& GFXDevice, RenderGraph& Graph, RenderPassCache& RenderPasses)
+	{
+		RenderGraphStats& Stats = Graph.Stats;
+		Stats = RenderGraphStats();
+		Stats.PassCount = static_cast<uint32_t> (Graph.Passes.size());
+
+		//Cull backwards from the results that leave the graph: a pass survives if it writes an imported resource
+		//or something a surviving pass reads, and then everything it reads is needed too
+		std::vector<bool> bNeeded(Graph.Resources.size(), false);
+		for (size_t i = Graph.Passes.size(); i-- > 0;)
+		{
+			RenderGraphPass& Pass = Graph.Passes[i];
+			Pass.bCulled = true;
+			for (const RenderGraphUse& Use : Pass.Uses)
+			{
+				if (Use.bWrite && (Graph.Resources[Use.Resource].bImported || bNeeded[Use.Resource]))
+				{
+					Pass.bCulled = false;
+				}
+			}
+
+			if (Pass.bCulled)
+			{
+				++Stats.CulledPasses;
+				continue;
+			}
+			for (const RenderGraphUse& Use : Pass.Uses)
+			{
+				bNeeded[Use.Resource] = bNeeded[Use.Resource] || Use.bRead;
+			}
+		}
+
+		Graph.Order.clear();
+		for (uint32_t i = 0; i < Graph.Passes.size(); ++i)
+		{
+			if (!Graph.Passes[i].bCulled)
+			{
+				Graph.Order.push_back(i);
+			}
+		}
+
+		//Lifetimes as positions in the execution order
+		for (uint32_t Position = 0; Position < Graph.Order.size(); ++Position)
+		{
+			for (const RenderGraphUse& Use : Graph.Passes[Graph.Order[Position]].Uses)
+			{
+				RenderGraphResource& Resource = Graph.Resources[Use.Resource];
+				Resource.FirstUse = std::min(Resource.FirstUse, Position);
+				Resource.LastUse = Position;
+			}
+		}
+
+		//Transients that survived culling, biggest first so the small ones fill the gaps
+		std::vector<uint32_t> Transients;
+		for (uint32_t i = 0; i < Graph.Resources.size(); ++i)
+		{
+			RenderGraphResource& Resource = Graph.Resources[i];
+			if (Resource.bImported || Resource.FirstUse == RenderGraphNone)
+			{
+				continue;
+			}
+			if (!CreateTransientResource(GFXDevice, Resource))
+			{
+				return false;
+			}
+			Transients.push_back(i);
+			Stats.TransientBytes += Resource.Requirements.size;
+		}
+		std::sort(Transients.begin(), Transients.end(), [&Graph](const uint32_t A, const uint32_t B)
+		{
+			return Graph.Resources[A].Requirements.size > Graph.Resources[B].Requirements.size;
+		});
+
+		//Offsets are kept bufferImageGranularity apart, so buffers and images can share a heap
+		std::vector<AliasHeap> AliasHeaps;
+		std::vector<uint32_t> Placed;
+		for (uint32_t Index : Transients)
+		{
+			RenderGraphResource& Resource = Graph.Resources[Index];
+			const VkDeviceSize Alignment = std::max(Resource.Requirements.alignment, GFXDevice.Properties.limits.bufferImageGranularity);
+
+			for (uint32_t Heap = 0; Heap < AliasHeaps.size() && Resource.Heap == RenderGraphNone; ++Heap)
+			{
+				if ((AliasHeaps[Heap].TypeBits & Resource.Requirements.memoryTypeBits) != 0)
+				{
+					Resource.Heap = Heap;
+				}
+			}
+			if (Resource.Heap == RenderGraphNone)
+			{
+				Resource.Heap = static_cast<uint32_t> (AliasHeaps.size());
+				AliasHeaps.push_back(AliasHeap());
+				AliasHeaps.back().TypeBits = Resource.Requirements.memoryTypeBits;
+			}
+
+			AliasHeap& Heap = AliasHeaps[Resource.Heap];
+			Resource.HeapOffset = FindHeapOffset(Graph, Placed, Resource.Heap, Resource, Alignment);
+			Heap.TypeBits &= Resource.Requirements.memoryTypeBits;
+			Heap.Size = std::max(Heap.Size, Resource.HeapOffset + Resource.Requirements.size);
+			Heap.Alignment = std::max(Heap.Alignment, Alignment);
+			Placed.push_back(Index);
+		}
+
+		std::vector<MemoryTypeInfo> MemoryHeaps = EnumerateHeaps(GFXDevice.PhysicalDevice);
+		for (const AliasHeap& Heap : AliasHeaps)
+		{
+			VkMemoryRequirements Requirements = {};
+			Requirements.size = Heap.Size;
+			Requirements.alignment = Heap.Alignment;
+			Requirements.memoryTypeBits = Heap.TypeBits;
+			Graph.Heaps.push_back(AllocateMemory(GFXDevice.Device, MemoryHeaps, Requirements, true));
+			Stats.AllocatedBytes += Heap.Size;
+		}
+
+		for (uint32_t Index : Transients)
+		{
+			RenderGraphResource& Resource = Graph.Resources[Index];
+			if (!Resource.bImage)
+			{
+				vkBindBufferMemory(GFXDevice.Device, Resource.Buffer, Graph.Heaps[Resource.Heap], Resource.HeapOffset);
+				continue;
+			}
+
+			vkBindImageMemory(GFXDevice.Device, Resource.Image, Graph.Heaps[Resource.Heap], Resource.HeapOffset);
+
+			VkImageViewCreateInfo ViewCreateInfo = {};
+			ViewCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+			ViewCreateInfo.image = Resource.Image;
+			ViewCreateInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+			ViewCreateInfo.format = Resource.Format;
+			ViewCreateInfo.subresourceRange.aspectMask = IsDepthFormat(Resource.Format) ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
+			ViewCreateInfo.subresourceRange.levelCount = 1;
+			ViewCreateInfo.subresourceRange.layerCount = 1;
+
+			VkResult R = vkCreateImageView(GFXDevice.Device, &ViewCreateInfo, nullptr, &Resource.View);
+			if (R != VK_SUCCESS)
+			{
+				std::cout << "Render graph view of " << Resource.Name << " creation failed with error: " << R << std::endl;
+				return false;
+			}
+		}
+
+		//Where each resource stands once an execution is done, the previous frame's accesses the next one's first uses have to wait for
+		//A resource's own uses fully determine this, so one dry walk is enough
+		std::vector<ResourceState> EndStates(Graph.Resources.size());
+		for (uint32_t PassIndex : Graph.Order)
+		{
+			for (const RenderGraphUse& Use : Graph.Passes[PassIndex].Uses)
+			{
+				VkImageLayout OldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+				VkPipelineStageFlags SrcStages = 0;
+				VkAccessFlags SrcAccess = 0;
+				ResolveHazard(EndStates[Use.Resource], Use, Graph.Resources[Use.Resource].bImage, OldLayout, SrcStages, SrcAccess);
+			}
+		}
+
+		//Walk the passes in order, tracking each resource's layout and pending accesses
+		std::vector<ResourceState> States(Graph.Resources.size());
+		for (size_t i = 0; i < Graph.Resources.size(); ++i)
+		{
+			if (Graph.Resources[i].bImported)
+			{
+				States[i].Layout = Graph.Resources[i].InitialLayout;
+				States[i].WriteStages = Graph.Resources[i].InitialStages;
+			}
+		}
+
+		for (uint32_t Position = 0; Position < Graph.Order.size(); ++Position)
+		{
+			RenderGraphPass& Pass = Graph.Passes[Graph.Order[Position]];
+			Pass.Barriers = RenderGraphBarrierBatch();
+
+			//A transient's first use overwrites memory that was last used either earlier this frame (by a resource aliasing it)
+			//or by the previous execution, which may still be in flight (by itself or an alias used later in the frame)
+			//Either way those last uses count as an earlier write, overlapping lifetimes never share memory so end states cover both
+			for (const RenderGraphUse& Use : Pass.Uses)
+			{
+				const RenderGraphResource& Resource = Graph.Resources[Use.Resource];
+				if (Position != Resource.FirstUse || Resource.bImported)
+				{
+					continue;
+				}
+				for (uint32_t Other : Placed)
+				{
+					const RenderGraphResource& Previous = Graph.Resources[Other];
+					if (Previous.Heap == Resource.Heap &&
+						Previous.HeapOffset < Resource.HeapOffset + Resource.Requirements.size && Resource.HeapOffset < Previous.HeapOffset + Previous.Requirements.size)
+					{
+						States[Use.Resource].WriteStages |= EndStates[Other].WriteStages | EndStates[Other].ReadStages;
+						States[Use.Resource].WriteAccess |= EndStates[Other].WriteAccess;
+					}
+				}
+			}
+
+			for (const RenderGraphUse& Use : Pass.Uses)
+			{
+				VkImageLayout OldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+				VkPipelineStageFlags SrcStages = 0;
+				VkAccessFlags SrcAccess = 0;
+				if (!Use.bAttachment && ResolveHazard(States[Use.Resource], Use, Graph.Resources[Use.Resource].bImage, OldLayout, SrcStages, SrcAccess))
+				{
+					AddBarrier(Pass.Barriers, Graph.Resources[Use.Resource], Use.Resource, Use, OldLayout, SrcStages, SrcAccess);
+				}
+			}
+			CountBatch(Stats, Pass.Barriers);
+
+			//Attachments: the render pass does the transitions and hazards go into its external dependency
+			RenderPassKey Key;
+			Key.Dependency.srcSubpass = VK_SUBPASS_EXTERNAL;
+			Key.Dependency.dstSubpass = 0;
+
+			for (const RenderGraphAttachment* Attachment : GetPassAttachments(Pass))
+			{
+				const RenderGraphUse& Use = FindUse(Pass, Attachment->Resource);
+				const RenderGraphResource& Resource = Graph.Resources[Use.Resource];
+				ResourceState& State = States[Use.Resource];
+
+				VkImageLayout OldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+				VkPipelineStageFlags SrcStages = 0;
+				VkAccessFlags SrcAccess = 0;
+				ResolveHazard(State, Use, true, OldLayout, SrcStages, SrcAccess);
+
+				VkAttachmentDescription Description = {};
+				Description.format = Resource.Format;
+				Description.samples = VK_SAMPLE_COUNT_1_BIT;
+				Description.loadOp = Attachment->LoadOp;
+				Description.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+				Description.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+				Description.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+				Description.initialLayout = Attachment->LoadOp == VK_ATTACHMENT_LOAD_OP_LOAD ? OldLayout : VK_IMAGE_LAYOUT_UNDEFINED;
+				Description.finalLayout = Use.Layout;
+
+				//A result leaving the graph right after this pass is transitioned by the render pass too
+				if (Resource.bImported && Resource.FinalLayout != VK_IMAGE_LAYOUT_UNDEFINED && Resource.LastUse == Position)
+				{
+					Description.finalLayout = Resource.FinalLayout;
+					State.Layout = Resource.FinalLayout;
+				}
+				Stats.RenderPassTransitions += (Description.initialLayout != Use.Layout ? 1 : 0) + (Description.finalLayout != Use.Layout ? 1 : 0);
+
+				VkAttachmentReference Reference = {};
+				Reference.attachment = static_cast<uint32_t> (Key.Attachments.size());
+				Reference.layout = Use.Layout;
+				if (Attachment == &Pass.DepthAttachment)
+				{
+					Key.DepthReference = Reference;
+				}
+				else
+				{
+					Key.ColorReferences.push_back(Reference);
+				}
+				Key.Attachments.push_back(Description);
+				Pass.Extent = Resource.Extent;
+
+				if (SrcStages != 0)
+				{
+					Key.Dependency.srcStageMask |= SrcStages;
+					Key.Dependency.srcAccessMask |= SrcAccess;
+					Key.Dependency.dstStageMask |= Use.Stages;
+					Key.Dependency.dstAccessMask |= Use.Access;
+				}
+			}
+
+			if (Key.Attachments.empty())
+			{
+				continue;
+			}
+
+			Pass.RenderPass = GetRenderPass(GFXDevice, RenderPasses, Key);
+			if (Pass.RenderPass == VK_NULL_HANDLE)
+			{
+				return false;
+			}
+		}
+
+		//Results leaving the graph in a layout their last pass didn't leave them in
+		Graph.Epilogue = RenderGraphBarrierBatch();
+		for (uint32_t i = 0; i < Graph.Resources.size(); ++i)
+		{
+			const RenderGraphResource& Resource = Graph.Resources[i];
+			if (Resource.bImported && Resource.bImage && Resource.FinalLayout != VK_IMAGE_LAYOUT_UNDEFINED && States[i].Layout != Resource.FinalLayout)
+			{
+				RenderGraphUse Use;
+				Use.Stages = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+				Use.Layout = Resource.FinalLayout;
+				AddBarrier(Graph.Epilogue, Resource, i, Use, States[i].Layout, States[i].WriteStages | States[i].ReadStages, States[i].WriteAccess);
+			}
+		}
+		CountBatch(Stats, Graph.Epilogue);
+
+		Graph.bCompiled = true;
+		return true;
+	}
+
+	void ExecuteRenderGraph(GraphicsDevice& GFXDevice, RenderGraph& Graph, RenderPassCache& RenderPasses, VkCommandBuffer CommandBuffer)
+	{
+		for (uint32_t PassIndex : Graph.Order)
+		{
+			RenderGraphPass& Pass = Graph.Passes[PassIndex];
+			CmdBarrierBatch(CommandBuffer, Graph, Pass.Barriers);
+
+			if (Pass.RenderPass == VK_NULL_HANDLE)
+			{
+				Pass.Execute(CommandBuffer);
+				continue;
+			}
+
+			std::vector<VkImageView> Views;
+			std::vector<VkImageUsageFlags> Usages;
+			std::vector<VkFormat> Formats;
+			std::vector<VkClearValue> ClearValues;
+			for (const RenderGraphAttachment* Attachment : GetPassAttachments(Pass))
+			{
+				Views.push_back(Graph.Resources[Attachment->Resource].View);
+				Usages.push_back(Graph.Resources[Attachment->Resource].ImageUsage);
+				Formats.push_back(Graph.Resources[Attachment->Resource].Format);
+				ClearValues.push_back(Attachment->Clear);
+			}
+
+			//Imported views change from frame to frame (e.g. one per swapchain image)
+			//Imageless, one framebuffer serves all of them and gets the views at begin, otherwise each combination gets its own
+			VkRenderPassAttachmentBeginInfoKHR AttachmentBeginInfo = {};
+			AttachmentBeginInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO_KHR;
+			AttachmentBeginInfo.attachmentCount = static_cast<uint32_t> (Views.size());
+			AttachmentBeginInfo.pAttachments = Views.data();
+
+			VkRenderPassBeginInfo RenderPassBeginInfo = {};
+			RenderPassBeginInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+
+			VkFramebuffer Framebuffer = VK_NULL_HANDLE;
+			if (GFXDevice.bSupportsImagelessFramebuffer)
+			{
+				Framebuffer = GetImagelessFramebuffer(GFXDevice, RenderPasses, Pass.RenderPass, Usages, Formats, Pass.Extent);
+				RenderPassBeginInfo.pNext = &AttachmentBeginInfo;
+			}
+			else
+			{
+				Framebuffer = GetFramebuffer(GFXDevice, RenderPasses, Pass.RenderPass, Views, Pass.Extent);
+			}
+
+			RenderPassBeginInfo.renderPass = Pass.RenderPass;
+			RenderPassBeginInfo.framebuffer = Framebuffer;
+			RenderPassBeginInfo.renderArea.extent = Pass.Extent;
+			RenderPassBeginInfo.clearValueCount = static_cast<uint32_t> (ClearValues.size());
+			RenderPassBeginInfo.pClearValues = ClearValues.data();
+
+			vkCmdBeginRenderPass(CommandBuffer, &RenderPassBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
+			Pass.Execute(CommandBuffer);
+			vkCmdEndRenderPass(CommandBuffer);
+		}
+
+		CmdBarrierBatch(CommandBuffer, Graph, Graph.Epilogue);
+	}
+
+	void DestroyRenderGraph(GraphicsDevice& GFXDevice, RenderGraph& Graph)
+	{
+		for (RenderGraphResource& Resource : Graph.Resources)
+		{
+			if (Resource.bImported)
+			{
+				continue;
+			}
+			if (Resource.View != VK_NULL_HANDLE)
+			{
+				vkDestroyImageView(GFXDevice.Device, Resource.View, nullptr);
+			}
+			if (Resource.Image != VK_NULL_HANDLE)
+			{
+				vkDestroyImage(GFXDevice.Device, Resource.Image, nullptr);
+			}
+			if (Resource.Buffer != VK_NULL_HANDLE)
+			{
+				vkDestroyBuffer(GFXDevice.Device, Resource.Buffer, nullptr);
+			}
+		}
+
+		for (VkDeviceMemory Heap : Graph.Heaps)
+		{
+			vkFreeMemory(GFXDevice.Device, Heap, nullptr);
+		}
+
+		Graph = RenderGraph();
+	}
+}
@@ -0,0 +1,179 @@
+#pragma once
+
+#include "vulkan\vulkan.h"
+#include "RenderPassCache.h"
+#include <vector>
+#include <string>
+#include <functional>
+
+namespace VulkanCore
+{
+	struct GraphicsDevice;
+
+	//Resources and passes are referred to by their index in the graph
+	static const uint32_t RenderGraphNone = 0xFFFFFFFF;
+
+	//An image or buffer passes read and write by name
+	//Transient ones are created by the graph and may share memory with others whose lifetimes don't overlap,
+	//imported ones (e.g. the swapchain image) are owned outside and can be swapped every frame
+	struct RenderGraphResource
+	{
+		std::string Name;
+		bool bImage = true;
+		bool bImported = false;
+
+		VkFormat Format = VK_FORMAT_UNDEFINED;
+		VkExtent2D Extent = {};
+		VkDeviceSize Size = 0;
+
+		//Collected from the passes' uses for transients, which are created with them, imported images keep the usage they were created with
+		VkImageUsageFlags ImageUsage = 0;
+		VkBufferUsageFlags BufferUsage = 0;
+
+		VkImage Image = VK_NULL_HANDLE;
+		VkImageView View = VK_NULL_HANDLE;
+		VkBuffer Buffer = VK_NULL_HANDLE;
+
+		//Imported: layout and stages the image arrives with (e.g. the acquire semaphore's wait stage), and the layout to leave it in
+		//UNDEFINED as final layout means nothing outside the graph reads the result
+		VkImageLayout InitialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		VkImageLayout FinalLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		VkPipelineStageFlags InitialStages = 0;
+
+		//Set by CompileRenderGraph: first and last position in the execution order, RenderGraphNone when unused
+		uint32_t FirstUse = RenderGraphNone;
+		uint32_t LastUse = RenderGraphNone;
+
+		//Transient: the aliasing heap and offset it was placed at
+		uint32_t Heap = RenderGraphNone;
+		VkDeviceSize HeapOffset = 0;
+		VkMemoryRequirements Requirements = {};
+	};
+
+	//A pass's access to one resource, all uses of the same resource within a pass are merged
+	struct RenderGraphUse
+	{
+		uint32_t Resource = RenderGraphNone;
+		VkPipelineStageFlags Stages = 0;
+		VkAccessFlags Access = 0;
+
+		//Images only
+		VkImageLayout Layout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+		bool bRead = false;
+		bool bWrite = false;
+		bool bAttachment = false;
+	};
+
+	struct RenderGraphAttachment
+	{
+		uint32_t Resource = RenderGraphNone;
+		VkAttachmentLoadOp LoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+		VkClearValue Clear = {};
+	};
+
+	//Barriers recorded in one vkCmdPipelineBarrier, their handles are filled in at execution since imported resources change
+	struct RenderGraphBarrierBatch
+	{
+		VkPipelineStageFlags SrcStages = 0;
+		VkPipelineStageFlags DstStages = 0;
+
+		std::vector<VkImageMemoryBarrier> ImageBarriers;
+		std::vector<uint32_t> ImageResources;
+		std::vector<VkBufferMemoryBarrier> BufferBarriers;
+		std::vector<uint32_t> BufferResources;
+	};
+
+	//Records its commands through Execute, inside a render pass of its attachments if it has any
+	struct RenderGraphPass
+	{
+		std::string Name;
+		std::function<void(VkCommandBuffer)> Execute;
+
+		std::vector<RenderGraphUse> Uses;
+		std::vector<RenderGraphAttachment> ColorAttachments;
+		RenderGraphAttachment DepthAttachment;
+
+		//Set by CompileRenderGraph, the render pass is owned by the cache it came from
+		bool bCulled = false;
+		RenderGraphBarrierBatch Barriers;
+		VkRenderPass RenderPass = VK_NULL_HANDLE;
+		VkExtent2D Extent = {};
+	};
+
+	//What one execution of the compiled graph costs in synchronization and what aliasing saved
+	struct RenderGraphStats
+	{
+		uint32_t PassCount = 0;
+		uint32_t CulledPasses = 0;
+
+		//vkCmdPipelineBarrier calls and the barriers they carry (execution-only dependencies carry none)
+		uint32_t BarrierBatches = 0;
+		uint32_t ImageBarriers = 0;
+		uint32_t BufferBarriers = 0;
+
+		//Layout transitions done by render passes instead of barriers
+		uint32_t RenderPassTransitions = 0;
+
+		//Sum of every transient resource's size, and what was actually allocated for them
+		VkDeviceSize TransientBytes = 0;
+		VkDeviceSize AllocatedBytes = 0;
+	};
+
+	//Frame graph: passes declare what they read and write, CompileRenderGraph then
+	//culls passes whose results nobody uses, derives every barrier and layout transition,
+	//picks render passes from the cache and aliases transient resources' memory
+	//Passes run in declaration order, which already respects every dependency since a pass can only read what earlier passes wrote
+	struct RenderGraph
+	{
+		std::vector<RenderGraphResource> Resources;
+		std::vector<RenderGraphPass> Passes;
+
+		//Set by CompileRenderGraph
+		std::vector<uint32_t> Order;
+		RenderGraphBarrierBatch Epilogue;
+		std::vector<VkDeviceMemory> Heaps;
+		RenderGraphStats Stats;
+		bool bCompiled = false;
+	};
+
+	uint32_t CreateGraphImage(RenderGraph& Graph, const char* Name, const VkFormat Format, const VkExtent2D Extent);
+
+	uint32_t CreateGraphBuffer(RenderGraph& Graph, const char* Name, const VkDeviceSize Size);
+
+	//Usage is what the image was created with, imageless framebuffers must match it exactly
+	uint32_t ImportGraphImage(RenderGraph& Graph, const char* Name, const VkFormat Format, const VkExtent2D Extent,
+		const VkImageLayout InitialLayout, const VkImageLayout FinalLayout, const VkPipelineStageFlags InitialStages, const VkImageUsageFlags Usage);
+
+	uint32_t ImportGraphBuffer(RenderGraph& Graph, const char* Name, const VkDeviceSize Size, const VkPipelineStageFlags InitialStages);
+
+	//Points an imported resource at this frame's handles, before ExecuteRenderGraph
+	void SetGraphImage(RenderGraph& Graph, const uint32_t Resource, VkImage Image, VkImageView View);
+
+	void SetGraphBuffer(RenderGraph& Graph, const uint32_t Resource, VkBuffer Buffer);
+
+	uint32_t AddGraphPass(RenderGraph& Graph, const char* Name, std::function<void(VkCommandBuffer)> Execute);
+
+	//Attachments of a graphics pass, in the order the pipeline's color outputs use them
+	//A LoadOp other than LOAD discards the old contents, so the pass doesn't depend on earlier writers
+	void AddColorOutput(RenderGraph& Graph, const uint32_t Pass, const uint32_t Image, const VkAttachmentLoadOp LoadOp, const VkClearColorValue& Clear);
+
+	void AddDepthOutput(RenderGraph& Graph, const uint32_t Pass, const uint32_t Image, const VkAttachmentLoadOp LoadOp, const float ClearDepth);
+
+	//Any other access, Layout is ignored for buffers
+	void ReadGraphResource(RenderGraph& Graph, const uint32_t Pass, const uint32_t Resource, const VkPipelineStageFlags Stages, const VkAccessFlags Access,
+		const VkImageLayout Layout = VK_IMAGE_LAYOUT_UNDEFINED);
+
+	void WriteGraphResource(RenderGraph& Graph, const uint32_t Pass, const uint32_t Resource, const VkPipelineStageFlags Stages, const VkAccessFlags Access,
+		const VkImageLayout Layout = VK_IMAGE_LAYOUT_UNDEFINED);
+
+	//Call once after declaring everything, the graph can't be changed afterwards (imported handles aside)
+	bool CompileRenderGraph(GraphicsDevice& GFXDevice, RenderGraph& Graph, RenderPassCache& RenderPasses);
+
+	//Records every pass and barrier into CommandBuffer, outside a render pass
+	//Framebuffers come from the same cache CompileRenderGraph used
+	void ExecuteRenderGraph(GraphicsDevice& GFXDevice, RenderGraph& Graph, RenderPassCache& RenderPasses, VkCommandBuffer CommandBuffer);
+
+	//Device must be idle, leaves the cached render passes and framebuffers to their cache
+	void DestroyRenderGraph(GraphicsDevice& GFXDevice, RenderGraph& Graph);
+}
@@ -0,0 +1,276 @@
+#include "RenderPassCache.h"
+#include "VulkanInitializers.h"
+#include "DeletionQueue.h"
+#include <iostream>
+#include <functional>
+#include <algorithm>
+
+namespace VulkanCore
+{
+	namespace
+	{
+		bool SameAttachment(const VkAttachmentDescription& A, const VkAttachmentDescription& B)
+		{
+			return A.flags == B.flags && A.format == B.format && A.samples == B.samples && A.loadOp == B.loadOp && A.storeOp == B.storeOp &&
+				A.stencilLoadOp == B.stencilLoadOp && A.stencilStoreOp == B.stencilStoreOp && A.initialLayout == B.initialLayout && A.finalLayout == B.finalLayout;
+		}
+
+		bool SameReference(const VkAttachmentReference& A, const VkAttachmentReference& B)
+		{
+			return A.attachment == B.attachment && A.layout == B.layout;
+		}
+
+		bool SameDependency(const VkSubpassDependency& A, const VkSubpassDependency& B)
+		{
+			return A.srcSubpass == B.srcSubpass && A.dstSubpass == B.dstSubpass && A.srcStageMask == B.srcStageMask && A.dstStageMask == B.dstStageMask &&
+				A.srcAccessMask == B.srcAccessMask && A.dstAccessMask == B.dstAccessMask && A.dependencyFlags == B.dependencyFlags;
+		}
+
+		void RetireFramebuffer(RenderPassCache& Cache, VkFramebuffer Framebuffer)
+		{
+			DeferDestroyFramebuffer(*Cache.Deletions, Framebuffer);
+			++Cache.FramebuffersEvicted;
+		}
+
+		VkFramebuffer CreateCachedFramebuffer(GraphicsDevice& GFXDevice, RenderPassCache& Cache, const FramebufferKey& Key, const VkFramebufferCreateInfo& FramebufferCreateInfo)
+		{
+			CachedFramebuffer Entry;
+			Entry.LastUsedFrame = Cache.FrameNumber;
+			VkResult R = vkCreateFramebuffer(GFXDevice.Device, &FramebufferCreateInfo, nullptr, &Entry.Framebuffer);
+			if (R != VK_SUCCESS)
+			{
+				std::cout << "Framebuffer creation failed with error: " << R << std::endl;
+				return VK_NULL_HANDLE;
+			}
+
+			Cache.Framebuffers[Key] = Entry;
+			++Cache.FramebuffersCreated;
+			return Entry.Framebuffer;
+		}
+	}
+
+	bool RenderPassKey::operator==(const RenderPassKey& Other) const
+	{
+		return Attachments.size() == Other.Attachments.size() && std::equal(Attachments.begin(), Attachments.end(), Other.Attachments.begin(), SameAttachment) &&
+			ColorReferences.size() == Other.ColorReferences.size() && std::equal(ColorReferences.begin(), ColorReferences.end(), Other.ColorReferences.begin(), SameReference) &&
+			SameReference(DepthReference, Other.DepthReference) && SameDependency(Dependency, Other.Dependency);
+	}
+
+	size_t RenderPassKeyHash::operator()(const RenderPassKey& Key) const
+	{
+		size_t Hash = std::hash<uint32_t>()(static_cast<uint32_t> (Key.Attachments.size()));
+		auto Combine = [&Hash](size_t Value) { Hash ^= Value + 0x9e3779b9 + (Hash << 6) + (Hash >> 2); };
+
+		for (const VkAttachmentDescription& Attachment : Key.Attachments)
+		{
+			//Ops and sample count pack into one word, format and layouts get their own
+			Combine(std::hash<uint32_t>()(Attachment.samples | (Attachment.loadOp << 8) | (Attachment.storeOp << 12) |
+				(Attachment.stencilLoadOp << 16) | (Attachment.stencilStoreOp << 20) | (Attachment.flags << 24)));
+			Combine(std::hash<uint32_t>()(Attachment.format));
+			Combine(std::hash<uint32_t>()(Attachment.initialLayout));
+			Combine(std::hash<uint32_t>()(Attachment.finalLayout));
+		}
+		for (const VkAttachmentReference& Reference : Key.ColorReferences)
+		{
+			Combine(std::hash<uint32_t>()(Reference.attachment));
+			Combine(std::hash<uint32_t>()(Reference.layout));
+		}
+		Combine(std::hash<uint32_t>()(Key.DepthReference.attachment));
+		Combine(std::hash<uint32_t>()(Key.DepthReference.layout));
+		Combine(std::hash<uint32_t>()(Key.Dependency.srcStageMask));
+		Combine(std::hash<uint32_t>()(Key.Dependency.dstStageMask));
+		Combine(std::hash<uint32_t>()(Key.Dependency.srcAccessMask));
+		Combine(std::hash<uint32_t>()(Key.Dependency.dstAccessMask));
+		return Hash;
+	}
+
+	bool FramebufferKey::operator==(const FramebufferKey& Other) const
+	{
+		return RenderPass == Other.RenderPass && Views == Other.Views && Usages == Other.Usages && Formats == Other.Formats && Extent.width == Other.Extent.width && Extent.height == Other.Extent.height;
+	}
+
+	size_t FramebufferKeyHash::operator()(const FramebufferKey& Key) const
+	{
+		size_t Hash = std::hash<VkRenderPass>()(Key.RenderPass);
+		auto Combine = [&Hash](size_t Value) { Hash ^= Value + 0x9e3779b9 + (Hash << 6) + (Hash >> 2); };
+
+		for (VkImageView View : Key.Views)
+		{
+			Combine(std::hash<VkImageView>()(View));
+		}
+		for (VkImageUsageFlags Usage : Key.Usages)
+		{
+			Combine(std::hash<uint32_t>()(Usage));
+		}
+		for (VkFormat Format : Key.Formats)
+		{
+			Combine(std::hash<uint32_t>()(Format));
+		}
+		Combine(std::hash<uint32_t>()(Key.Extent.width | (Key.Extent.height << 16)));
+		return Hash;
+	}
+
+	RenderPassCache CreateRenderPassCache(DeletionQueue& Deletions)
+	{
+		RenderPassCache RetVal;
+		RetVal.Deletions = &Deletions;
+		return RetVal;
+	}
+
+	VkRenderPass GetRenderPass(GraphicsDevice& GFXDevice, RenderPassCache& Cache, const RenderPassKey& Key)
+	{
+		auto Found = Cache.RenderPasses.find(Key);
+		if (Found != Cache.RenderPasses.end())
+		{
+			return Found->second;
+		}
+
+		VkSubpassDescription SubpassDescription = {};
+		SubpassDescription.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+		SubpassDescription.colorAttachmentCount = static_cast<uint32_t> (Key.ColorReferences.size());
+		SubpassDescription.pColorAttachments = Key.ColorReferences.data();
+		SubpassDescription.pDepthStencilAttachment = Key.DepthReference.attachment != VK_ATTACHMENT_UNUSED ? &Key.DepthReference : nullptr;
+
+		VkRenderPassCreateInfo RenderPassCreateInfo = {};
+		RenderPassCreateInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+		RenderPassCreateInfo.attachmentCount = static_cast<uint32_t> (Key.Attachments.size());
+		RenderPassCreateInfo.pAttachments = Key.Attachments.data();
+		RenderPassCreateInfo.subpassCount = 1;
+		RenderPassCreateInfo.pSubpasses = &SubpassDescription;
+		RenderPassCreateInfo.dependencyCount = Key.Dependency.dstStageMask != 0 ? 1 : 0;
+		RenderPassCreateInfo.pDependencies = &Key.Dependency;
+
+		VkRenderPass RenderPass = VK_NULL_HANDLE;
+		VkResult R = vkCreateRenderPass(GFXDevice.Device, &RenderPassCreateInfo, nullptr, &RenderPass);
+		if (R != VK_SUCCESS)
+		{
+			std::cout << "Render pass creation failed with error: " << R << std::endl;
+			return VK_NULL_HANDLE;
+		}
+
+		Cache.RenderPasses[Key] = RenderPass;
+		++Cache.RenderPassesCreated;
+		return RenderPass;
+	}
+
+	VkFramebuffer GetFramebuffer(GraphicsDevice& GFXDevice, RenderPassCache& Cache, VkRenderPass RenderPass, const std::vector<VkImageView>& Views, const VkExtent2D Extent)
+	{
+		FramebufferKey Key;
+		Key.RenderPass = RenderPass;
+		Key.Views = Views;
+		Key.Extent = Extent;
+
+		auto Found = Cache.Framebuffers.find(Key);
+		if (Found != Cache.Framebuffers.end())
+		{
+			Found->second.LastUsedFrame = Cache.FrameNumber;
+			return Found->second.Framebuffer;
+		}
+
+		VkFramebufferCreateInfo FramebufferCreateInfo = {};
+		FramebufferCreateInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+		FramebufferCreateInfo.renderPass = RenderPass;
+		FramebufferCreateInfo.attachmentCount = static_cast<uint32_t> (Views.size());
+		FramebufferCreateInfo.pAttachments = Views.data();
+		FramebufferCreateInfo.width = Extent.width;
+		FramebufferCreateInfo.height = Extent.height;
+		FramebufferCreateInfo.layers = 1;
+
+		return CreateCachedFramebuffer(GFXDevice, Cache, Key, FramebufferCreateInfo);
+	}
+
+	VkFramebuffer GetImagelessFramebuffer(GraphicsDevice& GFXDevice, RenderPassCache& Cache, VkRenderPass RenderPass, const std::vector<VkImageUsageFlags>& Usages,
+		const std::vector<VkFormat>& Formats, const VkExtent2D Extent)
+	{
+		FramebufferKey Key;
+		Key.RenderPass = RenderPass;
+		Key.Usages = Usages;
+		Key.Formats = Formats;
+		Key.Extent = Extent;
+
+		auto Found = Cache.Framebuffers.find(Key);
+		if (Found != Cache.Framebuffers.end())
+		{
+			Found->second.LastUsedFrame = Cache.FrameNumber;
+			return Found->second.Framebuffer;
+		}
+
+		//Every attachment's view must have a format listed here, each one only ever gets views of its own format
+		std::vector<VkFramebufferAttachmentImageInfoKHR> AttachmentImageInfos(Usages.size());
+		for (size_t i = 0; i < Usages.size(); ++i)
+		{
+			AttachmentImageInfos[i] = {};
+			AttachmentImageInfos[i].sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENT_IMAGE_INFO_KHR;
+			AttachmentImageInfos[i].usage = Usages[i];
+			AttachmentImageInfos[i].width = Extent.width;
+			AttachmentImageInfos[i].height = Extent.height;
+			AttachmentImageInfos[i].layerCount = 1;
+			AttachmentImageInfos[i].viewFormatCount = 1;
+			AttachmentImageInfos[i].pViewFormats = &Formats[i];
+		}
+
+		VkFramebufferAttachmentsCreateInfoKHR AttachmentsCreateInfo = {};
+		AttachmentsCreateInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_INFO_KHR;
+		AttachmentsCreateInfo.attachmentImageInfoCount = static_cast<uint32_t> (AttachmentImageInfos.size());
+		AttachmentsCreateInfo.pAttachmentImageInfos = AttachmentImageInfos.data();
+
+		VkFramebufferCreateInfo FramebufferCreateInfo = {};
+		FramebufferCreateInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+		FramebufferCreateInfo.pNext = &AttachmentsCreateInfo;
+		FramebufferCreateInfo.flags = VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT_KHR;
+		FramebufferCreateInfo.renderPass = RenderPass;
+		FramebufferCreateInfo.attachmentCount = static_cast<uint32_t> (Usages.size());
+		FramebufferCreateInfo.width = Extent.width;
+		FramebufferCreateInfo.height = Extent.height;
+		FramebufferCreateInfo.layers = 1;
+
+		return CreateCachedFramebuffer(GFXDevice, Cache, Key, FramebufferCreateInfo);
+	}
+
+	void EvictFramebuffers(RenderPassCache& Cache, VkImageView View)
+	{
+		for (auto It = Cache.Framebuffers.begin(); It != Cache.Framebuffers.end();)
+		{
+			if (std::find(It->first.Views.begin(), It->first.Views.end(), View) != It->first.Views.end())
+			{
+				RetireFramebuffer(Cache, It->second.Framebuffer);
+				It = Cache.Framebuffers.erase(It);
+			}
+			else
+			{
+				++It;
+			}
+		}
+	}
+
+	void BeginRenderPassCacheFrame(RenderPassCache& Cache)
+	{
+		++Cache.FrameNumber;
+
+		for (auto It = Cache.Framebuffers.begin(); It != Cache.Framebuffers.end();)
+		{
+			if (It->second.LastUsedFrame + Cache.EvictAfterFrames < Cache.FrameNumber)
+			{
+				RetireFramebuffer(Cache, It->second.Framebuffer);
+				It = Cache.Framebuffers.erase(It);
+			}
+			else
+			{
+				++It;
+			}
+		}
+	}
+
+	void DestroyRenderPassCache(GraphicsDevice& GFXDevice, RenderPassCache& Cache)
+	{
+		for (auto& Framebuffer : Cache.Framebuffers)
+		{
+			vkDestroyFramebuffer(GFXDevice.Device, Framebuffer.second.Framebuffer, nullptr);
+		}
+		for (auto& RenderPass : Cache.RenderPasses)
+		{
+			vkDestroyRenderPass(GFXDevice.Device, RenderPass.second, nullptr);
+		}
+		Cache = RenderPassCache();
+	}
+}
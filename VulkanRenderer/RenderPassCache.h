@@ -0,0 +1,95 @@
+#pragma once
+
+#include "vulkan\vulkan.h"
+#include <vector>
+#include <unordered_map>
+
+namespace VulkanCore
+{
+	struct GraphicsDevice;
+	struct DeletionQueue;
+
+	//A single subpass render pass: every attachment's format, samples, load/store ops and layouts,
+	//the attachments the subpass uses as color/depth, and its external dependency (unused while dstStageMask is 0)
+	struct RenderPassKey
+	{
+		std::vector<VkAttachmentDescription> Attachments;
+		std::vector<VkAttachmentReference> ColorReferences;
+		VkAttachmentReference DepthReference = { VK_ATTACHMENT_UNUSED, VK_IMAGE_LAYOUT_UNDEFINED };
+		VkSubpassDependency Dependency = {};
+
+		bool operator==(const RenderPassKey& Other) const;
+	};
+
+	struct RenderPassKeyHash
+	{
+		size_t operator()(const RenderPassKey& Key) const;
+	};
+
+	//Imageless framebuffers have no Views, only the usage each attachment's image was created with and the format its view will have
+	struct FramebufferKey
+	{
+		VkRenderPass RenderPass = VK_NULL_HANDLE;
+		std::vector<VkImageView> Views;
+		std::vector<VkImageUsageFlags> Usages;
+		std::vector<VkFormat> Formats;
+		VkExtent2D Extent = {};
+
+		bool operator==(const FramebufferKey& Other) const;
+	};
+
+	struct FramebufferKeyHash
+	{
+		size_t operator()(const FramebufferKey& Key) const;
+	};
+
+	struct CachedFramebuffer
+	{
+		VkFramebuffer Framebuffer = VK_NULL_HANDLE;
+		uint64_t LastUsedFrame = 0;
+	};
+
+	//Shares one VkRenderPass between every pass with the same description, and one VkFramebuffer per (render pass, views, extent)
+	//or, imageless, per (render pass, attachment usages and formats, extent) so swapping views doesn't create new ones
+	//Framebuffers are evicted when unused for a while or when one of their views goes away, and released to the deletion queue
+	struct RenderPassCache
+	{
+		std::unordered_map<RenderPassKey, VkRenderPass, RenderPassKeyHash> RenderPasses;
+		std::unordered_map<FramebufferKey, CachedFramebuffer, FramebufferKeyHash> Framebuffers;
+
+		//Destroys evicted framebuffers once the frames that may still use them have completed
+		DeletionQueue* Deletions = nullptr;
+
+		uint64_t FrameNumber = 0;
+
+		//Framebuffers nobody asked for in this many frames are evicted (e.g. the old resolution's after a resize)
+		uint32_t EvictAfterFrames = 120;
+
+		uint32_t RenderPassesCreated = 0;
+		uint32_t FramebuffersCreated = 0;
+		uint32_t FramebuffersEvicted = 0;
+	};
+
+	//Deletions must outlive the cache
+	RenderPassCache CreateRenderPassCache(DeletionQueue& Deletions);
+
+	//Returns the cached render pass for Key, creating it on first use
+	VkRenderPass GetRenderPass(GraphicsDevice& GFXDevice, RenderPassCache& Cache, const RenderPassKey& Key);
+
+	//Returns the cached framebuffer, creating it on first use, Views are in the render pass's attachment order
+	VkFramebuffer GetFramebuffer(GraphicsDevice& GFXDevice, RenderPassCache& Cache, VkRenderPass RenderPass, const std::vector<VkImageView>& Views, const VkExtent2D Extent);
+
+	//Returns the cached imageless framebuffer, creating it on first use, needs GraphicsDevice::bSupportsImagelessFramebuffer
+	//Usages and Formats are in the render pass's attachment order, the views are passed to vkCmdBeginRenderPass through VkRenderPassAttachmentBeginInfoKHR
+	VkFramebuffer GetImagelessFramebuffer(GraphicsDevice& GFXDevice, RenderPassCache& Cache, VkRenderPass RenderPass, const std::vector<VkImageUsageFlags>& Usages,
+		const std::vector<VkFormat>& Formats, const VkExtent2D Extent);
+
+	//Evicts every framebuffer using View, call before destroying it (the view itself must outlive the frames in flight too)
+	void EvictFramebuffers(RenderPassCache& Cache, VkImageView View);
+
+	//Call once per frame, evicts unused framebuffers
+	void BeginRenderPassCacheFrame(RenderPassCache& Cache);
+
+	//Device must be idle, evicted framebuffers are left to the deletion queue
+	void DestroyRenderPassCache(GraphicsDevice& GFXDevice, RenderPassCache& Cache);
+}
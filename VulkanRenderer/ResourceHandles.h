@@ -0,0 +1,16 @@
+#pragma once
+
+#include "ResourcePool.h"
+
+namespace VulkanCore
+{
+	//The handle types alone, for headers that ResourceRegistry.h itself pulls in (GeometryBuffer.h and Meshlets.h, through VulkanInitializers.h)
+	struct ResourceRegistry;
+	struct BufferResource;
+	struct ImageResource;
+	struct PipelineResource;
+
+	typedef ResourceHandle<BufferResource> BufferHandle;
+	typedef ResourceHandle<ImageResource> ImageHandle;
+	typedef ResourceHandle<PipelineResource> PipelineHandle;
+}
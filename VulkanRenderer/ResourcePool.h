@@ -0,0 +1,136 @@
+#pragma once
+
+#include <vector>
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+
+namespace VulkanCore
+{
+	//32 bit handle: slot index in the low bits, the slot's generation in the high bits
+	//A slot's generation changes every time its resource is removed, so handles to removed resources stop resolving
+	//0 is never a live handle (generations start at 1)
+	static const uint32_t ResourceIndexBits = 20;
+	static const uint32_t ResourceIndexMask = (1u << ResourceIndexBits) - 1;
+	static const uint32_t ResourceGenerationMask = (1u << (32 - ResourceIndexBits)) - 1;
+
+	//Typed so a buffer handle can't be used to look up a pipeline
+	template <typename T>
+	struct ResourceHandle
+	{
+		uint32_t Value = 0;
+
+		bool operator==(const ResourceHandle& Other) const { return Value == Other.Value; }
+		bool operator!=(const ResourceHandle& Other) const { return Value != Other.Value; }
+	};
+
+	//Resources stored densely (iteration touches live entries only), slots map handles to dense indices
+	//Add and remove are O(1): removal moves the last dense entry into the hole
+	template <typename T>
+	struct ResourcePool
+	{
+		struct Slot
+		{
+			//Dense index while live, next free slot while free
+			uint32_t Index = 0;
+			uint32_t Generation = 1;
+		};
+
+		std::vector<T> Dense;
+		std::vector<uint32_t> DenseToSlot;
+		std::vector<Slot> Slots;
+		uint32_t FreeSlot = ResourceIndexMask;
+	};
+
+	template <typename T>
+	bool IsHandleValid(const ResourcePool<T>& Pool, const ResourceHandle<T> Handle)
+	{
+		const uint32_t SlotIndex = Handle.Value & ResourceIndexMask;
+		return Handle.Value != 0 && SlotIndex < Pool.Slots.size() && Pool.Slots[SlotIndex].Generation == (Handle.Value >> ResourceIndexBits);
+	}
+
+	template <typename T>
+	ResourceHandle<T> AddToPool(ResourcePool<T>& Pool, const T& Resource)
+	{
+		uint32_t SlotIndex = Pool.FreeSlot;
+		if (SlotIndex != ResourceIndexMask)
+		{
+			Pool.FreeSlot = Pool.Slots[SlotIndex].Index;
+		}
+		else
+		{
+			SlotIndex = static_cast<uint32_t> (Pool.Slots.size());
+			assert(SlotIndex < ResourceIndexMask);
+			Pool.Slots.push_back(typename ResourcePool<T>::Slot());
+		}
+
+		typename ResourcePool<T>::Slot& NewSlot = Pool.Slots[SlotIndex];
+		NewSlot.Index = static_cast<uint32_t> (Pool.Dense.size());
+		Pool.Dense.push_back(Resource);
+		Pool.DenseToSlot.push_back(SlotIndex);
+
+		ResourceHandle<T> RetVal;
+		RetVal.Value = (NewSlot.Generation << ResourceIndexBits) | SlotIndex;
+		return RetVal;
+	}
+
+	//Debug builds check the generation, release builds trust the handle
+	template <typename T>
+	T& GetFromPool(ResourcePool<T>& Pool, const ResourceHandle<T> Handle)
+	{
+#ifdef _DEBUG
+		if (!IsHandleValid(Pool, Handle))
+		{
+			std::cout << "Stale or invalid resource handle: " << std::hex << Handle.Value << std::dec << std::endl;
+			assert(false);
+		}
+#endif
+		return Pool.Dense[Pool.Slots[Handle.Value & ResourceIndexMask].Index];
+	}
+
+	template <typename T>
+	const T& GetFromPool(const ResourcePool<T>& Pool, const ResourceHandle<T> Handle)
+	{
+		return GetFromPool(const_cast<ResourcePool<T>&> (Pool), Handle);
+	}
+
+	//Moves the removed resource to Out for the caller to destroy, the handle (and any copy of it) is stale from here on
+	//Checked in every build since removing through a stale handle would take someone else's resource: returns false and leaves the pool alone
+	template <typename T>
+	bool RemoveFromPool(ResourcePool<T>& Pool, const ResourceHandle<T> Handle, T& Out)
+	{
+		if (!IsHandleValid(Pool, Handle))
+		{
+			std::cout << "Ignored removal through a stale or invalid resource handle: " << std::hex << Handle.Value << std::dec << std::endl;
+			return false;
+		}
+
+		const uint32_t SlotIndex = Handle.Value & ResourceIndexMask;
+		const uint32_t DenseIndex = Pool.Slots[SlotIndex].Index;
+		const uint32_t LastIndex = static_cast<uint32_t> (Pool.Dense.size() - 1);
+		T& Removed = Pool.Dense[DenseIndex];
+		Out = Removed;
+		if (DenseIndex != LastIndex)
+		{
+			Removed = Pool.Dense[LastIndex];
+			Pool.DenseToSlot[DenseIndex] = Pool.DenseToSlot[LastIndex];
+			Pool.Slots[Pool.DenseToSlot[DenseIndex]].Index = DenseIndex;
+		}
+		Pool.Dense.pop_back();
+		Pool.DenseToSlot.pop_back();
+
+		//Wraps past 0, which stays reserved for the null handle
+		typename ResourcePool<T>::Slot& FreedSlot = Pool.Slots[SlotIndex];
+		FreedSlot.Generation = FreedSlot.Generation == ResourceGenerationMask ? 1 : FreedSlot.Generation + 1;
+		FreedSlot.Index = Pool.FreeSlot;
+		Pool.FreeSlot = SlotIndex;
+		return true;
+	}
+
+	//CPU memory the pool itself uses, excluding whatever its resources own
+	template <typename T>
+	size_t GetPoolBytes(const ResourcePool<T>& Pool)
+	{
+		return Pool.Dense.capacity() * sizeof(T) + Pool.DenseToSlot.capacity() * sizeof(uint32_t) + Pool.Slots.capacity() * sizeof(typename ResourcePool<T>::Slot);
+	}
+}
@@ -0,0 +1,126 @@
+#include "ResourceRegistry.h"
+#include "DeletionQueue.h"
+#include <iostream>
+
+namespace VulkanCore
+{
+	namespace
+	{
+		template <typename T>
+		void PrintPoolMemory(const char* Name, const ResourcePool<T>& Pool, const VkDeviceSize DeviceBytes)
+		{
+			const size_t Count = Pool.Dense.size();
+			const size_t PoolBytes = GetPoolBytes(Pool);
+			std::cout << Name << ": " << Count << " live, " << DeviceBytes << " bytes of device memory";
+			if (Count > 0)
+			{
+				std::cout << " (" << DeviceBytes / Count << " per resource, " << PoolBytes / Count << " bytes of registry overhead each)";
+			}
+			std::cout << std::endl;
+		}
+	}
+
+	BufferHandle RegisterBuffer(ResourceRegistry& Registry, VkBuffer Buffer, VkDeviceMemory DeviceMemory, const VkDeviceSize Size)
+	{
+		BufferResource Resource;
+		Resource.Buffer = Buffer;
+		Resource.DeviceMemory = DeviceMemory;
+		Resource.Size = Size;
+		return AddToPool(Registry.Buffers, Resource);
+	}
+
+	ImageHandle RegisterImage(ResourceRegistry& Registry, const Texture& Image, const VkDeviceSize Size)
+	{
+		ImageResource Resource;
+		Resource.Image = Image;
+		Resource.Size = Size;
+		return AddToPool(Registry.Images, Resource);
+	}
+
+	PipelineHandle RegisterPipeline(ResourceRegistry& Registry, const PipelineData& Pipeline)
+	{
+		PipelineResource Resource;
+		Resource.Pipeline = Pipeline;
+		return AddToPool(Registry.Pipelines, Resource);
+	}
+
+	void ReplaceImage(ResourceRegistry& Registry, DeletionQueue& Deletions, const ImageHandle Handle, const Texture& Image, const VkDeviceSize Size)
+	{
+		ImageResource& Resource = GetFromPool(Registry.Images, Handle);
+		Texture Old = Resource.Image;
+		DeferDeletion(Deletions, [Old](GraphicsDevice& GFXDevice) mutable { DestroyTexture(GFXDevice, Old); });
+		Resource.Image = Image;
+		Resource.Size = Size;
+	}
+
+	void ReplacePipeline(ResourceRegistry& Registry, DeletionQueue& Deletions, const PipelineHandle Handle, const PipelineData& Pipeline)
+	{
+		PipelineResource& Resource = GetFromPool(Registry.Pipelines, Handle);
+		DeferDestroyPipeline(Deletions, Resource.Pipeline);
+		Resource.Pipeline = Pipeline;
+	}
+
+	void ReleaseBuffer(ResourceRegistry& Registry, DeletionQueue& Deletions, const BufferHandle Handle)
+	{
+		BufferResource Resource;
+		if (RemoveFromPool(Registry.Buffers, Handle, Resource))
+		{
+			DeferDestroyBuffer(Deletions, Resource.Buffer, Resource.DeviceMemory);
+		}
+	}
+
+	void ReleaseImage(ResourceRegistry& Registry, DeletionQueue& Deletions, const ImageHandle Handle)
+	{
+		ImageResource Resource;
+		if (RemoveFromPool(Registry.Images, Handle, Resource))
+		{
+			Texture Old = Resource.Image;
+			DeferDeletion(Deletions, [Old](GraphicsDevice& GFXDevice) mutable { DestroyTexture(GFXDevice, Old); });
+		}
+	}
+
+	void ReleasePipeline(ResourceRegistry& Registry, DeletionQueue& Deletions, const PipelineHandle Handle)
+	{
+		PipelineResource Resource;
+		if (RemoveFromPool(Registry.Pipelines, Handle, Resource))
+		{
+			DeferDestroyPipeline(Deletions, Resource.Pipeline);
+		}
+	}
+
+	void PrintResourceMemory(const ResourceRegistry& Registry)
+	{
+		VkDeviceSize BufferBytes = 0;
+		for (const BufferResource& Resource : Registry.Buffers.Dense)
+		{
+			BufferBytes += Resource.Size;
+		}
+		VkDeviceSize ImageBytes = 0;
+		for (const ImageResource& Resource : Registry.Images.Dense)
+		{
+			ImageBytes += Resource.Size;
+		}
+
+		PrintPoolMemory("Buffers", Registry.Buffers, BufferBytes);
+		PrintPoolMemory("Images", Registry.Images, ImageBytes);
+		PrintPoolMemory("Pipelines", Registry.Pipelines, 0);
+	}
+
+	void DestroyResourceRegistry(GraphicsDevice& GFXDevice, ResourceRegistry& Registry)
+	{
+		for (BufferResource& Resource : Registry.Buffers.Dense)
+		{
+			vkDestroyBuffer(GFXDevice.Device, Resource.Buffer, nullptr);
+			vkFreeMemory(GFXDevice.Device, Resource.DeviceMemory, nullptr);
+		}
+		for (ImageResource& Resource : Registry.Images.Dense)
+		{
+			DestroyTexture(GFXDevice, Resource.Image);
+		}
+		for (PipelineResource& Resource : Registry.Pipelines.Dense)
+		{
+			vkDestroyPipeline(GFXDevice.Device, Resource.Pipeline.Pipeline, nullptr);
+		}
+		Registry = ResourceRegistry();
+	}
+}
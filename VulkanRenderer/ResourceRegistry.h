@@ -0,0 +1,63 @@
+#pragma once
+
+#include "vulkan\vulkan.h"
+#include "ResourceHandles.h"
+#include "VulkanInitializers.h"
+#include "VulkanTextures.h"
+
+namespace VulkanCore
+{
+	struct DeletionQueue;
+
+	struct BufferResource
+	{
+		VkBuffer Buffer = VK_NULL_HANDLE;
+		VkDeviceMemory DeviceMemory = VK_NULL_HANDLE;
+		VkDeviceSize Size = 0;
+	};
+
+	struct ImageResource
+	{
+		Texture Image;
+		VkDeviceSize Size = 0;
+	};
+
+	struct PipelineResource
+	{
+		PipelineData Pipeline;
+	};
+
+	//Owns GPU objects behind generational handles, code that keeps a handle instead of a raw VkBuffer / VkPipeline
+	//sees replacements (hot reload, streamed mips) and can tell when what it points at is gone
+	struct ResourceRegistry
+	{
+		ResourcePool<BufferResource> Buffers;
+		ResourcePool<ImageResource> Images;
+		ResourcePool<PipelineResource> Pipelines;
+	};
+
+	//Registering hands ownership to the registry, Size is the bytes of device memory the resource accounts for
+	BufferHandle RegisterBuffer(ResourceRegistry& Registry, VkBuffer Buffer, VkDeviceMemory DeviceMemory, const VkDeviceSize Size);
+	ImageHandle RegisterImage(ResourceRegistry& Registry, const Texture& Image, const VkDeviceSize Size);
+	PipelineHandle RegisterPipeline(ResourceRegistry& Registry, const PipelineData& Pipeline);
+
+	inline const BufferResource& GetBuffer(const ResourceRegistry& Registry, const BufferHandle Handle) { return GetFromPool(Registry.Buffers, Handle); }
+	inline const ImageResource& GetImage(const ResourceRegistry& Registry, const ImageHandle Handle) { return GetFromPool(Registry.Images, Handle); }
+	inline const PipelineData& GetPipeline(const ResourceRegistry& Registry, const PipelineHandle Handle) { return GetFromPool(Registry.Pipelines, Handle).Pipeline; }
+
+	//Swaps in new contents under the same handle, the old objects go to Deletions
+	void ReplaceImage(ResourceRegistry& Registry, DeletionQueue& Deletions, const ImageHandle Handle, const Texture& Image, const VkDeviceSize Size);
+	void ReplacePipeline(ResourceRegistry& Registry, DeletionQueue& Deletions, const PipelineHandle Handle, const PipelineData& Pipeline);
+
+	//Invalidates the handle now, the objects are destroyed once frames using them have completed
+	//Releasing a stale handle (e.g. twice) is ignored
+	void ReleaseBuffer(ResourceRegistry& Registry, DeletionQueue& Deletions, const BufferHandle Handle);
+	void ReleaseImage(ResourceRegistry& Registry, DeletionQueue& Deletions, const ImageHandle Handle);
+	void ReleasePipeline(ResourceRegistry& Registry, DeletionQueue& Deletions, const PipelineHandle Handle);
+
+	//Live resources, device memory and registry overhead per resource type
+	void PrintResourceMemory(const ResourceRegistry& Registry);
+
+	//Device must be idle, destroys every resource still registered
+	void DestroyResourceRegistry(GraphicsDevice& GFXDevice, ResourceRegistry& Registry);
+}
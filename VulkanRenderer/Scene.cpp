@@ -0,0 +1,236 @@
+#include "Scene.h"
+#include <atomic>
+#include <algorithm>
+#include <cstring>
+
+namespace VulkanCore
+{
+	namespace
+	{
+		template<typename T>
+		void ApplyOrder(std::vector<T>& Array, const std::vector<uint32_t>& NewToOld)
+		{
+			std::vector<T> Sorted(Array.size());
+			for (size_t i = 0; i < NewToOld.size(); ++i)
+			{
+				Sorted[i] = Array[NewToOld[i]];
+			}
+			Array.swap(Sorted);
+		}
+
+		//Stable counting sort by depth, insertion order within a level is kept
+		void SortSceneByDepth(Scene& InScene)
+		{
+			const uint32_t NodeCount = static_cast<uint32_t> (InScene.Parents.size());
+			uint32_t LevelCount = 0;
+			for (uint32_t Depth : InScene.Depths)
+			{
+				LevelCount = std::max(LevelCount, Depth + 1);
+			}
+
+			InScene.LevelStarts.assign(LevelCount + 1, 0);
+			for (uint32_t Depth : InScene.Depths)
+			{
+				++InScene.LevelStarts[Depth + 1];
+			}
+			for (uint32_t Level = 0; Level < LevelCount; ++Level)
+			{
+				InScene.LevelStarts[Level + 1] += InScene.LevelStarts[Level];
+			}
+
+			InScene.bNeedsSort = false;
+
+			//Nodes added in depth order (e.g. level by level) only needed the level ranges
+			if (std::is_sorted(InScene.Depths.begin(), InScene.Depths.end()))
+			{
+				return;
+			}
+
+			std::vector<uint32_t> NewToOld(NodeCount);
+			std::vector<uint32_t> OldToNew(NodeCount);
+			std::vector<uint32_t> Next(InScene.LevelStarts.begin(), InScene.LevelStarts.end() - 1);
+			for (uint32_t Old = 0; Old < NodeCount; ++Old)
+			{
+				const uint32_t New = Next[InScene.Depths[Old]]++;
+				NewToOld[New] = Old;
+				OldToNew[Old] = New;
+			}
+
+			ApplyOrder(InScene.Parents, NewToOld);
+			ApplyOrder(InScene.Depths, NewToOld);
+			ApplyOrder(InScene.LocalTranslations, NewToOld);
+			ApplyOrder(InScene.LocalRotations, NewToOld);
+			ApplyOrder(InScene.LocalScales, NewToOld);
+			ApplyOrder(InScene.WorldMatrices, NewToOld);
+			ApplyOrder(InScene.LocalBounds, NewToOld);
+			ApplyOrder(InScene.WorldBounds, NewToOld);
+			ApplyOrder(InScene.RenderHandles, NewToOld);
+			ApplyOrder(InScene.Dirty, NewToOld);
+			ApplyOrder(InScene.IndexToId, NewToOld);
+
+			for (uint32_t& Parent : InScene.Parents)
+			{
+				Parent = Parent != SceneNone ? OldToNew[Parent] : SceneNone;
+			}
+			for (uint32_t Index = 0; Index < NodeCount; ++Index)
+			{
+				InScene.IdToIndex[InScene.IndexToId[Index]] = Index;
+			}
+		}
+
+		//Updates [Begin, End) of one level, parents are already final, returns how many nodes were dirty
+		uint32_t UpdateSceneRange(Scene& InScene, const uint32_t Begin, const uint32_t End)
+		{
+			uint32_t Updated = 0;
+			for (uint32_t i = Begin; i < End; ++i)
+			{
+				//A parent's flag already includes its own ancestors', they were processed first
+				const uint32_t Parent = InScene.Parents[i];
+				if (Parent != SceneNone && InScene.Dirty[Parent])
+				{
+					InScene.Dirty[i] = 1;
+				}
+				if (!InScene.Dirty[i])
+				{
+					continue;
+				}
+
+				const Mat4 Local = Mat4FromTRS(InScene.LocalTranslations[i], InScene.LocalRotations[i], InScene.LocalScales[i]);
+				InScene.WorldMatrices[i] = Parent != SceneNone ? Mat4Multiply(InScene.WorldMatrices[Parent], Local) : Local;
+				TransformAABBs(InScene.WorldMatrices[i], &InScene.LocalBounds[i], &InScene.WorldBounds[i], 1);
+				++Updated;
+			}
+			return Updated;
+		}
+
+		void FinishUpdate(Scene& InScene)
+		{
+			if (!InScene.Dirty.empty())
+			{
+				memset(InScene.Dirty.data(), 0, InScene.Dirty.size());
+			}
+			InScene.bAnyDirty = false;
+		}
+
+		//Box against every plane through the corner furthest along the plane's normal
+		bool IsBoxInFrustum(const AABB& Box, const Frustum& ViewFrustum)
+		{
+			for (int p = 0; p < 6; ++p)
+			{
+				const float* Plane = ViewFrustum.Planes[p];
+				const float X = Plane[0] >= 0.0f ? Box.Max.X : Box.Min.X;
+				const float Y = Plane[1] >= 0.0f ? Box.Max.Y : Box.Min.Y;
+				const float Z = Plane[2] >= 0.0f ? Box.Max.Z : Box.Min.Z;
+				if (Plane[0] * X + Plane[1] * Y + Plane[2] * Z + Plane[3] < 0.0f)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+	}
+
+	uint32_t AddSceneNode(Scene& InScene, const uint32_t Parent, const Vec3& Translation, const Quat& Rotation, const Vec3& Scale,
+		const AABB& LocalBounds, const uint32_t RenderHandle)
+	{
+		const uint32_t Id = static_cast<uint32_t> (InScene.IdToIndex.size());
+		const uint32_t Index = static_cast<uint32_t> (InScene.Parents.size());
+		const uint32_t ParentIndex = Parent != SceneNone ? InScene.IdToIndex[Parent] : SceneNone;
+
+		//Appending keeps parents before children, only the grouping by level needs the sort
+		InScene.Parents.push_back(ParentIndex);
+		InScene.Depths.push_back(ParentIndex != SceneNone ? InScene.Depths[ParentIndex] + 1 : 0);
+		InScene.LocalTranslations.push_back(Translation);
+		InScene.LocalRotations.push_back(Rotation);
+		InScene.LocalScales.push_back(Scale);
+		InScene.WorldMatrices.push_back(Mat4Identity());
+		InScene.LocalBounds.push_back(LocalBounds);
+		InScene.WorldBounds.push_back(LocalBounds);
+		InScene.RenderHandles.push_back(RenderHandle);
+		InScene.Dirty.push_back(1);
+		InScene.IdToIndex.push_back(Index);
+		InScene.IndexToId.push_back(Id);
+
+		InScene.bNeedsSort = true;
+		InScene.bAnyDirty = true;
+		return Id;
+	}
+
+	void SetSceneNodeTransform(Scene& InScene, const uint32_t Node, const Vec3& Translation, const Quat& Rotation, const Vec3& Scale)
+	{
+		const uint32_t Index = InScene.IdToIndex[Node];
+		InScene.LocalTranslations[Index] = Translation;
+		InScene.LocalRotations[Index] = Rotation;
+		InScene.LocalScales[Index] = Scale;
+		InScene.Dirty[Index] = 1;
+		InScene.bAnyDirty = true;
+	}
+
+	uint32_t UpdateScene(Scene& InScene)
+	{
+		if (InScene.bNeedsSort)
+		{
+			SortSceneByDepth(InScene);
+		}
+		if (!InScene.bAnyDirty)
+		{
+			return 0;
+		}
+
+		const uint32_t Updated = UpdateSceneRange(InScene, 0, static_cast<uint32_t> (InScene.Parents.size()));
+		FinishUpdate(InScene);
+		return Updated;
+	}
+
+	uint32_t UpdateSceneParallel(JobSystem& Jobs, Scene& InScene, const uint32_t BatchSize)
+	{
+		if (InScene.bNeedsSort)
+		{
+			SortSceneByDepth(InScene);
+		}
+		if (!InScene.bAnyDirty)
+		{
+			return 0;
+		}
+
+		std::atomic<uint32_t> Updated{ 0 };
+		for (size_t Level = 0; Level + 1 < InScene.LevelStarts.size(); ++Level)
+		{
+			const uint32_t Begin = InScene.LevelStarts[Level];
+			const uint32_t End = InScene.LevelStarts[Level + 1];
+
+			//Levels too small to split aren't worth the jobs
+			if (End - Begin <= BatchSize)
+			{
+				Updated += UpdateSceneRange(InScene, Begin, End);
+				continue;
+			}
+
+			JobCounter LevelDone;
+			ParallelFor(Jobs, End - Begin, BatchSize, [&InScene, &Updated, Begin](uint32_t First, uint32_t Last)
+			{
+				Updated += UpdateSceneRange(InScene, Begin + First, Begin + Last);
+			}, LevelDone);
+			WaitForCounter(Jobs, LevelDone);
+		}
+
+		FinishUpdate(InScene);
+		return Updated.load();
+	}
+
+	void CullScene(const Scene& InScene, const Frustum& ViewFrustum, SceneDrawList& OutDraws)
+	{
+		OutDraws.Nodes.clear();
+		OutDraws.RenderHandles.clear();
+
+		const uint32_t NodeCount = static_cast<uint32_t> (InScene.RenderHandles.size());
+		for (uint32_t i = 0; i < NodeCount; ++i)
+		{
+			if (InScene.RenderHandles[i] != SceneNone && IsBoxInFrustum(InScene.WorldBounds[i], ViewFrustum))
+			{
+				OutDraws.Nodes.push_back(i);
+				OutDraws.RenderHandles.push_back(InScene.RenderHandles[i]);
+			}
+		}
+	}
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "VectorMath.h"
+#include "JobSystem.h"
+#include <vector>
+
+namespace VulkanCore
+{
+	//Parent of root nodes and the render handle of nodes that draw nothing
+	static const uint32_t SceneNone = 0xFFFFFFFF;
+
+	//Scene nodes in structure of arrays form, every array indexed by the same node index
+	//Nodes are kept sorted by hierarchy depth, so parents always come before their children and each level is one contiguous range:
+	//world matrices update in one linear pass, and the levels can be split across jobs with a wait between them
+	//Indices change when the scene is sorted, outside code holds node ids instead (see AddSceneNode)
+	struct Scene
+	{
+		//Hierarchy, Parents holds node indices
+		std::vector<uint32_t> Parents;
+		std::vector<uint32_t> Depths;
+
+		//Local transform as set by the user and the matrix built from it
+		std::vector<Vec3> LocalTranslations;
+		std::vector<Quat> LocalRotations;
+		std::vector<Vec3> LocalScales;
+		std::vector<Mat4> WorldMatrices;
+
+		std::vector<AABB> LocalBounds;
+		std::vector<AABB> WorldBounds;
+
+		//Opaque to the scene (e.g. a mesh or draw index), SceneNone when the node draws nothing
+		std::vector<uint32_t> RenderHandles;
+
+		//Set when a node's local transform changes, spread to its subtree and cleared by the update
+		std::vector<uint8_t> Dirty;
+
+		//LevelStarts[d] is the first node of depth d, with one extra entry holding the node count
+		std::vector<uint32_t> LevelStarts;
+
+		//Id <-> index, ids stay valid across sorts
+		std::vector<uint32_t> IdToIndex;
+		std::vector<uint32_t> IndexToId;
+
+		//Nodes were added since the last sort, which also rebuilds LevelStarts
+		bool bNeedsSort = false;
+		bool bAnyDirty = false;
+	};
+
+	//Nodes visible to CullScene, ready to become draws
+	struct SceneDrawList
+	{
+		//Node index (for Scene::WorldMatrices) and render handle of every visible drawable node
+		std::vector<uint32_t> Nodes;
+		std::vector<uint32_t> RenderHandles;
+	};
+
+	//Returns the new node's id, Parent is the id of an existing node or SceneNone for a root
+	uint32_t AddSceneNode(Scene& InScene, const uint32_t Parent, const Vec3& Translation, const Quat& Rotation, const Vec3& Scale,
+		const AABB& LocalBounds, const uint32_t RenderHandle);
+
+	void SetSceneNodeTransform(Scene& InScene, const uint32_t Node, const Vec3& Translation, const Quat& Rotation, const Vec3& Scale);
+
+	//Index of Node in the arrays, valid until the next update that sorts
+	inline uint32_t GetSceneNodeIndex(const Scene& InScene, const uint32_t Node) { return InScene.IdToIndex[Node]; }
+
+	//Sorts by depth if nodes were added, then recomputes world matrices and bounds of dirty subtrees
+	//Returns the number of nodes updated
+	uint32_t UpdateScene(Scene& InScene);
+
+	//Same as UpdateScene with every level split into jobs of BatchSize nodes, levels run one after the other
+	uint32_t UpdateSceneParallel(JobSystem& Jobs, Scene& InScene, const uint32_t BatchSize = 1024);
+
+	//Frustum culls every drawable node's world bounds, after the update
+	void CullScene(const Scene& InScene, const Frustum& ViewFrustum, SceneDrawList& OutDraws);
+}
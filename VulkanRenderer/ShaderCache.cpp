@@ -0,0 +1,245 @@
+#include "ShaderCache.h"
+#include "VulkanInitializers.h"
+#include <iostream>
+#include <cstring>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace VulkanCore
+{
+	namespace
+	{
+		static const uint32_t SpirvMagic = 0x07230203;
+
+		//FNV-1a over the bytes, Code may be unaligned
+		uint64_t HashSpirv(const void* Code, const size_t Size)
+		{
+			const uint8_t* Bytes = static_cast<const uint8_t*> (Code);
+			uint64_t Hash = 14695981039346656037ull;
+			for (size_t i = 0; i < Size; ++i)
+			{
+				Hash = (Hash ^ Bytes[i]) * 1099511628211ull;
+			}
+			return Hash;
+		}
+
+		bool IsWordAligned(const void* Code, const size_t Size)
+		{
+			return reinterpret_cast<uintptr_t> (Code) % sizeof(uint32_t) == 0 && Size % sizeof(uint32_t) == 0;
+		}
+
+		//Returns the module for Code, Code must be valid SPIR-V
+		//When Mapping holds Code and is word aligned, a new module takes the mapping over (leaving Mapping empty) instead of copying it
+		VkShaderModule FindOrCreateModule(GraphicsDevice& GFXDevice, ShaderModuleCache& Cache, const void* Code, const size_t Size, MappedFile* Mapping)
+		{
+			const uint64_t Hash = HashSpirv(Code, Size);
+			std::vector<size_t>& Matches = Cache.ModulesByHash[Hash];
+			for (size_t Index : Matches)
+			{
+				const CachedShaderModule& Cached = Cache.Modules[Index];
+				if (Cached.WordCount * sizeof(uint32_t) == Size && memcmp(Cached.Code, Code, Size) == 0)
+				{
+					++Cache.CacheHits;
+					return Cached.Module;
+				}
+			}
+
+			CachedShaderModule NewModule;
+			NewModule.Hash = Hash;
+			NewModule.WordCount = Size / sizeof(uint32_t);
+			if (Mapping && IsWordAligned(Code, Size))
+			{
+				NewModule.Code = static_cast<const uint32_t*> (Code);
+			}
+			else
+			{
+				//Byte arrays make no alignment promise to vkCreateShaderModule
+				NewModule.OwnedCode.resize(NewModule.WordCount);
+				memcpy(NewModule.OwnedCode.data(), Code, Size);
+				NewModule.Code = NewModule.OwnedCode.data();
+			}
+
+			NewModule.Module = LoadShader(GFXDevice, NewModule.Code, Size);
+			if (NewModule.Module == VK_NULL_HANDLE)
+			{
+				return VK_NULL_HANDLE;
+			}
+
+			if (NewModule.OwnedCode.empty())
+			{
+				NewModule.File = *Mapping;
+				*Mapping = MappedFile();
+			}
+
+			//Moving keeps OwnedCode's storage, so Code stays valid
+			Matches.push_back(Cache.Modules.size());
+			Cache.Modules.push_back(std::move(NewModule));
+			++Cache.ModulesCreated;
+			return Cache.Modules.back().Module;
+		}
+	}
+
+	bool MapFile(const char* Path, MappedFile& Out)
+	{
+		Out = MappedFile();
+
+#ifdef _WIN32
+		HANDLE File = CreateFileA(Path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (File == INVALID_HANDLE_VALUE)
+		{
+			return false;
+		}
+
+		LARGE_INTEGER FileSize = {};
+		if (!GetFileSizeEx(File, &FileSize) || FileSize.QuadPart == 0)
+		{
+			CloseHandle(File);
+			return false;
+		}
+
+		HANDLE Mapping = CreateFileMappingA(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		const void* View = Mapping ? MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+		if (!View)
+		{
+			if (Mapping)
+			{
+				CloseHandle(Mapping);
+			}
+			CloseHandle(File);
+			return false;
+		}
+
+		Out.Data = static_cast<const uint8_t*> (View);
+		Out.Size = static_cast<size_t> (FileSize.QuadPart);
+		Out.File = File;
+		Out.Mapping = Mapping;
+#else
+		const int Descriptor = open(Path, O_RDONLY);
+		if (Descriptor < 0)
+		{
+			return false;
+		}
+
+		struct stat FileStat;
+		if (fstat(Descriptor, &FileStat) != 0 || FileStat.st_size == 0)
+		{
+			close(Descriptor);
+			return false;
+		}
+
+		void* View = mmap(nullptr, static_cast<size_t> (FileStat.st_size), PROT_READ, MAP_PRIVATE, Descriptor, 0);
+		if (View == MAP_FAILED)
+		{
+			close(Descriptor);
+			return false;
+		}
+
+		Out.Data = static_cast<const uint8_t*> (View);
+		Out.Size = static_cast<size_t> (FileStat.st_size);
+		Out.Descriptor = Descriptor;
+#endif
+		return true;
+	}
+
+	void UnmapFile(MappedFile& File)
+	{
+		if (!File.Data)
+		{
+			return;
+		}
+
+#ifdef _WIN32
+		UnmapViewOfFile(File.Data);
+		CloseHandle(File.Mapping);
+		CloseHandle(File.File);
+#else
+		munmap(const_cast<uint8_t*> (File.Data), File.Size);
+		close(File.Descriptor);
+#endif
+		File = MappedFile();
+	}
+
+	bool IsValidSpirv(const void* Code, const size_t Size)
+	{
+		if (!Code || Size < 5 * sizeof(uint32_t) || Size % sizeof(uint32_t) != 0)
+		{
+			return false;
+		}
+
+		uint32_t Magic = 0;
+		memcpy(&Magic, Code, sizeof(Magic));
+		return Magic == SpirvMagic;
+	}
+
+	VkShaderModule GetShaderModule(GraphicsDevice& GFXDevice, ShaderModuleCache& Cache, const void* Code, const size_t Size)
+	{
+		if (!IsValidSpirv(Code, Size))
+		{
+			std::cout << "Shader rejected: not SPIR-V (" << Size << " bytes)" << std::endl;
+			return VK_NULL_HANDLE;
+		}
+
+		return FindOrCreateModule(GFXDevice, Cache, Code, Size, nullptr);
+	}
+
+	VkShaderModule LoadShaderFile(GraphicsDevice& GFXDevice, ShaderModuleCache& Cache, const char* Path, const void* Fallback, const size_t FallbackSize)
+	{
+		MappedFile File;
+		if (MapFile(Path, File))
+		{
+			//A new module keeps an aligned view mapped, the view is only unmapped here when it was copied, deduplicated or rejected
+			VkShaderModule Module = VK_NULL_HANDLE;
+			if (IsValidSpirv(File.Data, File.Size))
+			{
+				Module = FindOrCreateModule(GFXDevice, Cache, File.Data, File.Size, &File);
+			}
+			else
+			{
+				std::cout << "Invalid SPIR-V file: " << Path << std::endl;
+			}
+			UnmapFile(File);
+
+			if (Module != VK_NULL_HANDLE)
+			{
+				return Module;
+			}
+		}
+		else
+		{
+			std::cout << "Failed to open shader: " << Path << std::endl;
+		}
+
+		return Fallback ? GetShaderModule(GFXDevice, Cache, Fallback, FallbackSize) : VK_NULL_HANDLE;
+	}
+
+	const CachedShaderModule* FindCachedShader(const ShaderModuleCache& Cache, VkShaderModule Module)
+	{
+		for (const CachedShaderModule& Cached : Cache.Modules)
+		{
+			if (Cached.Module == Module)
+			{
+				return &Cached;
+			}
+		}
+		return nullptr;
+	}
+
+	void DestroyShaderModuleCache(GraphicsDevice& GFXDevice, ShaderModuleCache& Cache)
+	{
+		for (CachedShaderModule& Cached : Cache.Modules)
+		{
+			vkDestroyShaderModule(GFXDevice.Device, Cached.Module, nullptr);
+			UnmapFile(Cached.File);
+		}
+		Cache = ShaderModuleCache();
+	}
+}
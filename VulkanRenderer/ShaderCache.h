@@ -0,0 +1,71 @@
+#pragma once
+
+#include "vulkan\vulkan.h"
+#include <vector>
+#include <unordered_map>
+
+namespace VulkanCore
+{
+	struct GraphicsDevice;
+
+	//Read only view of a whole file mapped into memory, page aligned
+	struct MappedFile
+	{
+		const uint8_t* Data = nullptr;
+		size_t Size = 0;
+
+#ifdef _WIN32
+		void* File = nullptr;
+		void* Mapping = nullptr;
+#else
+		int Descriptor = -1;
+#endif
+	};
+
+	//Returns false (and leaves Out empty) when the file can't be opened or is empty
+	bool MapFile(const char* Path, MappedFile& Out);
+
+	void UnmapFile(MappedFile& File);
+
+	//Size is a non-zero multiple of 4 starting with the SPIR-V magic number, Code may have any alignment
+	bool IsValidSpirv(const void* Code, const size_t Size);
+
+	//A module and the word aligned SPIR-V it was made from, kept for deduplication and reflection
+	//Code points into File when the file's view was word aligned, into a copy in OwnedCode otherwise
+	struct CachedShaderModule
+	{
+		VkShaderModule Module = VK_NULL_HANDLE;
+		uint64_t Hash = 0;
+		const uint32_t* Code = nullptr;
+		size_t WordCount = 0;
+
+		MappedFile File;
+		std::vector<uint32_t> OwnedCode;
+	};
+
+	//Shader modules deduplicated by content: identical SPIR-V, whatever file or array it came from, is only created once
+	//The cache owns every module it hands out
+	struct ShaderModuleCache
+	{
+		std::vector<CachedShaderModule> Modules;
+
+		//Content hash -> indices into Modules, the code is compared on a hash match
+		std::unordered_map<uint64_t, std::vector<size_t>> ModulesByHash;
+
+		uint32_t ModulesCreated = 0;
+		uint32_t CacheHits = 0;
+	};
+
+	//Returns the module for Code, creating it on first sight, VK_NULL_HANDLE when Code isn't valid SPIR-V
+	VkShaderModule GetShaderModule(GraphicsDevice& GFXDevice, ShaderModuleCache& Cache, const void* Code, const size_t Size);
+
+	//Maps a .spv file and returns its module, or the module for Fallback (e.g. a compiled-in array) when the file is missing or invalid
+	//A word aligned view is handed to the driver as is and stays mapped while the cache holds the module, only unaligned views are copied
+	VkShaderModule LoadShaderFile(GraphicsDevice& GFXDevice, ShaderModuleCache& Cache, const char* Path, const void* Fallback = nullptr, const size_t FallbackSize = 0);
+
+	//SPIR-V a module of the cache was created from, nullptr for modules from elsewhere
+	const CachedShaderModule* FindCachedShader(const ShaderModuleCache& Cache, VkShaderModule Module);
+
+	//Device must be idle, unmaps the files modules were read from
+	void DestroyShaderModuleCache(GraphicsDevice& GFXDevice, ShaderModuleCache& Cache);
+}
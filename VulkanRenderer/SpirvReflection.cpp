@@ -0,0 +1,492 @@
+#include "SpirvReflection.h"
+#include <iostream>
+#include <algorithm>
+
+namespace VulkanCore
+{
+	namespace
+	{
+		//The subset of the SPIR-V grammar reflection needs
+		enum SpirvOp : uint32_t
+		{
+			OpEntryPoint = 15,
+			OpTypeInt = 21,
+			OpTypeFloat = 22,
+			OpTypeVector = 23,
+			OpTypeMatrix = 24,
+			OpTypeImage = 25,
+			OpTypeSampler = 26,
+			OpTypeSampledImage = 27,
+			OpTypeArray = 28,
+			OpTypeRuntimeArray = 29,
+			OpTypeStruct = 30,
+			OpTypePointer = 32,
+			OpConstant = 43,
+			OpVariable = 59,
+			OpDecorate = 71,
+			OpMemberDecorate = 72,
+		};
+
+		enum SpirvDecoration : uint32_t
+		{
+			DecorationSpecId = 1,
+			DecorationBlock = 2,
+			DecorationBufferBlock = 3,
+			DecorationArrayStride = 6,
+			DecorationMatrixStride = 7,
+			DecorationBuiltIn = 11,
+			DecorationLocation = 30,
+			DecorationBinding = 33,
+			DecorationDescriptorSet = 34,
+			DecorationOffset = 35,
+		};
+
+		enum SpirvStorageClass : uint32_t
+		{
+			StorageUniformConstant = 0,
+			StorageInput = 1,
+			StorageUniform = 2,
+			StoragePushConstant = 9,
+			StorageStorageBuffer = 12,
+		};
+
+		static const uint32_t NotDecorated = 0xFFFFFFFF;
+
+		struct SpirvMember
+		{
+			uint32_t Offset = 0;
+			uint32_t MatrixStride = 0;
+		};
+
+		//Everything known about one result id
+		struct SpirvId
+		{
+			//Word index of the instruction that defined it, 0 when undefined (the header occupies word 0)
+			size_t Definition = 0;
+
+			uint32_t Location = NotDecorated;
+			uint32_t Binding = NotDecorated;
+			uint32_t Set = NotDecorated;
+			uint32_t ArrayStride = 0;
+			bool bBuiltIn = false;
+			bool bBlock = false;
+			bool bBufferBlock = false;
+			std::vector<SpirvMember> Members;
+		};
+
+		struct SpirvModule
+		{
+			const uint32_t* Code = nullptr;
+			size_t WordCount = 0;
+			std::vector<SpirvId> Ids;
+
+			uint32_t Opcode(const uint32_t Id) const { return Id < Ids.size() && Ids[Id].Definition ? Code[Ids[Id].Definition] & 0xFFFF : 0; }
+			uint32_t Operand(const uint32_t Id, const uint32_t Index) const { return Code[Ids[Id].Definition + 1 + Index]; }
+			uint32_t OperandCount(const uint32_t Id) const { return (Code[Ids[Id].Definition] >> 16) - 1; }
+		};
+
+		SpirvMember& GetMember(SpirvModule& Module, const uint32_t Id, const uint32_t Member)
+		{
+			std::vector<SpirvMember>& Members = Module.Ids[Id].Members;
+			if (Members.size() <= Member)
+			{
+				Members.resize(Member + 1);
+			}
+			return Members[Member];
+		}
+
+		//Byte size under the layout the decorations describe, MatrixStride comes from the enclosing struct member
+		uint32_t GetTypeSize(const SpirvModule& Module, const uint32_t Type, const uint32_t MatrixStride)
+		{
+			switch (Module.Opcode(Type))
+			{
+			case OpTypeInt:
+			case OpTypeFloat:
+				return Module.Operand(Type, 1) / 8;
+			case OpTypeVector:
+				return Module.Operand(Type, 2) * GetTypeSize(Module, Module.Operand(Type, 1), 0);
+			case OpTypeMatrix:
+				return Module.Operand(Type, 2) * (MatrixStride ? MatrixStride : GetTypeSize(Module, Module.Operand(Type, 1), 0));
+			case OpTypeArray:
+			{
+				const uint32_t Length = Module.Operand(Module.Operand(Type, 2), 2);
+				const uint32_t Stride = Module.Ids[Type].ArrayStride;
+				return Length * (Stride ? Stride : GetTypeSize(Module, Module.Operand(Type, 1), MatrixStride));
+			}
+			case OpTypeStruct:
+			{
+				uint32_t Size = 0;
+				const std::vector<SpirvMember>& Members = Module.Ids[Type].Members;
+				for (uint32_t i = 0; i < Module.OperandCount(Type) - 1 && i < Members.size(); ++i)
+				{
+					Size = std::max(Size, Members[i].Offset + GetTypeSize(Module, Module.Operand(Type, 1 + i), Members[i].MatrixStride));
+				}
+				return Size;
+			}
+			default:
+				return 0;
+			}
+		}
+
+		VkFormat GetInputFormat(const SpirvModule& Module, const uint32_t Type)
+		{
+			uint32_t Components = 1;
+			uint32_t Scalar = Type;
+			if (Module.Opcode(Type) == OpTypeVector)
+			{
+				Components = Module.Operand(Type, 2);
+				Scalar = Module.Operand(Type, 1);
+			}
+			if (Module.Operand(Scalar, 1) != 32 || Components < 1 || Components > 4)
+			{
+				return VK_FORMAT_UNDEFINED;
+			}
+
+			static const VkFormat FloatFormats[4] = { VK_FORMAT_R32_SFLOAT, VK_FORMAT_R32G32_SFLOAT, VK_FORMAT_R32G32B32_SFLOAT, VK_FORMAT_R32G32B32A32_SFLOAT };
+			static const VkFormat IntFormats[4] = { VK_FORMAT_R32_SINT, VK_FORMAT_R32G32_SINT, VK_FORMAT_R32G32B32_SINT, VK_FORMAT_R32G32B32A32_SINT };
+			static const VkFormat UintFormats[4] = { VK_FORMAT_R32_UINT, VK_FORMAT_R32G32_UINT, VK_FORMAT_R32G32B32_UINT, VK_FORMAT_R32G32B32A32_UINT };
+			switch (Module.Opcode(Scalar))
+			{
+			case OpTypeFloat:
+				return FloatFormats[Components - 1];
+			case OpTypeInt:
+				return Module.Operand(Scalar, 2) ? IntFormats[Components - 1] : UintFormats[Components - 1];
+			default:
+				return VK_FORMAT_UNDEFINED;
+			}
+		}
+
+		uint32_t GetFormatSize(const VkFormat Format)
+		{
+			switch (Format)
+			{
+			case VK_FORMAT_R32_SFLOAT: case VK_FORMAT_R32_SINT: case VK_FORMAT_R32_UINT: return 4;
+			case VK_FORMAT_R32G32_SFLOAT: case VK_FORMAT_R32G32_SINT: case VK_FORMAT_R32G32_UINT: return 8;
+			case VK_FORMAT_R32G32B32_SFLOAT: case VK_FORMAT_R32G32B32_SINT: case VK_FORMAT_R32G32B32_UINT: return 12;
+			case VK_FORMAT_R32G32B32A32_SFLOAT: case VK_FORMAT_R32G32B32A32_SINT: case VK_FORMAT_R32G32B32A32_UINT: return 16;
+			default: return 0;
+			}
+		}
+
+		//Descriptor type of a resource variable's (array-stripped) type, VK_DESCRIPTOR_TYPE_MAX_ENUM when it isn't one
+		VkDescriptorType GetDescriptorType(const SpirvModule& Module, const uint32_t Type, const uint32_t StorageClass)
+		{
+			switch (Module.Opcode(Type))
+			{
+			case OpTypeSampler:
+				return VK_DESCRIPTOR_TYPE_SAMPLER;
+			case OpTypeSampledImage:
+				return VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+			case OpTypeImage:
+			{
+				//Operands: sampled type, dim, depth, arrayed, multisampled, sampled (1 with a sampler, 2 storage)
+				static const uint32_t DimBuffer = 5;
+				static const uint32_t DimSubpassData = 6;
+				const uint32_t Dim = Module.Operand(Type, 2);
+				const bool bStorage = Module.Operand(Type, 6) == 2;
+				if (Dim == DimBuffer)
+				{
+					return bStorage ? VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER : VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER;
+				}
+				if (Dim == DimSubpassData)
+				{
+					return VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT;
+				}
+				return bStorage ? VK_DESCRIPTOR_TYPE_STORAGE_IMAGE : VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+			}
+			case OpTypeStruct:
+				if (StorageClass == StorageStorageBuffer || Module.Ids[Type].bBufferBlock)
+				{
+					return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+				}
+				return StorageClass == StorageUniform ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER : VK_DESCRIPTOR_TYPE_MAX_ENUM;
+			default:
+				return VK_DESCRIPTOR_TYPE_MAX_ENUM;
+			}
+		}
+
+		VkShaderStageFlagBits GetStage(const uint32_t ExecutionModel)
+		{
+			switch (ExecutionModel)
+			{
+			case 1: return VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT;
+			case 2: return VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT;
+			case 3: return VK_SHADER_STAGE_GEOMETRY_BIT;
+			case 4: return VK_SHADER_STAGE_FRAGMENT_BIT;
+			case 5: return VK_SHADER_STAGE_COMPUTE_BIT;
+			default: return VK_SHADER_STAGE_VERTEX_BIT;
+			}
+		}
+	}
+
+	ShaderReflection ReflectSpirv(const uint32_t* Code, const size_t WordCount)
+	{
+		ShaderReflection RetVal;
+		static const uint32_t SpirvMagic = 0x07230203;
+		static const size_t HeaderWords = 5;
+		if (!Code || WordCount < HeaderWords || Code[0] != SpirvMagic)
+		{
+			std::cout << "SPIR-V reflection failed: not a SPIR-V module" << std::endl;
+			return RetVal;
+		}
+
+		SpirvModule Module;
+		Module.Code = Code;
+		Module.WordCount = WordCount;
+		Module.Ids.resize(Code[3]);
+
+		//First pass: where every id is defined, its decorations, entry points and global variables
+		std::vector<size_t> Variables;
+		for (size_t Word = HeaderWords; Word < WordCount;)
+		{
+			const uint32_t Opcode = Code[Word] & 0xFFFF;
+			const uint32_t Length = Code[Word] >> 16;
+			if (Length == 0 || Word + Length > WordCount)
+			{
+				std::cout << "SPIR-V reflection failed: truncated instruction at word " << Word << std::endl;
+				return RetVal;
+			}
+			const uint32_t* Operands = Code + Word + 1;
+
+			switch (Opcode)
+			{
+			case OpEntryPoint:
+			{
+				ReflectedEntryPoint EntryPoint;
+				EntryPoint.Stage = GetStage(Operands[0]);
+				EntryPoint.Name = reinterpret_cast<const char*> (Operands + 2);
+				RetVal.EntryPoints.push_back(EntryPoint);
+				RetVal.Stages |= EntryPoint.Stage;
+				break;
+			}
+			case OpTypeInt: case OpTypeFloat: case OpTypeVector: case OpTypeMatrix: case OpTypeImage: case OpTypeSampler:
+			case OpTypeSampledImage: case OpTypeArray: case OpTypeRuntimeArray: case OpTypeStruct: case OpTypePointer:
+				//Result id is the first operand of type declarations
+				if (Operands[0] < Module.Ids.size())
+				{
+					Module.Ids[Operands[0]].Definition = Word;
+				}
+				break;
+			case OpConstant:
+			case OpVariable:
+				//Result type, then result id
+				if (Operands[1] < Module.Ids.size())
+				{
+					Module.Ids[Operands[1]].Definition = Word;
+				}
+				if (Opcode == OpVariable)
+				{
+					Variables.push_back(Word);
+				}
+				break;
+			case OpDecorate:
+				if (Operands[0] < Module.Ids.size())
+				{
+					SpirvId& Target = Module.Ids[Operands[0]];
+					const uint32_t Value = Length > 3 ? Operands[2] : 0;
+					switch (Operands[1])
+					{
+					case DecorationSpecId: RetVal.SpecConstantIds.push_back(Value); break;
+					case DecorationBlock: Target.bBlock = true; break;
+					case DecorationBufferBlock: Target.bBufferBlock = true; break;
+					case DecorationArrayStride: Target.ArrayStride = Value; break;
+					case DecorationBuiltIn: Target.bBuiltIn = true; break;
+					case DecorationLocation: Target.Location = Value; break;
+					case DecorationBinding: Target.Binding = Value; break;
+					case DecorationDescriptorSet: Target.Set = Value; break;
+					default: break;
+					}
+				}
+				break;
+			case OpMemberDecorate:
+				if (Operands[0] < Module.Ids.size() && Length > 4)
+				{
+					if (Operands[2] == DecorationOffset)
+					{
+						GetMember(Module, Operands[0], Operands[1]).Offset = Operands[3];
+					}
+					else if (Operands[2] == DecorationMatrixStride)
+					{
+						GetMember(Module, Operands[0], Operands[1]).MatrixStride = Operands[3];
+					}
+				}
+				break;
+			default:
+				break;
+			}
+			Word += Length;
+		}
+
+		//Second pass over the globals, now that every type is known
+		uint32_t PushBegin = UINT32_MAX;
+		uint32_t PushEnd = 0;
+		for (size_t Word : Variables)
+		{
+			const uint32_t PointerType = Code[Word + 1];
+			const uint32_t Id = Code[Word + 2];
+			const uint32_t StorageClass = Code[Word + 3];
+			if (Module.Opcode(PointerType) != OpTypePointer)
+			{
+				continue;
+			}
+			uint32_t Type = Module.Operand(PointerType, 2);
+			const SpirvId& Variable = Module.Ids[Id];
+
+			if (StorageClass == StorageInput)
+			{
+				if (!Variable.bBuiltIn && Variable.Location != NotDecorated)
+				{
+					ReflectedInput Input;
+					Input.Location = Variable.Location;
+					Input.Format = GetInputFormat(Module, Type);
+					RetVal.Inputs.push_back(Input);
+				}
+			}
+			else if (StorageClass == StoragePushConstant)
+			{
+				//Only the members the block declares, the range starts at the first one (blocks often skip other stages' bytes)
+				const std::vector<SpirvMember>& Members = Module.Ids[Type].Members;
+				for (uint32_t i = 0; i < Members.size() && i + 1 < Module.OperandCount(Type); ++i)
+				{
+					PushBegin = std::min(PushBegin, Members[i].Offset);
+					PushEnd = std::max(PushEnd, Members[i].Offset + GetTypeSize(Module, Module.Operand(Type, 1 + i), Members[i].MatrixStride));
+				}
+			}
+			else if (StorageClass == StorageUniformConstant || StorageClass == StorageUniform || StorageClass == StorageStorageBuffer)
+			{
+				ReflectedBinding Binding;
+				Binding.Set = Variable.Set != NotDecorated ? Variable.Set : 0;
+				Binding.Binding = Variable.Binding != NotDecorated ? Variable.Binding : 0;
+				if (Module.Opcode(Type) == OpTypeArray)
+				{
+					Binding.Count = Module.Operand(Module.Operand(Type, 2), 2);
+					Type = Module.Operand(Type, 1);
+				}
+				else if (Module.Opcode(Type) == OpTypeRuntimeArray)
+				{
+					Binding.Count = 0;
+					Binding.bRuntimeArray = true;
+					Type = Module.Operand(Type, 1);
+				}
+				Binding.Type = GetDescriptorType(Module, Type, StorageClass);
+				if (Binding.Type != VK_DESCRIPTOR_TYPE_MAX_ENUM)
+				{
+					RetVal.Bindings.push_back(Binding);
+				}
+			}
+		}
+
+		if (PushEnd > 0)
+		{
+			RetVal.PushConstantOffset = PushBegin;
+			RetVal.PushConstantSize = PushEnd - PushBegin;
+		}
+
+		std::sort(RetVal.SpecConstantIds.begin(), RetVal.SpecConstantIds.end());
+		std::sort(RetVal.Inputs.begin(), RetVal.Inputs.end(), [](const ReflectedInput& A, const ReflectedInput& B) { return A.Location < B.Location; });
+		std::sort(RetVal.Bindings.begin(), RetVal.Bindings.end(), [](const ReflectedBinding& A, const ReflectedBinding& B)
+		{
+			return A.Set != B.Set ? A.Set < B.Set : A.Binding < B.Binding;
+		});
+
+		RetVal.bValid = true;
+		return RetVal;
+	}
+
+	VertexInputLayout BuildVertexInputLayout(const ShaderReflection& VertexShader)
+	{
+		VertexInputLayout RetVal;
+		uint32_t Offset = 0;
+		for (const ReflectedInput& Input : VertexShader.Inputs)
+		{
+			if (Input.Format == VK_FORMAT_UNDEFINED)
+			{
+				std::cout << "Vertex input at location " << Input.Location << " has no attribute format" << std::endl;
+				continue;
+			}
+
+			VkVertexInputAttributeDescription Attribute = {};
+			Attribute.location = Input.Location;
+			Attribute.binding = 0;
+			Attribute.format = Input.Format;
+			Attribute.offset = Offset;
+			RetVal.Attributes.push_back(Attribute);
+			Offset += GetFormatSize(Input.Format);
+		}
+
+		if (!RetVal.Attributes.empty())
+		{
+			VkVertexInputBindingDescription Binding = {};
+			Binding.binding = 0;
+			Binding.stride = Offset;
+			Binding.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+			RetVal.Bindings.push_back(Binding);
+		}
+		return RetVal;
+	}
+
+	PipelineLayoutDesc BuildReflectedLayout(GraphicsDevice& GFXDevice, DescriptorLayoutCache& Cache, const std::vector<const ShaderReflection*>& Stages,
+		const std::vector<VkDescriptorSetLayout>& SetOverrides)
+	{
+		//Bindings per set, a binding used by several stages is visible to all of them
+		std::vector<std::vector<VkDescriptorSetLayoutBinding>> Sets(SetOverrides.size());
+		for (const ShaderReflection* Stage : Stages)
+		{
+			for (const ReflectedBinding& Reflected : Stage->Bindings)
+			{
+				if (Sets.size() <= Reflected.Set)
+				{
+					Sets.resize(Reflected.Set + 1);
+				}
+				if (Reflected.Set < SetOverrides.size() && SetOverrides[Reflected.Set] != VK_NULL_HANDLE)
+				{
+					continue;
+				}
+				if (Reflected.bRuntimeArray)
+				{
+					std::cout << "Set " << Reflected.Set << " binding " << Reflected.Binding << " is a runtime array, its set layout must be overridden" << std::endl;
+					continue;
+				}
+
+				std::vector<VkDescriptorSetLayoutBinding>& Bindings = Sets[Reflected.Set];
+				auto Existing = std::find_if(Bindings.begin(), Bindings.end(),
+					[&Reflected](const VkDescriptorSetLayoutBinding& Binding) { return Binding.binding == Reflected.Binding; });
+				if (Existing != Bindings.end())
+				{
+					if (Existing->descriptorType != Reflected.Type)
+					{
+						std::cout << "Set " << Reflected.Set << " binding " << Reflected.Binding << " has different descriptor types across stages" << std::endl;
+					}
+					Existing->stageFlags |= Stage->Stages;
+					Existing->descriptorCount = std::max(Existing->descriptorCount, Reflected.Count);
+					continue;
+				}
+
+				VkDescriptorSetLayoutBinding Binding = {};
+				Binding.binding = Reflected.Binding;
+				Binding.descriptorType = Reflected.Type;
+				Binding.descriptorCount = Reflected.Count;
+				Binding.stageFlags = Stage->Stages;
+				Bindings.push_back(Binding);
+			}
+		}
+
+		//Sets nothing uses still need a (empty) layout when a later set is used
+		PipelineLayoutDesc RetVal;
+		for (uint32_t Set = 0; Set < Sets.size(); ++Set)
+		{
+			const bool bOverridden = Set < SetOverrides.size() && SetOverrides[Set] != VK_NULL_HANDLE;
+			RetVal.SetLayouts.push_back(bOverridden ? SetOverrides[Set] : GetDescriptorSetLayout(GFXDevice, Cache, Sets[Set]));
+		}
+
+		//Every stage appears in at most one range, so each shader's block becomes its own range
+		for (const ShaderReflection* Stage : Stages)
+		{
+			if (Stage->PushConstantSize > 0 && !AddPushConstantRange(GFXDevice, RetVal, Stage->Stages, Stage->PushConstantOffset, Stage->PushConstantSize))
+			{
+				std::cout << "Push constant block (" << Stage->PushConstantOffset + Stage->PushConstantSize << " bytes) exceeds maxPushConstantsSize" << std::endl;
+			}
+		}
+		return RetVal;
+	}
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "vulkan\vulkan.h"
+#include "VulkanInitializers.h"
+#include "Descriptors.h"
+#include <vector>
+#include <string>
+
+namespace VulkanCore
+{
+	struct ReflectedEntryPoint
+	{
+		std::string Name;
+		VkShaderStageFlagBits Stage = VK_SHADER_STAGE_VERTEX_BIT;
+	};
+
+	//Stage input with a Location (built-ins are skipped), Format is VK_FORMAT_UNDEFINED for types a vertex attribute can't have
+	struct ReflectedInput
+	{
+		uint32_t Location = 0;
+		VkFormat Format = VK_FORMAT_UNDEFINED;
+	};
+
+	struct ReflectedBinding
+	{
+		uint32_t Set = 0;
+		uint32_t Binding = 0;
+		VkDescriptorType Type = VK_DESCRIPTOR_TYPE_MAX_ENUM;
+		uint32_t Count = 1;
+
+		//Unsized array (bindless style), Count is 0 and the set layout has to come from its owner
+		bool bRuntimeArray = false;
+	};
+
+	//Interface of one shader module, read straight from its SPIR-V
+	struct ShaderReflection
+	{
+		bool bValid = false;
+		std::vector<ReflectedEntryPoint> EntryPoints;
+		VkShaderStageFlags Stages = 0;
+
+		//Sorted by location
+		std::vector<ReflectedInput> Inputs;
+
+		//Sorted by set then binding
+		std::vector<ReflectedBinding> Bindings;
+
+		//constant_id of every specialization constant, sorted
+		std::vector<uint32_t> SpecConstantIds;
+
+		//Bytes of the push constant block the shader actually reads, Size 0 without one
+		uint32_t PushConstantOffset = 0;
+		uint32_t PushConstantSize = 0;
+	};
+
+	//Parses Code (WordCount words), bValid is false when it isn't SPIR-V
+	ShaderReflection ReflectSpirv(const uint32_t* Code, const size_t WordCount);
+
+	inline ShaderReflection ReflectSpirv(const std::vector<uint32_t>& Code) { return ReflectSpirv(Code.data(), Code.size()); }
+
+	//One interleaved vertex buffer at binding 0, attributes packed in location order
+	VertexInputLayout BuildVertexInputLayout(const ShaderReflection& VertexShader);
+
+	//Merges the bindings and push constant blocks of every stage of a pipeline into a layout description
+	//Set layouts come from Cache, except for sets with a non-null entry in SetOverrides, which are used as given
+	//(bindless tables, dynamic uniform buffers: what the shader can't express)
+	PipelineLayoutDesc BuildReflectedLayout(GraphicsDevice& GFXDevice, DescriptorLayoutCache& Cache, const std::vector<const ShaderReflection*>& Stages,
+		const std::vector<VkDescriptorSetLayout>& SetOverrides = std::vector<VkDescriptorSetLayout>());
+}
@@ -0,0 +1,224 @@
+#include "Sync.h"
+#include "VulkanInitializers.h"
+#include "VulkanFunctionPointers.h"
+#include <iostream>
+#include <algorithm>
+
+namespace VulkanCore
+{
+	namespace
+	{
+		//Fallback: retires fences from the front while they're signaled, or waits on them when bWait
+		void RetireFences(GraphicsDevice& GFXDevice, QueueTimeline& Timeline, const uint64_t Value, const bool bWait, const uint64_t Timeout)
+		{
+			while (!Timeline.PendingFences.empty())
+			{
+				const std::pair<uint64_t, VkFence>& Front = Timeline.PendingFences.front();
+				if (!bWait && vkGetFenceStatus(GFXDevice.Device, Front.second) != VK_SUCCESS)
+				{
+					return;
+				}
+				if (bWait)
+				{
+					if (Front.first > Value)
+					{
+						return;
+					}
+					if (vkWaitForFences(GFXDevice.Device, 1, &Front.second, VK_TRUE, Timeout) != VK_SUCCESS)
+					{
+						return;
+					}
+				}
+
+				Timeline.LastCompleted = Front.first;
+				vkResetFences(GFXDevice.Device, 1, &Front.second);
+				Timeline.FreeFences.push_back(Front.second);
+				Timeline.PendingFences.pop_front();
+			}
+		}
+	}
+
+	QueueTimeline CreateQueueTimeline(GraphicsDevice& GFXDevice, VkQueue Queue)
+	{
+		QueueTimeline RetVal;
+		RetVal.Queue = Queue;
+
+		if (!GFXDevice.bSupportsTimelineSemaphores)
+		{
+			return RetVal;
+		}
+
+		VkSemaphoreTypeCreateInfoKHR TypeCreateInfo = {};
+		TypeCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+		TypeCreateInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+		TypeCreateInfo.initialValue = 0;
+
+		VkSemaphoreCreateInfo SemaphoreCreateInfo = {};
+		SemaphoreCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+		SemaphoreCreateInfo.pNext = &TypeCreateInfo;
+
+		VkResult R = vkCreateSemaphore(GFXDevice.Device, &SemaphoreCreateInfo, nullptr, &RetVal.Semaphore);
+		if (R != VK_SUCCESS)
+		{
+			std::cout << "Timeline semaphore creation failed with error: " << R << std::endl;
+		}
+
+		return RetVal;
+	}
+
+	void AddTimelineWait(TimelineSubmitInfo& SubmitInfo, const QueueTimeline& Timeline, const uint64_t Value, const VkPipelineStageFlags Stages)
+	{
+		if (Value == 0)
+		{
+			return;
+		}
+
+		//Two waits on one timeline collapse into the later value
+		for (TimelineWait& Wait : SubmitInfo.TimelineWaits)
+		{
+			if (Wait.Timeline == &Timeline)
+			{
+				Wait.Value = std::max(Wait.Value, Value);
+				Wait.Stages |= Stages;
+				return;
+			}
+		}
+
+		TimelineWait Wait;
+		Wait.Timeline = &Timeline;
+		Wait.Value = Value;
+		Wait.Stages = Stages;
+		SubmitInfo.TimelineWaits.push_back(Wait);
+	}
+
+	uint64_t SubmitToTimeline(GraphicsDevice& GFXDevice, QueueTimeline& Timeline, const TimelineSubmitInfo& SubmitInfo)
+	{
+		const uint64_t Value = ++Timeline.LastSubmitted;
+
+		//Binary semaphores first, their entries in the value arrays are ignored
+		std::vector<VkSemaphore> WaitSemaphores = SubmitInfo.WaitSemaphores;
+		std::vector<VkPipelineStageFlags> WaitStages = SubmitInfo.WaitStages;
+		std::vector<uint64_t> WaitValues(WaitSemaphores.size(), 0);
+		std::vector<VkSemaphore> SignalSemaphores = SubmitInfo.SignalSemaphores;
+		std::vector<uint64_t> SignalValues(SignalSemaphores.size(), 0);
+
+		VkFence Fence = VK_NULL_HANDLE;
+		if (Timeline.Semaphore != VK_NULL_HANDLE)
+		{
+			for (const TimelineWait& Wait : SubmitInfo.TimelineWaits)
+			{
+				if (Wait.Timeline->Queue == Timeline.Queue)
+				{
+					continue;
+				}
+				WaitSemaphores.push_back(Wait.Timeline->Semaphore);
+				WaitStages.push_back(Wait.Stages);
+				WaitValues.push_back(Wait.Value);
+			}
+
+			SignalSemaphores.push_back(Timeline.Semaphore);
+			SignalValues.push_back(Value);
+		}
+		else
+		{
+			//Without timelines every queue is the graphics queue, so there is nothing to wait for
+			if (Timeline.FreeFences.empty())
+			{
+				Fence = CreateFence(GFXDevice, false);
+			}
+			else
+			{
+				Fence = Timeline.FreeFences.back();
+				Timeline.FreeFences.pop_back();
+			}
+			Timeline.PendingFences.push_back(std::make_pair(Value, Fence));
+		}
+
+		VkTimelineSemaphoreSubmitInfoKHR TimelineInfo = {};
+		TimelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+		TimelineInfo.waitSemaphoreValueCount = static_cast<uint32_t> (WaitValues.size());
+		TimelineInfo.pWaitSemaphoreValues = WaitValues.data();
+		TimelineInfo.signalSemaphoreValueCount = static_cast<uint32_t> (SignalValues.size());
+		TimelineInfo.pSignalSemaphoreValues = SignalValues.data();
+
+		VkSubmitInfo Submit = {};
+		Submit.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+		Submit.pNext = Timeline.Semaphore != VK_NULL_HANDLE ? &TimelineInfo : nullptr;
+		Submit.waitSemaphoreCount = static_cast<uint32_t> (WaitSemaphores.size());
+		Submit.pWaitSemaphores = WaitSemaphores.data();
+		Submit.pWaitDstStageMask = WaitStages.data();
+		Submit.commandBufferCount = static_cast<uint32_t> (SubmitInfo.CommandBuffers.size());
+		Submit.pCommandBuffers = SubmitInfo.CommandBuffers.data();
+		Submit.signalSemaphoreCount = static_cast<uint32_t> (SignalSemaphores.size());
+		Submit.pSignalSemaphores = SignalSemaphores.data();
+
+		VkResult R = vkQueueSubmit(Timeline.Queue, 1, &Submit, Fence);
+		if (R != VK_SUCCESS)
+		{
+			std::cout << "Queue submission failed with error: " << R << std::endl;
+		}
+
+		return Value;
+	}
+
+	uint64_t GetCompletedTimelineValue(GraphicsDevice& GFXDevice, QueueTimeline& Timeline)
+	{
+		if (Timeline.Semaphore != VK_NULL_HANDLE)
+		{
+			uint64_t Value = 0;
+			if (VulkanFunctionPointers::vkGetSemaphoreCounterValueKHR(GFXDevice.Device, Timeline.Semaphore, &Value) == VK_SUCCESS)
+			{
+				Timeline.LastCompleted = Value;
+			}
+		}
+		else
+		{
+			RetireFences(GFXDevice, Timeline, Timeline.LastSubmitted, false, 0);
+		}
+		return Timeline.LastCompleted;
+	}
+
+	bool WaitForTimeline(GraphicsDevice& GFXDevice, QueueTimeline& Timeline, const uint64_t Value, const uint64_t Timeout)
+	{
+		if (Value <= Timeline.LastCompleted)
+		{
+			return true;
+		}
+
+		if (Timeline.Semaphore != VK_NULL_HANDLE)
+		{
+			VkSemaphoreWaitInfoKHR WaitInfo = {};
+			WaitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+			WaitInfo.semaphoreCount = 1;
+			WaitInfo.pSemaphores = &Timeline.Semaphore;
+			WaitInfo.pValues = &Value;
+			if (VulkanFunctionPointers::vkWaitSemaphoresKHR(GFXDevice.Device, &WaitInfo, Timeout) != VK_SUCCESS)
+			{
+				return false;
+			}
+			Timeline.LastCompleted = std::max(Timeline.LastCompleted, Value);
+		}
+		else
+		{
+			RetireFences(GFXDevice, Timeline, Value, true, Timeout);
+		}
+		return Value <= Timeline.LastCompleted;
+	}
+
+	void DestroyQueueTimeline(GraphicsDevice& GFXDevice, QueueTimeline& Timeline)
+	{
+		if (Timeline.Semaphore != VK_NULL_HANDLE)
+		{
+			vkDestroySemaphore(GFXDevice.Device, Timeline.Semaphore, nullptr);
+		}
+		for (const std::pair<uint64_t, VkFence>& Pending : Timeline.PendingFences)
+		{
+			vkDestroyFence(GFXDevice.Device, Pending.second, nullptr);
+		}
+		for (VkFence Fence : Timeline.FreeFences)
+		{
+			vkDestroyFence(GFXDevice.Device, Fence, nullptr);
+		}
+		Timeline = QueueTimeline();
+	}
+}
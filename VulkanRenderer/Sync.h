@@ -0,0 +1,69 @@
+#pragma once
+
+#include "vulkan\vulkan.h"
+#include <vector>
+#include <deque>
+#include <utility>
+
+namespace VulkanCore
+{
+	struct GraphicsDevice;
+
+	//A queue plus a counter that every submission to it advances by one
+	//The counter is a timeline semaphore: the CPU waits for a value and other queues' submissions wait on a value,
+	//so one object replaces per-frame fences and the binary semaphores between queues
+	//Without timeline semaphore support a fence per submission stands in for the CPU side (the device then runs a single queue)
+	struct QueueTimeline
+	{
+		VkQueue Queue = VK_NULL_HANDLE;
+		VkSemaphore Semaphore = VK_NULL_HANDLE;
+
+		//Value the latest submission signals, 0 before the first one
+		uint64_t LastSubmitted = 0;
+
+		//Highest value seen complete, only updated by the calls below
+		uint64_t LastCompleted = 0;
+
+		//Fallback: fences of submissions not seen complete yet (oldest first) and fences ready for reuse
+		std::deque<std::pair<uint64_t, VkFence>> PendingFences;
+		std::vector<VkFence> FreeFences;
+	};
+
+	//A point on another queue's timeline a submission waits for
+	struct TimelineWait
+	{
+		const QueueTimeline* Timeline = nullptr;
+		uint64_t Value = 0;
+		VkPipelineStageFlags Stages = 0;
+	};
+
+	//Everything one vkQueueSubmit needs besides the timeline's own signal
+	struct TimelineSubmitInfo
+	{
+		std::vector<VkCommandBuffer> CommandBuffers;
+
+		//Binary semaphores, only for the swapchain (acquire and present can't use timelines)
+		std::vector<VkSemaphore> WaitSemaphores;
+		std::vector<VkPipelineStageFlags> WaitStages;
+		std::vector<VkSemaphore> SignalSemaphores;
+
+		std::vector<TimelineWait> TimelineWaits;
+	};
+
+	QueueTimeline CreateQueueTimeline(GraphicsDevice& GFXDevice, VkQueue Queue);
+
+	//Adds a wait for Value on Timeline, skipped when it is 0 or Timeline is the submitting queue (submission order already covers it)
+	void AddTimelineWait(TimelineSubmitInfo& SubmitInfo, const QueueTimeline& Timeline, const uint64_t Value, const VkPipelineStageFlags Stages);
+
+	//Submits to Timeline's queue and returns the value it signals when done
+	uint64_t SubmitToTimeline(GraphicsDevice& GFXDevice, QueueTimeline& Timeline, const TimelineSubmitInfo& SubmitInfo);
+
+	//Highest completed value, never blocks
+	uint64_t GetCompletedTimelineValue(GraphicsDevice& GFXDevice, QueueTimeline& Timeline);
+
+	//Blocks until Value has completed or Timeout (nanoseconds) passed, returns whether it completed
+	bool WaitForTimeline(GraphicsDevice& GFXDevice, QueueTimeline& Timeline, const uint64_t Value, const uint64_t Timeout = UINT64_MAX);
+
+	//Device must be idle
+	void DestroyQueueTimeline(GraphicsDevice& GFXDevice, QueueTimeline& Timeline);
+}
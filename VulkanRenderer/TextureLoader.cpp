@@ -0,0 +1,671 @@
+#include "TextureLoader.h"
+#include "VulkanInitializers.h"
+#include <iostream>
+#include <fstream>
+#include <cstring>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include <memory>
+#include <exception>
+
+namespace VulkanCore
+{
+	namespace
+	{
+		uint32_t ReadU32(const uint8_t* Bytes)
+		{
+			uint32_t Value;
+			::memcpy(&Value, Bytes, sizeof(Value));
+			return Value;
+		}
+
+		uint64_t ReadU64(const uint8_t* Bytes)
+		{
+			uint64_t Value;
+			::memcpy(&Value, Bytes, sizeof(Value));
+			return Value;
+		}
+
+		double MillisecondsSince(const std::chrono::high_resolution_clock::time_point& Start)
+		{
+			return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - Start).count();
+		}
+
+		uint32_t FourCC(const char a, const char b, const char c, const char d)
+		{
+			return static_cast<uint32_t>(a) | (static_cast<uint32_t>(b) << 8) | (static_cast<uint32_t>(c) << 16) | (static_cast<uint32_t>(d) << 24);
+		}
+
+		//Copies MipCount mips from a container into a tightly packed TextureFileData (each mip 16 byte aligned for buffer to image copies)
+		//MipOffsets / MipSizes index into File, returns false if any mip runs past the end of the file
+		bool GatherMips(const std::vector<uint8_t>& File, const std::vector<size_t>& MipOffsets, TextureFileData& Out)
+		{
+			//Levels past 1x1 would shift the dimensions by 32 or more
+			const uint32_t MipCount = std::min(static_cast<uint32_t> (MipOffsets.size()), CalculateMipLevels(Out.Width, Out.Height));
+
+			size_t Total = 0;
+			for (uint32_t Mip = 0; Mip < MipCount; ++Mip)
+			{
+				TextureMip Level;
+				Level.Width = std::max(Out.Width >> Mip, 1u);
+				Level.Height = std::max(Out.Height >> Mip, 1u);
+				Level.Size = GetMipSize(Out.Format, Level.Width, Level.Height);
+				Level.Offset = RoundToNextMultiple(Total, static_cast<size_t> (16));
+				Total = Level.Offset + Level.Size;
+
+				if (MipOffsets[Mip] > File.size() || Level.Size > File.size() - MipOffsets[Mip])
+				{
+					std::cout << "Texture mip " << Mip << " runs past the end of the file" << std::endl;
+					return false;
+				}
+				Out.Mips.push_back(Level);
+			}
+
+			Out.Data.resize(Total);
+			for (size_t Mip = 0; Mip < Out.Mips.size(); ++Mip)
+			{
+				::memcpy(Out.Data.data() + Out.Mips[Mip].Offset, File.data() + MipOffsets[Mip], Out.Mips[Mip].Size);
+			}
+			return true;
+		}
+
+		//565 endpoint to 8 bit per channel
+		void Expand565(const uint16_t Color, uint8_t Out[4])
+		{
+			uint8_t R = (Color >> 11) & 31;
+			uint8_t G = (Color >> 5) & 63;
+			uint8_t B = Color & 31;
+			Out[0] = static_cast<uint8_t> ((R << 3) | (R >> 2));
+			Out[1] = static_cast<uint8_t> ((G << 2) | (G >> 4));
+			Out[2] = static_cast<uint8_t> ((B << 3) | (B >> 2));
+			Out[3] = 255;
+		}
+
+		//BC1 style color block, bThreeColorMode allows the c0 <= c1 mode (only BC1 uses it)
+		void DecodeColorBlock(const uint8_t* Block, const bool bThreeColorMode, const bool bPunchThroughAlpha, uint8_t Out[16][4])
+		{
+			uint16_t C0 = static_cast<uint16_t> (Block[0] | (Block[1] << 8));
+			uint16_t C1 = static_cast<uint16_t> (Block[2] | (Block[3] << 8));
+
+			uint8_t Palette[4][4];
+			Expand565(C0, Palette[0]);
+			Expand565(C1, Palette[1]);
+
+			if (C0 > C1 || !bThreeColorMode)
+			{
+				for (int c = 0; c < 3; ++c)
+				{
+					Palette[2][c] = static_cast<uint8_t> ((2 * Palette[0][c] + Palette[1][c]) / 3);
+					Palette[3][c] = static_cast<uint8_t> ((Palette[0][c] + 2 * Palette[1][c]) / 3);
+				}
+				Palette[2][3] = 255;
+				Palette[3][3] = 255;
+			}
+			else
+			{
+				for (int c = 0; c < 3; ++c)
+				{
+					Palette[2][c] = static_cast<uint8_t> ((Palette[0][c] + Palette[1][c]) / 2);
+					Palette[3][c] = 0;
+				}
+				Palette[2][3] = 255;
+				Palette[3][3] = bPunchThroughAlpha ? 0 : 255;
+			}
+
+			uint32_t Indices = ReadU32(Block + 4);
+			for (int i = 0; i < 16; ++i)
+			{
+				::memcpy(Out[i], Palette[(Indices >> (2 * i)) & 3], 4);
+			}
+		}
+
+		//BC3 alpha / BC4 / BC5 channel block: two endpoints and 3 bit indices
+		void DecodeChannelBlock(const uint8_t* Block, uint8_t Out[16])
+		{
+			uint8_t Palette[8];
+			Palette[0] = Block[0];
+			Palette[1] = Block[1];
+			if (Palette[0] > Palette[1])
+			{
+				for (int i = 1; i < 7; ++i)
+				{
+					Palette[i + 1] = static_cast<uint8_t> (((7 - i) * Palette[0] + i * Palette[1]) / 7);
+				}
+			}
+			else
+			{
+				for (int i = 1; i < 5; ++i)
+				{
+					Palette[i + 1] = static_cast<uint8_t> (((5 - i) * Palette[0] + i * Palette[1]) / 5);
+				}
+				Palette[6] = 0;
+				Palette[7] = 255;
+			}
+
+			uint64_t Bits = 0;
+			for (int i = 0; i < 6; ++i)
+			{
+				Bits |= static_cast<uint64_t> (Block[2 + i]) << (8 * i);
+			}
+			for (int i = 0; i < 16; ++i)
+			{
+				Out[i] = Palette[(Bits >> (3 * i)) & 7];
+			}
+		}
+
+		//Decodes one 4x4 block of any supported BC format to RGBA8
+		void DecodeBlock(const VkFormat Format, const uint8_t* Block, uint8_t Out[16][4])
+		{
+			uint8_t Channel[16];
+
+			switch (Format)
+			{
+			case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+			case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+				DecodeColorBlock(Block, true, false, Out);
+				break;
+			case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+			case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+				DecodeColorBlock(Block, true, true, Out);
+				break;
+			case VK_FORMAT_BC2_UNORM_BLOCK:
+			case VK_FORMAT_BC2_SRGB_BLOCK:
+				DecodeColorBlock(Block + 8, false, false, Out);
+				for (int i = 0; i < 16; ++i)
+				{
+					//Explicit 4 bit alpha
+					Out[i][3] = static_cast<uint8_t> (((Block[i / 2] >> (4 * (i & 1))) & 0xF) * 17);
+				}
+				break;
+			case VK_FORMAT_BC3_UNORM_BLOCK:
+			case VK_FORMAT_BC3_SRGB_BLOCK:
+				DecodeColorBlock(Block + 8, false, false, Out);
+				DecodeChannelBlock(Block, Channel);
+				for (int i = 0; i < 16; ++i)
+				{
+					Out[i][3] = Channel[i];
+				}
+				break;
+			case VK_FORMAT_BC4_UNORM_BLOCK:
+				DecodeChannelBlock(Block, Channel);
+				for (int i = 0; i < 16; ++i)
+				{
+					Out[i][0] = Channel[i];
+					Out[i][1] = 0;
+					Out[i][2] = 0;
+					Out[i][3] = 255;
+				}
+				break;
+			case VK_FORMAT_BC5_UNORM_BLOCK:
+				DecodeChannelBlock(Block, Channel);
+				for (int i = 0; i < 16; ++i)
+				{
+					Out[i][0] = Channel[i];
+					Out[i][2] = 0;
+					Out[i][3] = 255;
+				}
+				DecodeChannelBlock(Block + 8, Channel);
+				for (int i = 0; i < 16; ++i)
+				{
+					Out[i][1] = Channel[i];
+				}
+				break;
+			default:
+				break;
+			}
+		}
+
+		bool IsSRGB(const VkFormat Format)
+		{
+			switch (Format)
+			{
+			case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+			case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+			case VK_FORMAT_BC2_SRGB_BLOCK:
+			case VK_FORMAT_BC3_SRGB_BLOCK:
+				return true;
+			default:
+				return false;
+			}
+		}
+
+		VkFormat DXGIToVkFormat(const uint32_t DXGIFormat)
+		{
+			switch (DXGIFormat)
+			{
+			case 28: return VK_FORMAT_R8G8B8A8_UNORM;
+			case 29: return VK_FORMAT_R8G8B8A8_SRGB;
+			case 71: return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+			case 72: return VK_FORMAT_BC1_RGBA_SRGB_BLOCK;
+			case 74: return VK_FORMAT_BC2_UNORM_BLOCK;
+			case 75: return VK_FORMAT_BC2_SRGB_BLOCK;
+			case 77: return VK_FORMAT_BC3_UNORM_BLOCK;
+			case 78: return VK_FORMAT_BC3_SRGB_BLOCK;
+			case 80: return VK_FORMAT_BC4_UNORM_BLOCK;
+			case 81: return VK_FORMAT_BC4_SNORM_BLOCK;
+			case 83: return VK_FORMAT_BC5_UNORM_BLOCK;
+			case 84: return VK_FORMAT_BC5_SNORM_BLOCK;
+			case 87: return VK_FORMAT_B8G8R8A8_UNORM;
+			case 91: return VK_FORMAT_B8G8R8A8_SRGB;
+			case 95: return VK_FORMAT_BC6H_UFLOAT_BLOCK;
+			case 96: return VK_FORMAT_BC6H_SFLOAT_BLOCK;
+			case 98: return VK_FORMAT_BC7_UNORM_BLOCK;
+			case 99: return VK_FORMAT_BC7_SRGB_BLOCK;
+			default: return VK_FORMAT_UNDEFINED;
+			}
+		}
+	}
+
+	FormatBlockInfo GetFormatBlockInfo(const VkFormat Format)
+	{
+		FormatBlockInfo Info;
+
+		switch (Format)
+		{
+		case VK_FORMAT_R8G8B8A8_UNORM:
+		case VK_FORMAT_R8G8B8A8_SRGB:
+		case VK_FORMAT_B8G8R8A8_UNORM:
+		case VK_FORMAT_B8G8R8A8_SRGB:
+			Info.BlockBytes = 4;
+			return Info;
+		case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+		case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+		case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+		case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+		case VK_FORMAT_BC4_UNORM_BLOCK:
+		case VK_FORMAT_BC4_SNORM_BLOCK:
+		case VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK:
+		case VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK:
+		case VK_FORMAT_ETC2_R8G8B8A1_UNORM_BLOCK:
+		case VK_FORMAT_ETC2_R8G8B8A1_SRGB_BLOCK:
+		case VK_FORMAT_EAC_R11_UNORM_BLOCK:
+		case VK_FORMAT_EAC_R11_SNORM_BLOCK:
+			Info.BlockWidth = 4;
+			Info.BlockHeight = 4;
+			Info.BlockBytes = 8;
+			return Info;
+		case VK_FORMAT_BC2_UNORM_BLOCK:
+		case VK_FORMAT_BC2_SRGB_BLOCK:
+		case VK_FORMAT_BC3_UNORM_BLOCK:
+		case VK_FORMAT_BC3_SRGB_BLOCK:
+		case VK_FORMAT_BC5_UNORM_BLOCK:
+		case VK_FORMAT_BC5_SNORM_BLOCK:
+		case VK_FORMAT_BC6H_UFLOAT_BLOCK:
+		case VK_FORMAT_BC6H_SFLOAT_BLOCK:
+		case VK_FORMAT_BC7_UNORM_BLOCK:
+		case VK_FORMAT_BC7_SRGB_BLOCK:
+		case VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK:
+		case VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK:
+		case VK_FORMAT_EAC_R11G11_UNORM_BLOCK:
+		case VK_FORMAT_EAC_R11G11_SNORM_BLOCK:
+			Info.BlockWidth = 4;
+			Info.BlockHeight = 4;
+			Info.BlockBytes = 16;
+			return Info;
+		default:
+			break;
+		}
+
+		//ASTC formats come in UNORM / SRGB pairs per block footprint, every block is 16 bytes
+		if (Format >= VK_FORMAT_ASTC_4x4_UNORM_BLOCK && Format <= VK_FORMAT_ASTC_12x12_SRGB_BLOCK)
+		{
+			static const uint32_t ASTCFootprints[14][2] = {
+				{ 4, 4 },{ 5, 4 },{ 5, 5 },{ 6, 5 },{ 6, 6 },{ 8, 5 },{ 8, 6 },
+				{ 8, 8 },{ 10, 5 },{ 10, 6 },{ 10, 8 },{ 10, 10 },{ 12, 10 },{ 12, 12 }
+			};
+			const uint32_t Footprint = (Format - VK_FORMAT_ASTC_4x4_UNORM_BLOCK) / 2;
+			Info.BlockWidth = ASTCFootprints[Footprint][0];
+			Info.BlockHeight = ASTCFootprints[Footprint][1];
+			Info.BlockBytes = 16;
+		}
+
+		return Info;
+	}
+
+	size_t GetMipSize(const VkFormat Format, const uint32_t Width, const uint32_t Height)
+	{
+		FormatBlockInfo Info = GetFormatBlockInfo(Format);
+		size_t BlocksX = (Width + Info.BlockWidth - 1) / Info.BlockWidth;
+		size_t BlocksY = (Height + Info.BlockHeight - 1) / Info.BlockHeight;
+		return BlocksX * BlocksY * Info.BlockBytes;
+	}
+
+	bool IsFormatSampleable(GraphicsDevice& GFXDevice, const VkFormat Format)
+	{
+		VkFormatProperties FormatProperties = {};
+		vkGetPhysicalDeviceFormatProperties(GFXDevice.PhysicalDevice, Format, &FormatProperties);
+		return (FormatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT) != 0;
+	}
+
+	TextureFileData ParseKTX2(const std::vector<uint8_t>& File)
+	{
+		static const uint8_t Identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+		//Identifier, 9 uint32 header fields, 4 uint32 + 2 uint64 index fields
+		static const size_t HeaderSize = 12 + 9 * 4 + 4 * 4 + 2 * 8;
+		static const size_t LevelIndexEntrySize = 3 * 8;
+
+		TextureFileData RetVal;
+		if (File.size() < HeaderSize || ::memcmp(File.data(), Identifier, sizeof(Identifier)) != 0)
+		{
+			std::cout << "Not a KTX2 file" << std::endl;
+			return RetVal;
+		}
+
+		const uint8_t* Header = File.data() + 12;
+		VkFormat Format = static_cast<VkFormat> (ReadU32(Header + 0));
+		uint32_t PixelWidth = ReadU32(Header + 8);
+		uint32_t PixelHeight = ReadU32(Header + 12);
+		uint32_t PixelDepth = ReadU32(Header + 16);
+		uint32_t LayerCount = ReadU32(Header + 20);
+		uint32_t FaceCount = ReadU32(Header + 24);
+		uint32_t LevelCount = std::max(ReadU32(Header + 28), 1u);
+		uint32_t SupercompressionScheme = ReadU32(Header + 32);
+
+		if (Format == VK_FORMAT_UNDEFINED || SupercompressionScheme != 0)
+		{
+			std::cout << "KTX2 Basis Universal / supercompressed payloads are not supported" << std::endl;
+			return RetVal;
+		}
+		if (PixelDepth > 1 || LayerCount > 1 || FaceCount != 1 || PixelWidth == 0 || PixelHeight == 0)
+		{
+			std::cout << "Only single layer 2D KTX2 textures are supported" << std::endl;
+			return RetVal;
+		}
+		if (GetFormatBlockInfo(Format).BlockBytes == 0)
+		{
+			std::cout << "KTX2 format " << Format << " is not supported by the loader" << std::endl;
+			return RetVal;
+		}
+		if (LevelCount > CalculateMipLevels(PixelWidth, PixelHeight))
+		{
+			std::cout << "KTX2 level count " << LevelCount << " is larger than a full mip chain" << std::endl;
+			return RetVal;
+		}
+		if (File.size() < HeaderSize + LevelCount * LevelIndexEntrySize)
+		{
+			std::cout << "KTX2 level index is truncated" << std::endl;
+			return RetVal;
+		}
+
+		RetVal.Format = Format;
+		RetVal.Width = PixelWidth;
+		RetVal.Height = PixelHeight;
+
+		//Level index is always largest mip first, even though the data is stored smallest first
+		std::vector<size_t> MipOffsets(LevelCount);
+		for (uint32_t Level = 0; Level < LevelCount; ++Level)
+		{
+			MipOffsets[Level] = static_cast<size_t> (ReadU64(File.data() + HeaderSize + Level * LevelIndexEntrySize));
+		}
+
+		if (!GatherMips(File, MipOffsets, RetVal))
+		{
+			return TextureFileData();
+		}
+		return RetVal;
+	}
+
+	TextureFileData ParseDDS(const std::vector<uint8_t>& File)
+	{
+		static const size_t HeaderSize = 4 + 124;
+		static const size_t DX10HeaderSize = 20;
+		static const uint32_t DDSD_MIPMAPCOUNT = 0x20000;
+		static const uint32_t DDPF_FOURCC = 0x4;
+		static const uint32_t DDPF_RGB = 0x40;
+
+		TextureFileData RetVal;
+		if (File.size() < HeaderSize || ReadU32(File.data()) != FourCC('D', 'D', 'S', ' '))
+		{
+			std::cout << "Not a DDS file" << std::endl;
+			return RetVal;
+		}
+
+		const uint8_t* Header = File.data() + 4;
+		uint32_t Flags = ReadU32(Header + 4);
+		uint32_t PixelHeight = ReadU32(Header + 8);
+		uint32_t PixelWidth = ReadU32(Header + 12);
+		uint32_t MipMapCount = (Flags & DDSD_MIPMAPCOUNT) ? std::max(ReadU32(Header + 24), 1u) : 1;
+
+		if (PixelWidth == 0 || PixelHeight == 0)
+		{
+			std::cout << "DDS texture has no pixels" << std::endl;
+			return RetVal;
+		}
+		if (MipMapCount > CalculateMipLevels(PixelWidth, PixelHeight))
+		{
+			std::cout << "DDS mip count " << MipMapCount << " is larger than a full mip chain" << std::endl;
+			return RetVal;
+		}
+
+		//Pixel format sits after size, flags, height, width, pitch, depth, mip count and 11 reserved dwords
+		const uint8_t* PixelFormat = Header + 72;
+		uint32_t PixelFormatFlags = ReadU32(PixelFormat + 4);
+		uint32_t PixelFourCC = ReadU32(PixelFormat + 8);
+		uint32_t RGBBitCount = ReadU32(PixelFormat + 12);
+		uint32_t RedMask = ReadU32(PixelFormat + 16);
+
+		size_t DataOffset = HeaderSize;
+		VkFormat Format = VK_FORMAT_UNDEFINED;
+
+		if (PixelFormatFlags & DDPF_FOURCC)
+		{
+			if (PixelFourCC == FourCC('D', 'X', '1', '0'))
+			{
+				if (File.size() < HeaderSize + DX10HeaderSize)
+				{
+					std::cout << "DDS DX10 header is truncated" << std::endl;
+					return RetVal;
+				}
+				Format = DXGIToVkFormat(ReadU32(File.data() + HeaderSize));
+				DataOffset += DX10HeaderSize;
+			}
+			else if (PixelFourCC == FourCC('D', 'X', 'T', '1')) Format = VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+			else if (PixelFourCC == FourCC('D', 'X', 'T', '3')) Format = VK_FORMAT_BC2_UNORM_BLOCK;
+			else if (PixelFourCC == FourCC('D', 'X', 'T', '5')) Format = VK_FORMAT_BC3_UNORM_BLOCK;
+			else if (PixelFourCC == FourCC('A', 'T', 'I', '1') || PixelFourCC == FourCC('B', 'C', '4', 'U')) Format = VK_FORMAT_BC4_UNORM_BLOCK;
+			else if (PixelFourCC == FourCC('A', 'T', 'I', '2') || PixelFourCC == FourCC('B', 'C', '5', 'U')) Format = VK_FORMAT_BC5_UNORM_BLOCK;
+		}
+		else if ((PixelFormatFlags & DDPF_RGB) && RGBBitCount == 32)
+		{
+			Format = (RedMask == 0x000000FF) ? VK_FORMAT_R8G8B8A8_UNORM : VK_FORMAT_B8G8R8A8_UNORM;
+		}
+
+		if (Format == VK_FORMAT_UNDEFINED)
+		{
+			std::cout << "DDS pixel format is not supported by the loader" << std::endl;
+			return RetVal;
+		}
+
+		RetVal.Format = Format;
+		RetVal.Width = PixelWidth;
+		RetVal.Height = PixelHeight;
+
+		//DDS stores mips back to back, largest first
+		std::vector<size_t> MipOffsets(MipMapCount);
+		for (uint32_t Mip = 0; Mip < MipMapCount; ++Mip)
+		{
+			MipOffsets[Mip] = DataOffset;
+			DataOffset += GetMipSize(Format, std::max(PixelWidth >> Mip, 1u), std::max(PixelHeight >> Mip, 1u));
+		}
+
+		if (!GatherMips(File, MipOffsets, RetVal))
+		{
+			return TextureFileData();
+		}
+		return RetVal;
+	}
+
+	TextureFileData LoadTextureFile(const char* Path)
+	{
+		auto Start = std::chrono::high_resolution_clock::now();
+
+		std::ifstream Stream(Path, std::ios::binary | std::ios::ate);
+		if (!Stream)
+		{
+			std::cout << "Failed to open texture: " << Path << std::endl;
+			return TextureFileData();
+		}
+
+		std::vector<uint8_t> File(static_cast<size_t> (Stream.tellg()));
+		Stream.seekg(0);
+		Stream.read(reinterpret_cast<char*> (File.data()), File.size());
+
+		TextureFileData RetVal;
+		if (File.size() >= 4 && ReadU32(File.data()) == FourCC('D', 'D', 'S', ' '))
+		{
+			RetVal = ParseDDS(File);
+		}
+		else
+		{
+			RetVal = ParseKTX2(File);
+		}
+
+		RetVal.LoadMilliseconds = MillisecondsSince(Start);
+		return RetVal;
+	}
+
+	bool CanTranscodeToRGBA8(const VkFormat Format)
+	{
+		switch (Format)
+		{
+		case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+		case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+		case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+		case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+		case VK_FORMAT_BC2_UNORM_BLOCK:
+		case VK_FORMAT_BC2_SRGB_BLOCK:
+		case VK_FORMAT_BC3_UNORM_BLOCK:
+		case VK_FORMAT_BC3_SRGB_BLOCK:
+		case VK_FORMAT_BC4_UNORM_BLOCK:
+		case VK_FORMAT_BC5_UNORM_BLOCK:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	TextureFileData TranscodeToRGBA8(const TextureFileData& Source)
+	{
+		auto Start = std::chrono::high_resolution_clock::now();
+
+		TextureFileData RetVal;
+		if (!CanTranscodeToRGBA8(Source.Format))
+		{
+			std::cout << "No CPU decoder for format " << Source.Format << std::endl;
+			return RetVal;
+		}
+
+		RetVal.Format = IsSRGB(Source.Format) ? VK_FORMAT_R8G8B8A8_SRGB : VK_FORMAT_R8G8B8A8_UNORM;
+		RetVal.Width = Source.Width;
+		RetVal.Height = Source.Height;
+		RetVal.bTranscoded = true;
+
+		size_t Total = 0;
+		for (const TextureMip& SourceMip : Source.Mips)
+		{
+			TextureMip Mip;
+			Mip.Width = SourceMip.Width;
+			Mip.Height = SourceMip.Height;
+			Mip.Offset = Total;
+			Mip.Size = static_cast<size_t> (Mip.Width) * Mip.Height * 4;
+			Total += Mip.Size;
+			RetVal.Mips.push_back(Mip);
+		}
+		RetVal.Data.resize(Total);
+
+		const uint32_t BlockBytes = GetFormatBlockInfo(Source.Format).BlockBytes;
+		uint8_t Texels[16][4];
+
+		for (size_t MipIndex = 0; MipIndex < Source.Mips.size(); ++MipIndex)
+		{
+			const TextureMip& SourceMip = Source.Mips[MipIndex];
+			const TextureMip& DestMip = RetVal.Mips[MipIndex];
+			const uint8_t* Block = Source.Data.data() + SourceMip.Offset;
+			uint8_t* Dest = RetVal.Data.data() + DestMip.Offset;
+
+			for (uint32_t BlockY = 0; BlockY < SourceMip.Height; BlockY += 4)
+			{
+				for (uint32_t BlockX = 0; BlockX < SourceMip.Width; BlockX += 4, Block += BlockBytes)
+				{
+					DecodeBlock(Source.Format, Block, Texels);
+
+					//Edge blocks of non multiple of 4 mips are partially outside the image
+					uint32_t CopyWidth = std::min(4u, SourceMip.Width - BlockX);
+					uint32_t CopyHeight = std::min(4u, SourceMip.Height - BlockY);
+					for (uint32_t y = 0; y < CopyHeight; ++y)
+					{
+						::memcpy(Dest + ((BlockY + y) * DestMip.Width + BlockX) * 4, Texels[y * 4], CopyWidth * 4);
+					}
+				}
+			}
+		}
+
+		RetVal.LoadMilliseconds = Source.LoadMilliseconds + MillisecondsSince(Start);
+		return RetVal;
+	}
+
+	TextureFileData CreateTestTextureData(const uint32_t Size)
+	{
+		static const uint32_t CheckerSize = 32;
+
+		TextureFileData RetVal;
+		RetVal.Format = VK_FORMAT_R8G8B8A8_UNORM;
+		RetVal.Width = Size;
+		RetVal.Height = Size;
+		RetVal.Data.resize(static_cast<size_t> (Size) * Size * 4);
+
+		TextureMip Mip;
+		Mip.Width = Size;
+		Mip.Height = Size;
+		Mip.Size = RetVal.Data.size();
+		RetVal.Mips.push_back(Mip);
+
+		for (uint32_t y = 0; y < Size; ++y)
+		{
+			for (uint32_t x = 0; x < Size; ++x)
+			{
+				bool bLight = ((x / CheckerSize) + (y / CheckerSize)) % 2 == 0;
+				//RGBA8 little endian: 0xAABBGGRR
+				uint32_t Texel = bLight ? 0xFFE0E0E0 : 0xFF303030;
+				::memcpy(RetVal.Data.data() + (static_cast<size_t> (y) * Size + x) * 4, &Texel, 4);
+			}
+		}
+
+		return RetVal;
+	}
+
+	std::future<TextureFileData> LoadTextureFileAsync(JobSystem& Jobs, GraphicsDevice& GFXDevice, const char* Path)
+	{
+		//Copies so the job doesn't depend on the caller's lifetimes
+		GraphicsDevice Device = GFXDevice;
+		std::string PathCopy = Path;
+
+		//std::function needs a copyable callable, so the promise is shared
+		std::shared_ptr<std::promise<TextureFileData>> Result = std::make_shared<std::promise<TextureFileData>>();
+		std::future<TextureFileData> RetVal = Result->get_future();
+
+		//Any throw (e.g. bad_alloc on a huge but well formed file) must still satisfy the promise, otherwise the waiter blocks forever
+		//It's handed to the waiter, rethrown from get()
+		RunJob(Jobs, [Device, PathCopy, Result]() mutable
+		{
+			try
+			{
+				TextureFileData FileData = LoadTextureFile(PathCopy.c_str());
+				if (FileData.Format != VK_FORMAT_UNDEFINED && !IsFormatSampleable(Device, FileData.Format))
+				{
+					std::cout << "Device can't sample format " << FileData.Format << ", transcoding " << PathCopy << " to RGBA8" << std::endl;
+					FileData = TranscodeToRGBA8(FileData);
+				}
+				Result->set_value(std::move(FileData));
+			}
+			catch (...)
+			{
+				Result->set_exception(std::current_exception());
+			}
+		});
+
+		return RetVal;
+	}
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "VulkanTextures.h"
+#include "JobSystem.h"
+#include <vector>
+#include <future>
+
+namespace VulkanCore
+{
+	//One mip level within TextureFileData::Data, largest first
+	struct TextureMip
+	{
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		size_t Offset = 0;
+		size_t Size = 0;
+	};
+
+	//CPU side copy of a texture container's payload, Format is VK_FORMAT_UNDEFINED if loading failed
+	struct TextureFileData
+	{
+		VkFormat Format = VK_FORMAT_UNDEFINED;
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		std::vector<TextureMip> Mips;
+		std::vector<uint8_t> Data;
+
+		//Time spent reading, parsing and (if needed) transcoding
+		double LoadMilliseconds = 0.0;
+		bool bTranscoded = false;
+	};
+
+	//Texel block footprint, uncompressed formats are 1x1 blocks
+	struct FormatBlockInfo
+	{
+		uint32_t BlockWidth = 1;
+		uint32_t BlockHeight = 1;
+		uint32_t BlockBytes = 0;
+	};
+
+	//BlockBytes is 0 for formats the loader doesn't know
+	FormatBlockInfo GetFormatBlockInfo(const VkFormat Format);
+
+	//Bytes needed by one mip of Width x Height in Format
+	size_t GetMipSize(const VkFormat Format, const uint32_t Width, const uint32_t Height);
+
+	//True if the device can sample Format from an optimal tiling image
+	bool IsFormatSampleable(GraphicsDevice& GFXDevice, const VkFormat Format);
+
+	//Parses a KTX2 container (no supercompression, single 2D layer and face)
+	TextureFileData ParseKTX2(const std::vector<uint8_t>& File);
+
+	//Parses a DDS container (DXTn/ATIn/BCn FourCCs, DX10 header and plain 32 bit RGBA)
+	TextureFileData ParseDDS(const std::vector<uint8_t>& File);
+
+	//Reads Path and parses it based on its magic number
+	TextureFileData LoadTextureFile(const char* Path);
+
+	//True if TranscodeToRGBA8 can decode Format
+	bool CanTranscodeToRGBA8(const VkFormat Format);
+
+	//Decodes every mip of a BC1-5 texture into RGBA8
+	TextureFileData TranscodeToRGBA8(const TextureFileData& Source);
+
+	//Checkerboard RGBA8 texture for testing, mip 0 only (the streamer blits the rest on the GPU)
+	TextureFileData CreateTestTextureData(const uint32_t Size);
+
+	//Loads Path in a job, decoding to RGBA8 there when the device can't sample the stored format
+	//The future always becomes ready, holding an empty TextureFileData when loading failed, get() rethrows anything the load threw
+	//Waiting on the future doesn't run jobs, so Jobs needs a worker thread besides the caller
+	std::future<TextureFileData> LoadTextureFileAsync(JobSystem& Jobs, GraphicsDevice& GFXDevice, const char* Path);
+}
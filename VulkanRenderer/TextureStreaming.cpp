@@ -0,0 +1,557 @@
+#include "TextureStreaming.h"
+#include "UploadScheduler.h"
+#include "VulkanInitializers.h"
+#include "DeletionQueue.h"
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+
+namespace VulkanCore
+{
+	namespace
+	{
+		VkDeviceSize MipRangeBytes(const TextureFileData& Source, const uint32_t FirstMip)
+		{
+			VkDeviceSize Bytes = 0;
+			for (size_t Mip = FirstMip; Mip < Source.Mips.size(); ++Mip)
+			{
+				Bytes += Source.Mips[Mip].Size;
+			}
+			return Bytes;
+		}
+
+		//Cleared slots have to reach the device before the frame that writes them is submitted
+		void FlushFeedback(GraphicsDevice& GFXDevice, const TextureFeedbackBuffer& Feedback)
+		{
+			VkMappedMemoryRange Range = {};
+			Range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+			Range.memory = Feedback.DeviceMemory;
+			Range.size = VK_WHOLE_SIZE;
+			vkFlushMappedMemoryRanges(GFXDevice.Device, 1, &Range);
+		}
+
+		void UpdatePeakBytes(TextureStreamer& Streamer)
+		{
+			Streamer.PeakResidentBytes = std::max(Streamer.PeakResidentBytes, Streamer.ResidentBytes + Streamer.RetiredBytes);
+		}
+
+		//The bytes keep counting against the budget until the deletion queue frees them
+		void RetireGarbage(TextureStreamer& Streamer, StreamingGarbage Garbage)
+		{
+			Streamer.RetiredBytes += Garbage.Bytes;
+			VkDeviceSize* RetiredBytes = &Streamer.RetiredBytes;
+			DeferDeletion(*Streamer.Deletions, [Garbage, RetiredBytes](GraphicsDevice& GFXDevice) mutable
+			{
+				if (Garbage.Staging.Buffer != VK_NULL_HANDLE)
+				{
+					DestroyStagingBuffer(GFXDevice, Garbage.Staging);
+				}
+				*RetiredBytes -= Garbage.Bytes;
+			});
+		}
+
+		//Registers the first image, later ones replace it under the same handle and the registry releases the old one to the deletion queue
+		//Tex.ResidentBytes must already describe NewImage
+		void SwapResidentImage(TextureStreamer& Streamer, StreamedTexture& Tex, const Texture& NewImage)
+		{
+			if (Tex.Resident == ImageHandle())
+			{
+				Tex.Resident = RegisterImage(*Streamer.Registry, NewImage, Tex.ResidentBytes);
+			}
+			else
+			{
+				ReplaceImage(*Streamer.Registry, *Streamer.Deletions, Tex.Resident, NewImage, Tex.ResidentBytes);
+			}
+		}
+
+		//Stages Source mips [FirstMip, EndMip) and copies them to Image, whose level 0 is Source mip ImageMip
+		//The mips are contiguous in Source so one staging buffer covers them, the caller keeps it alive until the copy has executed
+		StagingBuffer CmdUploadMips(GraphicsDevice& GFXDevice, const TextureFileData& Source, VkCommandBuffer CommandBuffer, VkImage Image,
+			const uint32_t ImageMip, const uint32_t FirstMip, const uint32_t EndMip)
+		{
+			const size_t First = Source.Mips[FirstMip].Offset;
+			const size_t End = Source.Mips[EndMip - 1].Offset + Source.Mips[EndMip - 1].Size;
+			StagingBuffer Staging = CreateStagingBuffer(GFXDevice, Source.Data.data() + First, End - First);
+
+			std::vector<VkBufferImageCopy> Regions;
+			for (uint32_t Mip = FirstMip; Mip < EndMip; ++Mip)
+			{
+				VkBufferImageCopy Region = {};
+				Region.bufferOffset = Source.Mips[Mip].Offset - First;
+				Region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+				Region.imageSubresource.mipLevel = Mip - ImageMip;
+				Region.imageSubresource.layerCount = 1;
+				Region.imageExtent.width = Source.Mips[Mip].Width;
+				Region.imageExtent.height = Source.Mips[Mip].Height;
+				Region.imageExtent.depth = 1;
+				Regions.push_back(Region);
+			}
+			vkCmdCopyBufferToImage(CommandBuffer, Staging.Buffer, Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+				static_cast<uint32_t> (Regions.size()), Regions.data());
+
+			return Staging;
+		}
+
+		//Replaces the resident image with one holding mips [NewMip, MipCount)
+		//Mips that were already resident are copied on the GPU, newly required ones are uploaded from the source
+		void SetResidentMip(GraphicsDevice& GFXDevice, TextureStreamer& Streamer, StreamedTexture& Tex, VkCommandBuffer CommandBuffer, const uint32_t NewMip)
+		{
+			const TextureFileData& Source = Tex.Source;
+			const uint32_t MipCount = static_cast<uint32_t> (Source.Mips.size());
+			const bool bHasOld = Tex.Resident != ImageHandle();
+			const Texture OldImage = bHasOld ? GetImage(*Streamer.Registry, Tex.Resident).Image : Texture();
+			const uint32_t OldMip = bHasOld ? Tex.ResidentMip : MipCount;
+
+			Texture NewImage = CreateImage(GFXDevice, Source.Mips[NewMip].Width, Source.Mips[NewMip].Height, MipCount - NewMip, Source.Format,
+				VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_SAMPLED_BIT);
+			CmdTransitionImageLayout(CommandBuffer, NewImage.Image, 0, MipCount - NewMip, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
+			StreamingGarbage Garbage;
+
+			//Levels finer than what was resident come from the source data, or are blitted from mip 0 when only it is on the CPU
+			if (NewMip < OldMip && Tex.bGeneratedMips && NewMip == 0)
+			{
+				Garbage.Staging = CmdUploadMips(GFXDevice, Source, CommandBuffer, NewImage.Image, 0, 0, 1);
+				CmdGenerateMips(CommandBuffer, NewImage.Image, Source.Width, Source.Height, 1, OldMip);
+			}
+			else if (NewMip < OldMip && Tex.bGeneratedMips)
+			{
+				//Mip 0 isn't part of the new image, build the levels above the resident ones in a scratch image and copy the needed ones out
+				//The scratch image is short lived and isn't counted against the budget
+				Texture Scratch = CreateImage(GFXDevice, Source.Width, Source.Height, OldMip, Source.Format, VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT);
+				CmdTransitionImageLayout(CommandBuffer, Scratch.Image, 0, OldMip, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+				Garbage.Staging = CmdUploadMips(GFXDevice, Source, CommandBuffer, Scratch.Image, 0, 0, 1);
+				CmdGenerateMips(CommandBuffer, Scratch.Image, Source.Width, Source.Height, 1, OldMip);
+				CmdTransitionImageLayout(CommandBuffer, Scratch.Image, NewMip, OldMip - NewMip, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+
+				std::vector<VkImageCopy> Regions;
+				for (uint32_t Mip = NewMip; Mip < OldMip; ++Mip)
+				{
+					VkImageCopy Region = {};
+					Region.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+					Region.srcSubresource.mipLevel = Mip;
+					Region.srcSubresource.layerCount = 1;
+					Region.dstSubresource = Region.srcSubresource;
+					Region.dstSubresource.mipLevel = Mip - NewMip;
+					Region.extent.width = Source.Mips[Mip].Width;
+					Region.extent.height = Source.Mips[Mip].Height;
+					Region.extent.depth = 1;
+					Regions.push_back(Region);
+				}
+				vkCmdCopyImage(CommandBuffer, Scratch.Image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, NewImage.Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+					static_cast<uint32_t> (Regions.size()), Regions.data());
+
+				DeferDeletion(*Streamer.Deletions, [Scratch](GraphicsDevice& GFXDevice) mutable
+				{
+					DestroyTexture(GFXDevice, Scratch);
+				});
+			}
+			else if (NewMip < OldMip)
+			{
+				Garbage.Staging = CmdUploadMips(GFXDevice, Source, CommandBuffer, NewImage.Image, NewMip, NewMip, OldMip);
+			}
+
+			//Levels that stay resident are copied image to image
+			if (bHasOld)
+			{
+				const uint32_t FirstShared = std::max(NewMip, OldMip);
+				if (FirstShared < MipCount)
+				{
+					CmdTransitionImageLayout(CommandBuffer, OldImage.Image, FirstShared - OldMip, MipCount - FirstShared,
+						VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+
+					std::vector<VkImageCopy> Regions;
+					for (uint32_t Mip = FirstShared; Mip < MipCount; ++Mip)
+					{
+						VkImageCopy Region = {};
+						Region.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+						Region.srcSubresource.mipLevel = Mip - OldMip;
+						Region.srcSubresource.layerCount = 1;
+						Region.dstSubresource = Region.srcSubresource;
+						Region.dstSubresource.mipLevel = Mip - NewMip;
+						Region.extent.width = Source.Mips[Mip].Width;
+						Region.extent.height = Source.Mips[Mip].Height;
+						Region.extent.depth = 1;
+						Regions.push_back(Region);
+					}
+					vkCmdCopyImage(CommandBuffer, OldImage.Image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, NewImage.Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+						static_cast<uint32_t> (Regions.size()), Regions.data());
+				}
+
+				//Earlier frames may still be sampling the old image
+				Garbage.Bytes = Tex.ResidentBytes;
+			}
+
+			CmdTransitionImageLayout(CommandBuffer, NewImage.Image, 0, MipCount - NewMip, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+			Streamer.ResidentBytes -= Tex.ResidentBytes;
+			Tex.ResidentBytes = MipRangeBytes(Source, NewMip);
+			Streamer.ResidentBytes += Tex.ResidentBytes;
+			SwapResidentImage(Streamer, Tex, NewImage);
+
+			if (Garbage.Bytes > 0 || Garbage.Staging.Buffer != VK_NULL_HANDLE)
+			{
+				RetireGarbage(Streamer, Garbage);
+			}
+			UpdatePeakBytes(Streamer);
+
+			Tex.ResidentMip = NewMip;
+			++Tex.Version;
+		}
+
+		//Builds the replacement for mips [NewMip, MipCount) on the transfer queue, false when no upload batch is free this frame
+		//The old image stays in use by the graphics queue meanwhile, so every level comes from the source data rather than an image copy
+		bool ScheduleResidentMip(GraphicsDevice& GFXDevice, TextureStreamer& Streamer, StreamedTexture& Tex, const uint32_t NewMip)
+		{
+			UploadScheduler& Uploads = *Streamer.Uploads;
+			const uint64_t Ticket = BeginUploadBatch(GFXDevice, Uploads);
+			if (Ticket == UploadTicketNone)
+			{
+				return false;
+			}
+
+			const TextureFileData& Source = Tex.Source;
+			const uint32_t MipCount = static_cast<uint32_t> (Source.Mips.size());
+			VkCommandBuffer CommandBuffer = GetUploadCommandBuffer(Uploads);
+
+			Texture NewImage = CreateImage(GFXDevice, Source.Mips[NewMip].Width, Source.Mips[NewMip].Height, MipCount - NewMip, Source.Format,
+				VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_SAMPLED_BIT);
+			CmdTransitionImageLayout(CommandBuffer, NewImage.Image, 0, MipCount - NewMip, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+			RetainStagingBuffer(Uploads, CmdUploadMips(GFXDevice, Source, CommandBuffer, NewImage.Image, NewMip, NewMip, MipCount));
+			CmdReleaseImageToGraphics(Uploads, NewImage.Image, 0, MipCount - NewMip, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+				VK_ACCESS_SHADER_READ_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+
+			//Both images are alive until the swap, count the new one from now on
+			Streamer.ResidentBytes += MipRangeBytes(Source, NewMip);
+			UpdatePeakBytes(Streamer);
+
+			Tex.Pending = NewImage;
+			Tex.PendingMip = NewMip;
+			Tex.PendingTicket = Ticket;
+			return true;
+		}
+
+		//Drops the finest mip of least recently requested textures until Bytes more fit in the resident budget
+		//Textures whose finest mip isn't being asked for go first, Protected is never touched
+		//Retired images count too, and since every eviction retires a whole image, growth waits until that memory is actually freed
+		bool MakeResidentRoom(GraphicsDevice& GFXDevice, TextureStreamer& Streamer, VkCommandBuffer CommandBuffer, const VkDeviceSize Bytes, const uint32_t Protected)
+		{
+			const VkDeviceSize Budget = Streamer.Config.ResidentBudget;
+			if (Streamer.RetiredBytes > 0 && Streamer.ResidentBytes + Streamer.RetiredBytes + Bytes > Budget)
+			{
+				return false;
+			}
+
+			bool bEvicted = false;
+			while (Streamer.ResidentBytes + Bytes > Budget)
+			{
+				int Victim = -1;
+				bool bVictimNeeded = true;
+
+				for (uint32_t i = 0; i < Streamer.Textures.size(); ++i)
+				{
+					const StreamedTexture& Tex = Streamer.Textures[i];
+					if (i == Protected || Tex.ResidentMip >= Tex.MinResidentMip || Tex.PendingTicket != UploadTicketNone)
+					{
+						continue;
+					}
+
+					bool bNeeded = Tex.RequestedMip <= Tex.ResidentMip;
+					if (Victim < 0 || (!bNeeded && bVictimNeeded) ||
+						(bNeeded == bVictimNeeded && Tex.LastRequestedFrame < Streamer.Textures[Victim].LastRequestedFrame))
+					{
+						Victim = static_cast<int> (i);
+						bVictimNeeded = bNeeded;
+					}
+				}
+
+				if (Victim < 0)
+				{
+					return false;
+				}
+
+				StreamedTexture& Tex = Streamer.Textures[Victim];
+				SetResidentMip(GFXDevice, Streamer, Tex, CommandBuffer, Tex.ResidentMip + 1);
+				bEvicted = true;
+			}
+
+			return !bEvicted;
+		}
+	}
+
+	TextureStreamer CreateTextureStreamer(GraphicsDevice& GFXDevice, const StreamingConfig& Config, const uint32_t MaxTextures, ResourceRegistry& Registry,
+		DeletionQueue& Deletions, UploadScheduler* Uploads)
+	{
+		TextureStreamer RetVal;
+		RetVal.Config = Config;
+		RetVal.Registry = &Registry;
+		RetVal.Deletions = &Deletions;
+		RetVal.Uploads = Uploads;
+		RetVal.Textures.reserve(MaxTextures);
+		RetVal.MaxTextures = MaxTextures;
+
+		//Persistently mapped so the CPU reads each region in place once its frame has finished
+		TextureFeedbackBuffer& Feedback = RetVal.Feedback;
+		Feedback.FrameCount = std::max(Config.FramesInFlight, 1u);
+		Feedback.RegionRange = MaxTextures * sizeof(uint32_t);
+		Feedback.RegionStride = RoundToNextMultiple(Feedback.RegionRange, std::max<VkDeviceSize>(GFXDevice.Properties.limits.minStorageBufferOffsetAlignment, 1));
+		Feedback.RecordedMips.resize(Feedback.FrameCount * MaxTextures, 0);
+
+		const int FeedbackSize = static_cast<int> (Feedback.RegionStride * Feedback.FrameCount);
+		std::vector<MemoryTypeInfo> MemoryHeaps = EnumerateHeaps(GFXDevice.PhysicalDevice);
+		Feedback.Buffer = AllocateBuffer(GFXDevice.Device, FeedbackSize, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+
+		VkMemoryRequirements MemoryRequirements = {};
+		vkGetBufferMemoryRequirements(GFXDevice.Device, Feedback.Buffer, &MemoryRequirements);
+		Feedback.DeviceMemory = AllocateMemory(GFXDevice.Device, MemoryHeaps, MemoryRequirements, false);
+		vkBindBufferMemory(GFXDevice.Device, Feedback.Buffer, Feedback.DeviceMemory, 0);
+
+		void* Mapping = nullptr;
+		vkMapMemory(GFXDevice.Device, Feedback.DeviceMemory, 0, VK_WHOLE_SIZE, 0, &Mapping);
+		Feedback.Mapped = static_cast<uint32_t*> (Mapping);
+		std::fill(Feedback.Mapped, Feedback.Mapped + FeedbackSize / sizeof(uint32_t), FeedbackNotSampled);
+		FlushFeedback(GFXDevice, Feedback);
+
+		return RetVal;
+	}
+
+	uint32_t AddStreamedTexture(GraphicsDevice& GFXDevice, TextureStreamer& Streamer, VkCommandBuffer UploadCommandBuffer, TextureFileData&& Source)
+	{
+		if (Streamer.Textures.size() >= Streamer.MaxTextures)
+		{
+			std::cout << "Texture streamer is full (" << Streamer.MaxTextures << " textures)" << std::endl;
+			return StreamedTextureNone;
+		}
+
+		const uint32_t TextureIndex = static_cast<uint32_t> (Streamer.Textures.size());
+		Streamer.Textures.push_back(StreamedTexture());
+		StreamedTexture& Tex = Streamer.Textures.back();
+		Tex.Source = std::move(Source);
+
+		//Without mips there is nothing coarser to stream in first, describe the full chain and blit it from mip 0 instead
+		const uint32_t FullMipCount = CalculateMipLevels(Tex.Source.Width, Tex.Source.Height);
+		if (Tex.Source.Mips.size() == 1 && FullMipCount > 1)
+		{
+			if (CanGenerateMips(GFXDevice, Tex.Source.Format))
+			{
+				for (uint32_t Mip = 1; Mip < FullMipCount; ++Mip)
+				{
+					TextureMip Level;
+					Level.Width = std::max(Tex.Source.Width >> Mip, 1u);
+					Level.Height = std::max(Tex.Source.Height >> Mip, 1u);
+					Level.Size = GetMipSize(Tex.Source.Format, Level.Width, Level.Height);
+					Tex.Source.Mips.push_back(Level);
+				}
+				Tex.bGeneratedMips = true;
+			}
+			else
+			{
+				std::cout << "Format " << Tex.Source.Format << " can't be linearly blitted, streaming a texture without mips" << std::endl;
+			}
+		}
+
+		//Start from the first mip small enough to always keep around
+		const uint32_t MipCount = static_cast<uint32_t> (Tex.Source.Mips.size());
+		Tex.MinResidentMip = MipCount - 1;
+		for (uint32_t Mip = 0; Mip < MipCount; ++Mip)
+		{
+			if (std::max(Tex.Source.Mips[Mip].Width, Tex.Source.Mips[Mip].Height) <= Streamer.Config.InitialMipSize)
+			{
+				Tex.MinResidentMip = Mip;
+				break;
+			}
+		}
+		Tex.ResidentMip = MipCount;
+		Tex.RequestedMip = MipCount;
+
+		auto Start = std::chrono::high_resolution_clock::now();
+		SetResidentMip(GFXDevice, Streamer, Tex, UploadCommandBuffer, Tex.MinResidentMip);
+		const double RecordMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - Start).count();
+
+		//Compare against what the same mip chain would cost as plain RGBA8, generated mips aren't stored
+		size_t UncompressedBytes = 0;
+		for (uint32_t Mip = 0; Mip < (Tex.bGeneratedMips ? 1 : MipCount); ++Mip)
+		{
+			UncompressedBytes += static_cast<size_t> (Tex.Source.Mips[Mip].Width) * Tex.Source.Mips[Mip].Height * 4;
+		}
+		const size_t StoredBytes = Tex.Source.Data.size();
+		const size_t SavedBytes = UncompressedBytes > StoredBytes ? UncompressedBytes - StoredBytes : 0;
+
+		std::cout << "Texture streamed: " << Tex.Source.Width << "x" << Tex.Source.Height << ", " << MipCount << " mips (" << MipCount - Tex.ResidentMip
+			<< " resident" << (Tex.bGeneratedMips ? ", blitted on the GPU" : "") << "), format " << Tex.Source.Format
+			<< (Tex.Source.bTranscoded ? " (transcoded)" : "") << std::endl;
+		std::cout << "    " << StoredBytes / 1024 << " KB vs " << UncompressedBytes / 1024 << " KB as RGBA8, saved " << SavedBytes / 1024 << " KB" << std::endl;
+		std::cout << "    Load " << Tex.Source.LoadMilliseconds << " ms, initial upload recorded in " << RecordMilliseconds << " ms" << std::endl;
+
+		return TextureIndex;
+	}
+
+	void RequestTextureMip(TextureStreamer& Streamer, const uint32_t TextureIndex, const uint32_t Mip)
+	{
+		StreamedTexture& Tex = Streamer.Textures[TextureIndex];
+		Tex.RequestedMip = std::min(Tex.RequestedMip, Mip);
+		Tex.LastRequestedFrame = Streamer.FrameNumber;
+	}
+
+	void ReadTextureFeedback(GraphicsDevice& GFXDevice, TextureStreamer& Streamer, const uint32_t Frame)
+	{
+		TextureFeedbackBuffer& Feedback = Streamer.Feedback;
+		Feedback.CurrentFrame = Frame % Feedback.FrameCount;
+
+		//The memory may not be host coherent
+		VkMappedMemoryRange Range = {};
+		Range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+		Range.memory = Feedback.DeviceMemory;
+		Range.size = VK_WHOLE_SIZE;
+		vkInvalidateMappedMemoryRanges(GFXDevice.Device, 1, &Range);
+
+		uint32_t* Slots = Feedback.Mapped + GetTextureFeedbackOffset(Streamer, Feedback.CurrentFrame) / sizeof(uint32_t);
+		const uint32_t* RecordedMips = Feedback.RecordedMips.data() + Feedback.CurrentFrame * Streamer.MaxTextures;
+		for (uint32_t i = 0; i < Streamer.Textures.size(); ++i)
+		{
+			const uint32_t SampledLevel = Slots[i];
+			Slots[i] = FeedbackNotSampled;
+			if (SampledLevel == FeedbackNotSampled)
+			{
+				continue;
+			}
+
+			//The level was relative to the image the frame sampled, whose mip 0 was Source mip RecordedMips[i]
+			const uint32_t MipCount = static_cast<uint32_t> (Streamer.Textures[i].Source.Mips.size());
+			const uint32_t BiasedMip = RecordedMips[i] + SampledLevel;
+			RequestTextureMip(Streamer, i, BiasedMip > FeedbackLodBias ? std::min(BiasedMip - FeedbackLodBias, MipCount - 1) : 0);
+		}
+		FlushFeedback(GFXDevice, Feedback);
+	}
+
+	VkDeviceSize GetTextureFeedbackOffset(const TextureStreamer& Streamer, const uint32_t Frame)
+	{
+		return Frame * Streamer.Feedback.RegionStride;
+	}
+
+	void UpdateTextureStreaming(GraphicsDevice& GFXDevice, TextureStreamer& Streamer, VkCommandBuffer CommandBuffer)
+	{
+		//Transfers acquired by this frame's command buffer are safe to sample from here on
+		if (Streamer.Uploads)
+		{
+			for (StreamedTexture& Tex : Streamer.Textures)
+			{
+				if (Tex.PendingTicket == UploadTicketNone || Tex.PendingTicket > Streamer.Uploads->AcquiredTicket)
+				{
+					continue;
+				}
+
+				StreamingGarbage Garbage;
+				Garbage.Bytes = Tex.ResidentBytes;
+
+				//The new image's bytes were counted when it was scheduled
+				Streamer.ResidentBytes -= Tex.ResidentBytes;
+				Tex.ResidentBytes = MipRangeBytes(Tex.Source, Tex.PendingMip);
+				SwapResidentImage(Streamer, Tex, Tex.Pending);
+				RetireGarbage(Streamer, Garbage);
+
+				Tex.ResidentMip = Tex.PendingMip;
+				Tex.Pending = Texture();
+				Tex.PendingTicket = UploadTicketNone;
+				++Tex.Version;
+			}
+		}
+
+		//Biggest shortfall first, one mip per texture per frame
+		std::vector<uint32_t> Wanted;
+		for (uint32_t i = 0; i < Streamer.Textures.size(); ++i)
+		{
+			const StreamedTexture& Tex = Streamer.Textures[i];
+			if (Tex.RequestedMip < Tex.ResidentMip && Tex.PendingTicket == UploadTicketNone)
+			{
+				Wanted.push_back(i);
+			}
+		}
+		std::sort(Wanted.begin(), Wanted.end(), [&Streamer](const uint32_t A, const uint32_t B)
+		{
+			const StreamedTexture& TexA = Streamer.Textures[A];
+			const StreamedTexture& TexB = Streamer.Textures[B];
+			return (TexA.ResidentMip - TexA.RequestedMip) > (TexB.ResidentMip - TexB.RequestedMip);
+		});
+
+		VkDeviceSize UploadedBytes = 0;
+		for (uint32_t TextureIndex : Wanted)
+		{
+			StreamedTexture& Tex = Streamer.Textures[TextureIndex];
+			const uint32_t NewMip = Tex.bGeneratedMips ? 0 : Tex.ResidentMip - 1;
+
+			//The transfer path re-uploads the whole chain and keeps the old image until the swap
+			//Generated mips are blitted on the graphics queue, every level above the resident ones at once
+			const bool bTransfer = Streamer.Uploads && !Tex.bGeneratedMips;
+			const VkDeviceSize Cost = bTransfer ? MipRangeBytes(Tex.Source, NewMip) : MipRangeBytes(Tex.Source, NewMip) - MipRangeBytes(Tex.Source, Tex.ResidentMip);
+
+			if (UploadedBytes > 0 && UploadedBytes + Cost > Streamer.Config.UploadBudgetPerFrame)
+			{
+				break;
+			}
+			if (!MakeResidentRoom(GFXDevice, Streamer, CommandBuffer, Cost, TextureIndex))
+			{
+				continue;
+			}
+
+			if (bTransfer)
+			{
+				if (!ScheduleResidentMip(GFXDevice, Streamer, Tex, NewMip))
+				{
+					break;
+				}
+			}
+			else
+			{
+				SetResidentMip(GFXDevice, Streamer, Tex, CommandBuffer, NewMip);
+			}
+			UploadedBytes += Cost;
+		}
+
+		UpdatePeakBytes(Streamer);
+
+		//Draws recorded from here on sample these images, so this frame's feedback is relative to them
+		uint32_t* RecordedMips = Streamer.Feedback.RecordedMips.data() + Streamer.Feedback.CurrentFrame * Streamer.MaxTextures;
+		for (uint32_t i = 0; i < Streamer.Textures.size(); ++i)
+		{
+			StreamedTexture& Tex = Streamer.Textures[i];
+			Tex.RequestedMip = static_cast<uint32_t> (Tex.Source.Mips.size());
+			RecordedMips[i] = Tex.ResidentMip;
+		}
+		++Streamer.FrameNumber;
+	}
+
+	void CmdFinishTextureFeedback(VkCommandBuffer CommandBuffer, const TextureStreamer& Streamer)
+	{
+		//Read by the host once the frame's timeline value has completed
+		VkBufferMemoryBarrier Barrier = {};
+		Barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+		Barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+		Barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+		Barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		Barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		Barrier.buffer = Streamer.Feedback.Buffer;
+		Barrier.offset = GetTextureFeedbackOffset(Streamer, Streamer.Feedback.CurrentFrame);
+		Barrier.size = Streamer.Feedback.RegionRange;
+		vkCmdPipelineBarrier(CommandBuffer, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr, 1, &Barrier, 0, nullptr);
+	}
+
+	void DestroyTextureStreamer(GraphicsDevice& GFXDevice, TextureStreamer& Streamer)
+	{
+		for (StreamedTexture& Tex : Streamer.Textures)
+		{
+			if (Tex.PendingTicket != UploadTicketNone)
+			{
+				DestroyTexture(GFXDevice, Tex.Pending);
+			}
+		}
+		Streamer.Textures.clear();
+
+		std::cout << "Texture streaming peak resident memory: " << Streamer.PeakResidentBytes / 1024 << " KB" << std::endl;
+
+		vkUnmapMemory(GFXDevice.Device, Streamer.Feedback.DeviceMemory);
+		vkDestroyBuffer(GFXDevice.Device, Streamer.Feedback.Buffer, nullptr);
+		vkFreeMemory(GFXDevice.Device, Streamer.Feedback.DeviceMemory, nullptr);
+		Streamer.Feedback = TextureFeedbackBuffer();
+	}
+}
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "TextureLoader.h"
+#include "ResourceRegistry.h"
+#include <vector>
+
+namespace VulkanCore
+{
+	struct UploadScheduler;
+	struct DeletionQueue;
+
+	struct StreamingConfig
+	{
+		//Bytes of new mip data uploaded per frame at most (a single mip larger than this still goes through on an otherwise idle frame)
+		VkDeviceSize UploadBudgetPerFrame = 4 * 1024 * 1024;
+
+		//Resident texture memory the streamer evicts down to, independent of how much content is registered
+		VkDeviceSize ResidentBudget = 64 * 1024 * 1024;
+
+		//Textures start with every mip at or below this size resident
+		uint32_t InitialMipSize = 64;
+
+		//Frames that may be sampling at once, each writes feedback into its own region
+		uint32_t FramesInFlight = 2;
+	};
+
+	//A texture whose finest mips are loaded on demand from a CPU side copy of the full chain
+	struct StreamedTexture
+	{
+		TextureFileData Source;
+
+		//Source came without mips: Data holds mip 0 only, the rest of Mips describes levels blitted from it on the GPU
+		//Raising residency then goes straight back to mip 0 (one upload instead of one per level), on the graphics queue
+		bool bGeneratedMips = false;
+
+		//Registered image holding mips [ResidentMip, MipCount) of Source, its mip 0 is Source mip ResidentMip
+		//Replaced under the same handle whenever residency changes
+		ImageHandle Resident;
+		uint32_t ResidentMip = 0;
+
+		//Coarsest resident level we never evict past
+		uint32_t MinResidentMip = 0;
+
+		//Finest mip asked for this frame, MipCount when nothing asked
+		uint32_t RequestedMip = 0;
+		uint64_t LastRequestedFrame = 0;
+
+		//Bumped whenever Resident is replaced so descriptor sets know to rewrite their image view
+		uint32_t Version = 0;
+		VkDeviceSize ResidentBytes = 0;
+
+		//Replacement holding mips [PendingMip, MipCount) being filled on the transfer queue, swapped in once PendingTicket is acquired
+		//PendingTicket is 0 (UploadTicketNone) when nothing is pending
+		Texture Pending;
+		uint32_t PendingMip = 0;
+		uint64_t PendingTicket = 0;
+	};
+
+	//Staging buffers that in-flight frames may still use, Bytes is the replaced image's share of RetiredBytes
+	//The image itself is released by ReplaceImage, garbage queued right after it so the bytes stop counting once it's gone
+	struct StreamingGarbage
+	{
+		StagingBuffer Staging;
+		VkDeviceSize Bytes = 0;
+	};
+
+	//Value feedback slots are reset to, meaning "not sampled"
+	static const uint32_t FeedbackNotSampled = 0xFFFFFFFF;
+
+	//Added to the sampled level before it's written, so levels finer than the resident image's mip 0 stay positive
+	static const uint32_t FeedbackLodBias = 16;
+
+	//The fragment shaders atomicMin the level they sample (relative to the bound image, plus FeedbackLodBias) into MinMip[texture index]
+	//One region of MaxTextures slots per frame in flight, read back once the frame that wrote it has finished
+	struct TextureFeedbackBuffer
+	{
+		VkBuffer Buffer = VK_NULL_HANDLE;
+		VkDeviceMemory DeviceMemory = VK_NULL_HANDLE;
+		uint32_t* Mapped = nullptr;
+
+		//Regions start at multiples of RegionStride (aligned for storage buffer offsets), RegionRange is the part the shaders index
+		VkDeviceSize RegionStride = 0;
+		VkDeviceSize RegionRange = 0;
+		uint32_t FrameCount = 0;
+
+		//Region the frame being recorded writes
+		uint32_t CurrentFrame = 0;
+
+		//ResidentMip of every texture when each region's frame was recorded, the sampled levels are relative to it
+		std::vector<uint32_t> RecordedMips;
+	};
+
+	struct TextureStreamer
+	{
+		StreamingConfig Config;
+		std::vector<StreamedTexture> Textures;
+
+		//Textures is reserved up front so references into it stay valid
+		uint32_t MaxTextures = 0;
+		TextureFeedbackBuffer Feedback;
+
+		//Resident images are registered here, replaced ones and retired garbage go to Deletions
+		ResourceRegistry* Registry = nullptr;
+		DeletionQueue* Deletions = nullptr;
+
+		//Mip upgrades go through this when set, otherwise they're recorded into the frame's command buffer
+		UploadScheduler* Uploads = nullptr;
+
+		VkDeviceSize ResidentBytes = 0;
+
+		//Replaced images still allocated until the frames using them finish, they count against ResidentBudget too
+		VkDeviceSize RetiredBytes = 0;
+
+		//Highest ResidentBytes + RetiredBytes seen
+		VkDeviceSize PeakResidentBytes = 0;
+		uint64_t FrameNumber = 0;
+	};
+
+	//Returned by AddStreamedTexture when the streamer is full
+	static const uint32_t StreamedTextureNone = 0xFFFFFFFF;
+
+	//With Uploads, finer mips are uploaded on the dedicated transfer queue and appear a few frames later, rendering never waits on them
+	//Deletions runs garbage releases that update the streamer's RetiredBytes, so the streamer must stay in place until it's destroyed
+	TextureStreamer CreateTextureStreamer(GraphicsDevice& GFXDevice, const StreamingConfig& Config, const uint32_t MaxTextures, ResourceRegistry& Registry,
+		DeletionQueue& Deletions, UploadScheduler* Uploads = nullptr);
+
+	//Registers a texture and records the upload of its low mips into UploadCommandBuffer, returns its index
+	//A single mip source in a blittable format gets the rest of its chain blitted on the GPU, UploadCommandBuffer must then belong to a graphics queue
+	uint32_t AddStreamedTexture(GraphicsDevice& GFXDevice, TextureStreamer& Streamer, VkCommandBuffer UploadCommandBuffer, TextureFileData&& Source);
+
+	//Asks for Mip this frame, residency follows the finest mip requested
+	//ReadTextureFeedback calls this for every texture the shaders sampled
+	void RequestTextureMip(TextureStreamer& Streamer, const uint32_t TextureIndex, const uint32_t Mip);
+
+	//Call once per frame after the frame timeline wait, before UpdateTextureStreaming
+	//Requests the mips Frame's region saw sampled when it last ran, then clears it for the frame about to be recorded
+	void ReadTextureFeedback(GraphicsDevice& GFXDevice, TextureStreamer& Streamer, const uint32_t Frame);
+
+	//Start of Frame's region in Streamer.Feedback.Buffer, bind RegionRange bytes from here as the shaders' feedback buffer
+	VkDeviceSize GetTextureFeedbackOffset(const TextureStreamer& Streamer, const uint32_t Frame);
+
+	//Call once per frame after ReadTextureFeedback: evicts and records uploads into CommandBuffer
+	//Must be recorded outside a render pass
+	void UpdateTextureStreaming(GraphicsDevice& GFXDevice, TextureStreamer& Streamer, VkCommandBuffer CommandBuffer);
+
+	//Makes the current region's shader writes visible to the host, record after the frame's last draw
+	void CmdFinishTextureFeedback(VkCommandBuffer CommandBuffer, const TextureStreamer& Streamer);
+
+	//Device must be idle and Deletions already destroyed, which frees whatever was still retired
+	//Resident images stay registered, DestroyResourceRegistry destroys them, the feedback buffer is freed here
+	void DestroyTextureStreamer(GraphicsDevice& GFXDevice, TextureStreamer& Streamer);
+}
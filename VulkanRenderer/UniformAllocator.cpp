@@ -0,0 +1,126 @@
+#include "UniformAllocator.h"
+#include "VulkanInitializers.h"
+#include <iostream>
+#include <algorithm>
+#include <cstring>
+
+namespace VulkanCore
+{
+	UniformAllocator CreateUniformAllocator(GraphicsDevice& GFXDevice, ResourceRegistry& Registry, DescriptorLayoutCache& LayoutCache, const uint32_t FrameCount,
+		const VkDeviceSize FrameSize, const VkDeviceSize MaxRange, const VkShaderStageFlags Stages)
+	{
+		const VkPhysicalDeviceLimits& Limits = GFXDevice.Properties.limits;
+
+		UniformAllocator RetVal;
+		RetVal.Alignment = std::max<VkDeviceSize>(Limits.minUniformBufferOffsetAlignment, 1);
+		RetVal.MaxRange = std::min<VkDeviceSize>(MaxRange, Limits.maxUniformBufferRange);
+		RetVal.FrameSize = RoundToNextMultiple(FrameSize, RetVal.Alignment);
+		RetVal.FrameCount = FrameCount;
+
+		//Region starts stay aligned, so frame base + allocation offset is always a legal dynamic offset
+		//The descriptor's range is read from the offset on, the tail padding keeps the last frame's final slice in bounds
+		const int BufferSize = static_cast<int> (RetVal.FrameSize * FrameCount + RetVal.MaxRange);
+		std::vector<MemoryTypeInfo> MemoryHeaps = EnumerateHeaps(GFXDevice.PhysicalDevice);
+		VkBuffer Buffer = AllocateBuffer(GFXDevice.Device, BufferSize, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+
+		VkMemoryRequirements MemoryRequirements = {};
+		vkGetBufferMemoryRequirements(GFXDevice.Device, Buffer, &MemoryRequirements);
+		VkDeviceMemory DeviceMemory = AllocateMemory(GFXDevice.Device, MemoryHeaps, MemoryRequirements, false);
+		vkBindBufferMemory(GFXDevice.Device, Buffer, DeviceMemory, 0);
+
+		//Host coherent (always available for uniform buffers), so writes need no flush
+		void* Mapping = nullptr;
+		vkMapMemory(GFXDevice.Device, DeviceMemory, 0, VK_WHOLE_SIZE, 0, &Mapping);
+		RetVal.Mapped = static_cast<uint8_t*> (Mapping);
+		RetVal.Buffer = RegisterBuffer(Registry, Buffer, DeviceMemory, MemoryRequirements.size);
+
+		std::vector<VkDescriptorSetLayoutBinding> Bindings(1);
+		Bindings[0].binding = 0;
+		Bindings[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+		Bindings[0].descriptorCount = 1;
+		Bindings[0].stageFlags = Stages;
+		RetVal.Layout = GetDescriptorSetLayout(GFXDevice, LayoutCache, Bindings);
+
+		std::vector<VkDescriptorPoolSize> PoolSizes(1);
+		PoolSizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+		PoolSizes[0].descriptorCount = 1;
+		RetVal.Pool = CreateDescriptorPool(GFXDevice, PoolSizes, 1);
+		RetVal.Set = AllocateDescriptorSet(GFXDevice, RetVal.Pool, RetVal.Layout);
+
+		//Written once, the offset supplied at bind time picks the slice
+		DescriptorWriter Writer;
+		WriteBuffer(Writer, RetVal.Set, 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, GetBuffer(Registry, RetVal.Buffer).Buffer, 0, RetVal.MaxRange);
+		FlushDescriptorWrites(GFXDevice, Writer);
+
+		return RetVal;
+	}
+
+	void BeginUniformFrame(UniformAllocator& Allocator, const uint32_t FrameIndex)
+	{
+		Allocator.PeakFrameUsed = std::max(Allocator.PeakFrameUsed, Allocator.FrameUsed);
+		Allocator.CurrentFrame = FrameIndex;
+		Allocator.FrameUsed = 0;
+	}
+
+	uint32_t AllocateUniforms(UniformAllocator& Allocator, const void* Data, const VkDeviceSize Size)
+	{
+		const VkDeviceSize Offset = Allocator.FrameUsed;
+		if (Size > Allocator.MaxRange || Offset + Size > Allocator.FrameSize)
+		{
+			std::cout << "Uniform allocator out of space (" << Allocator.FrameSize << " bytes per frame)" << std::endl;
+			return UniformAllocationFailed;
+		}
+
+		const VkDeviceSize BufferOffset = Allocator.CurrentFrame * Allocator.FrameSize + Offset;
+		memcpy(Allocator.Mapped + BufferOffset, Data, static_cast<size_t> (Size));
+		Allocator.FrameUsed = RoundToNextMultiple(Offset + Size, Allocator.Alignment);
+
+		return static_cast<uint32_t> (BufferOffset);
+	}
+
+	void CmdBindUniforms(VkCommandBuffer CommandBuffer, const UniformAllocator& Allocator, VkPipelineLayout PipelineLayout, const uint32_t SetIndex,
+		const uint32_t DynamicOffset)
+	{
+		vkCmdBindDescriptorSets(CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, PipelineLayout, SetIndex, 1, &Allocator.Set, 1, &DynamicOffset);
+	}
+
+	DrawDataPath DeclareDrawData(GraphicsDevice& GFXDevice, PipelineLayoutDesc& LayoutDesc, const VkShaderStageFlags Stages,
+		const uint32_t PushOffset, const uint32_t Size, const uint32_t UniformSetIndex)
+	{
+		DrawDataPath RetVal;
+		RetVal.Stages = Stages;
+		RetVal.PushOffset = PushOffset;
+		RetVal.Size = Size;
+		RetVal.UniformSetIndex = UniformSetIndex;
+		RetVal.bPushConstants = AddPushConstantRange(GFXDevice, LayoutDesc, Stages, PushOffset, Size);
+
+		if (!RetVal.bPushConstants)
+		{
+			std::cout << "Draw data (" << Size << " bytes) exceeds maxPushConstantsSize (" << GFXDevice.Properties.limits.maxPushConstantsSize
+				<< "), using uniform set " << UniformSetIndex << std::endl;
+		}
+		return RetVal;
+	}
+
+	void CmdWriteDrawData(VkCommandBuffer CommandBuffer, VkPipelineLayout PipelineLayout, const DrawDataPath& Path, UniformAllocator& Allocator, const void* Data)
+	{
+		if (Path.bPushConstants)
+		{
+			vkCmdPushConstants(CommandBuffer, PipelineLayout, Path.Stages, Path.PushOffset, Path.Size, Data);
+			return;
+		}
+
+		const uint32_t DynamicOffset = AllocateUniforms(Allocator, Data, Path.Size);
+		if (DynamicOffset != UniformAllocationFailed)
+		{
+			CmdBindUniforms(CommandBuffer, Allocator, PipelineLayout, Path.UniformSetIndex, DynamicOffset);
+		}
+	}
+
+	void DestroyUniformAllocator(GraphicsDevice& GFXDevice, ResourceRegistry& Registry, DeletionQueue& Deletions, UniformAllocator& Allocator)
+	{
+		vkDestroyDescriptorPool(GFXDevice.Device, Allocator.Pool, nullptr);
+		ReleaseBuffer(Registry, Deletions, Allocator.Buffer);
+		Allocator = UniformAllocator();
+	}
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "vulkan\vulkan.h"
+#include "Descriptors.h"
+#include "ResourceRegistry.h"
+
+namespace VulkanCore
+{
+	struct GraphicsDevice;
+	struct DeletionQueue;
+	struct PipelineLayoutDesc;
+
+	//Returned by AllocateUniforms when the frame's region is full
+	static const uint32_t UniformAllocationFailed = 0xFFFFFFFF;
+
+	//One persistently mapped uniform buffer split into a region per frame in flight
+	//Each region is bump allocated and reset whole once its frame's timeline value has completed
+	//A single UNIFORM_BUFFER_DYNAMIC descriptor covers the buffer, draws only change the dynamic offset
+	//The buffer is owned by a ResourceRegistry
+	struct UniformAllocator
+	{
+		BufferHandle Buffer;
+		uint8_t* Mapped = nullptr;
+
+		//minUniformBufferOffsetAlignment, every allocation starts on a multiple of it
+		VkDeviceSize Alignment = 0;
+		VkDeviceSize FrameSize = 0;
+
+		//Size of the window the descriptor exposes at each offset, the largest block one allocation can hold
+		VkDeviceSize MaxRange = 0;
+		uint32_t FrameCount = 0;
+
+		uint32_t CurrentFrame = 0;
+		VkDeviceSize FrameUsed = 0;
+		VkDeviceSize PeakFrameUsed = 0;
+
+		//Layout is owned by the layout cache it came from
+		VkDescriptorSetLayout Layout = VK_NULL_HANDLE;
+		VkDescriptorPool Pool = VK_NULL_HANDLE;
+		VkDescriptorSet Set = VK_NULL_HANDLE;
+	};
+
+	//FrameSize bytes per frame, MaxRange is clamped to maxUniformBufferRange, Stages are the shader stages that read it
+	UniformAllocator CreateUniformAllocator(GraphicsDevice& GFXDevice, ResourceRegistry& Registry, DescriptorLayoutCache& LayoutCache, const uint32_t FrameCount,
+		const VkDeviceSize FrameSize, const VkDeviceSize MaxRange, const VkShaderStageFlags Stages);
+
+	//Makes FrameIndex current and resets its region, the frame's timeline value must have completed
+	void BeginUniformFrame(UniformAllocator& Allocator, const uint32_t FrameIndex);
+
+	//Copies Size bytes into the current frame's region and returns the dynamic offset to bind them with
+	//A single memcpy, no Vulkan calls
+	uint32_t AllocateUniforms(UniformAllocator& Allocator, const void* Data, const VkDeviceSize Size);
+
+	template <typename T>
+	uint32_t AllocateUniforms(UniformAllocator& Allocator, const T& Data)
+	{
+		return AllocateUniforms(Allocator, &Data, sizeof(T));
+	}
+
+	//Binds the allocator's set at SetIndex of PipelineLayout with the offset returned by AllocateUniforms
+	void CmdBindUniforms(VkCommandBuffer CommandBuffer, const UniformAllocator& Allocator, VkPipelineLayout PipelineLayout, const uint32_t SetIndex,
+		const uint32_t DynamicOffset);
+
+	//Where a pipeline's per-draw block lives: push constants when it fits, otherwise a uniform allocation bound at UniformSetIndex
+	//The shaders must match, reading a push constant block at PushOffset or a uniform block at set UniformSetIndex binding 0
+	struct DrawDataPath
+	{
+		bool bPushConstants = false;
+		VkShaderStageFlags Stages = 0;
+		uint32_t PushOffset = 0;
+		uint32_t Size = 0;
+		uint32_t UniformSetIndex = 0;
+	};
+
+	//Adds a push constant range for Size bytes at PushOffset to LayoutDesc when it fits in maxPushConstantsSize
+	//Otherwise the caller creates a UniformAllocator and puts its layout at UniformSetIndex, so the buffer only exists on that path
+	DrawDataPath DeclareDrawData(GraphicsDevice& GFXDevice, PipelineLayoutDesc& LayoutDesc, const VkShaderStageFlags Stages,
+		const uint32_t PushOffset, const uint32_t Size, const uint32_t UniformSetIndex);
+
+	//Sets Path.Size bytes of Data for the following draws, vkCmdPushConstants on the fast path, a memcpy and dynamic offset bind otherwise
+	void CmdWriteDrawData(VkCommandBuffer CommandBuffer, VkPipelineLayout PipelineLayout, const DrawDataPath& Path, UniformAllocator& Allocator, const void* Data);
+
+	//Device must be idle, the buffer is released to Deletions
+	void DestroyUniformAllocator(GraphicsDevice& GFXDevice, ResourceRegistry& Registry, DeletionQueue& Deletions, UniformAllocator& Allocator);
+}
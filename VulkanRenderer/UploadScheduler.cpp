@@ -0,0 +1,205 @@
+#include "UploadScheduler.h"
+#include "VulkanInitializers.h"
+
+namespace VulkanCore
+{
+	UploadScheduler CreateUploadScheduler(GraphicsDevice& GFXDevice, const uint32_t BatchCount, const uint32_t FramesInFlight)
+	{
+		UploadScheduler RetVal;
+		RetVal.TransferFamily = GFXDevice.TransferQueueIndex;
+		RetVal.GraphicsFamily = GFXDevice.GraphicsQueueIndex;
+		RetVal.FramesInFlight = FramesInFlight;
+		RetVal.CommandPool = CreateCommandPool(GFXDevice, RetVal.TransferFamily);
+		RetVal.Timeline = CreateQueueTimeline(GFXDevice, GFXDevice.TransferQueue);
+
+		std::vector<VkCommandBuffer> CommandBuffers = AllocateCommandBuffers(GFXDevice, RetVal.CommandPool, BatchCount);
+
+		RetVal.Batches.resize(BatchCount);
+		for (uint32_t i = 0; i < BatchCount; ++i)
+		{
+			RetVal.Batches[i].CommandBuffer = CommandBuffers[i];
+		}
+		RetVal.RecordingBatch = RetVal.Batches.size();
+
+		return RetVal;
+	}
+
+	void BeginUploadFrame(GraphicsDevice& GFXDevice, UploadScheduler& Scheduler, VkCommandBuffer GraphicsCommandBuffer)
+	{
+		++Scheduler.FrameNumber;
+
+		//Last frame's submit consumed this
+		Scheduler.WaitValue = 0;
+		Scheduler.WaitStages = 0;
+
+		//The frame that acquired a batch has finished, so its staging memory and command buffer are free again
+		for (UploadBatch& Batch : Scheduler.Batches)
+		{
+			if (!Batch.bAcquired || Batch.AcquiredFrame + Scheduler.FramesInFlight > Scheduler.FrameNumber)
+			{
+				continue;
+			}
+
+			for (StagingBuffer& Staging : Batch.Staging)
+			{
+				DestroyStagingBuffer(GFXDevice, Staging);
+			}
+			Batch.Staging.clear();
+			Batch.bAcquired = false;
+			Batch.bInUse = false;
+		}
+
+		//Tickets are timeline values, so one counter read tells which batches are done
+		const uint64_t CompletedTicket = GetCompletedTimelineValue(GFXDevice, Scheduler.Timeline);
+		while (!Scheduler.Submitted.empty())
+		{
+			UploadBatch& Batch = Scheduler.Batches[Scheduler.Submitted.front()];
+			if (Batch.Ticket > CompletedTicket)
+			{
+				break;
+			}
+
+			//Acquire half of each ownership transfer, chained to the semaphore wait through the same stages
+			vkCmdPipelineBarrier(GraphicsCommandBuffer, Batch.AcquireStages, Batch.AcquireStages, 0, 0, nullptr,
+				static_cast<uint32_t> (Batch.BufferAcquires.size()), Batch.BufferAcquires.data(),
+				static_cast<uint32_t> (Batch.ImageAcquires.size()), Batch.ImageAcquires.data());
+
+			//Already reached, so the wait costs nothing but keeps the release/acquire ordering formally correct
+			Scheduler.WaitValue = Batch.Ticket;
+			Scheduler.WaitStages |= Batch.AcquireStages;
+
+			Batch.ImageAcquires.clear();
+			Batch.BufferAcquires.clear();
+			Batch.AcquiredFrame = Scheduler.FrameNumber;
+			Batch.bAcquired = true;
+			Scheduler.AcquiredTicket = Batch.Ticket;
+			Scheduler.Submitted.pop_front();
+		}
+	}
+
+	uint64_t BeginUploadBatch(GraphicsDevice& GFXDevice, UploadScheduler& Scheduler)
+	{
+		if (Scheduler.RecordingBatch < Scheduler.Batches.size())
+		{
+			return Scheduler.Batches[Scheduler.RecordingBatch].Ticket;
+		}
+
+		for (size_t i = 0; i < Scheduler.Batches.size(); ++i)
+		{
+			UploadBatch& Batch = Scheduler.Batches[i];
+			if (Batch.bInUse)
+			{
+				continue;
+			}
+
+			//Only one batch is open at a time, so it signals the next timeline value
+			Batch.bInUse = true;
+			Batch.Ticket = Scheduler.Timeline.LastSubmitted + 1;
+			Batch.AcquireStages = 0;
+			Scheduler.RecordingBatch = i;
+
+			VkCommandBufferBeginInfo BeginInfo = {};
+			BeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+			BeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+			vkBeginCommandBuffer(Batch.CommandBuffer, &BeginInfo);
+
+			return Batch.Ticket;
+		}
+
+		return UploadTicketNone;
+	}
+
+	VkCommandBuffer GetUploadCommandBuffer(UploadScheduler& Scheduler)
+	{
+		return Scheduler.Batches[Scheduler.RecordingBatch].CommandBuffer;
+	}
+
+	void CmdReleaseImageToGraphics(UploadScheduler& Scheduler, VkImage Image, const uint32_t BaseMip, const uint32_t MipCount, const VkImageLayout FinalLayout,
+		const VkAccessFlags DstAccess, const VkPipelineStageFlags DstStage)
+	{
+		UploadBatch& Batch = Scheduler.Batches[Scheduler.RecordingBatch];
+
+		VkImageMemoryBarrier Barrier = {};
+		Barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		Barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		Barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+		Barrier.newLayout = FinalLayout;
+		Barrier.srcQueueFamilyIndex = Scheduler.TransferFamily;
+		Barrier.dstQueueFamilyIndex = Scheduler.GraphicsFamily;
+		Barrier.image = Image;
+		Barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		Barrier.subresourceRange.baseMipLevel = BaseMip;
+		Barrier.subresourceRange.levelCount = MipCount;
+		Barrier.subresourceRange.layerCount = 1;
+
+		//Release: the destination access is ignored here, visibility comes from the acquire
+		vkCmdPipelineBarrier(Batch.CommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1, &Barrier);
+
+		//Acquire: identical ownership and layout fields, the source access is ignored
+		Barrier.srcAccessMask = 0;
+		Barrier.dstAccessMask = DstAccess;
+		Batch.ImageAcquires.push_back(Barrier);
+		Batch.AcquireStages |= DstStage;
+	}
+
+	void CmdReleaseBufferToGraphics(UploadScheduler& Scheduler, VkBuffer Buffer, const VkDeviceSize Offset, const VkDeviceSize Size,
+		const VkAccessFlags DstAccess, const VkPipelineStageFlags DstStage)
+	{
+		UploadBatch& Batch = Scheduler.Batches[Scheduler.RecordingBatch];
+
+		VkBufferMemoryBarrier Barrier = {};
+		Barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+		Barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		Barrier.srcQueueFamilyIndex = Scheduler.TransferFamily;
+		Barrier.dstQueueFamilyIndex = Scheduler.GraphicsFamily;
+		Barrier.buffer = Buffer;
+		Barrier.offset = Offset;
+		Barrier.size = Size;
+
+		vkCmdPipelineBarrier(Batch.CommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 1, &Barrier, 0, nullptr);
+
+		Barrier.srcAccessMask = 0;
+		Barrier.dstAccessMask = DstAccess;
+		Batch.BufferAcquires.push_back(Barrier);
+		Batch.AcquireStages |= DstStage;
+	}
+
+	void RetainStagingBuffer(UploadScheduler& Scheduler, const StagingBuffer& Staging)
+	{
+		Scheduler.Batches[Scheduler.RecordingBatch].Staging.push_back(Staging);
+	}
+
+	void SubmitUploadBatch(GraphicsDevice& GFXDevice, UploadScheduler& Scheduler)
+	{
+		if (Scheduler.RecordingBatch >= Scheduler.Batches.size())
+		{
+			return;
+		}
+
+		UploadBatch& Batch = Scheduler.Batches[Scheduler.RecordingBatch];
+		vkEndCommandBuffer(Batch.CommandBuffer);
+
+		TimelineSubmitInfo SubmitInfo;
+		SubmitInfo.CommandBuffers.push_back(Batch.CommandBuffer);
+		SubmitToTimeline(GFXDevice, Scheduler.Timeline, SubmitInfo);
+
+		Scheduler.Submitted.push_back(Scheduler.RecordingBatch);
+		Scheduler.RecordingBatch = Scheduler.Batches.size();
+	}
+
+	void DestroyUploadScheduler(GraphicsDevice& GFXDevice, UploadScheduler& Scheduler)
+	{
+		for (UploadBatch& Batch : Scheduler.Batches)
+		{
+			for (StagingBuffer& Staging : Batch.Staging)
+			{
+				DestroyStagingBuffer(GFXDevice, Staging);
+			}
+		}
+		Scheduler.Batches.clear();
+		Scheduler.Submitted.clear();
+		DestroyQueueTimeline(GFXDevice, Scheduler.Timeline);
+
+		vkDestroyCommandPool(GFXDevice.Device, Scheduler.CommandPool, nullptr);
+	}
+}
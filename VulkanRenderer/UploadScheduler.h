@@ -0,0 +1,94 @@
+#pragma once
+
+#include "VulkanTextures.h"
+#include "Sync.h"
+#include <vector>
+#include <deque>
+
+namespace VulkanCore
+{
+	//Returned by BeginUploadBatch when every batch is still in flight
+	static const uint64_t UploadTicketNone = 0;
+
+	//One transfer queue submission and everything it keeps alive
+	struct UploadBatch
+	{
+		VkCommandBuffer CommandBuffer = VK_NULL_HANDLE;
+
+		//Transfer timeline value the batch signals, completed tickets are always a prefix
+		uint64_t Ticket = UploadTicketNone;
+		bool bInUse = false;
+
+		//Graphics frame that recorded the acquire, the batch is reusable once that frame has finished
+		uint64_t AcquiredFrame = 0;
+		bool bAcquired = false;
+
+		std::vector<StagingBuffer> Staging;
+
+		//Acquire halves of the ownership transfers released by this batch, recorded on the graphics queue
+		std::vector<VkImageMemoryBarrier> ImageAcquires;
+		std::vector<VkBufferMemoryBarrier> BufferAcquires;
+		VkPipelineStageFlags AcquireStages = 0;
+	};
+
+	//Records copies on the dedicated transfer queue and hands the results to the graphics queue through
+	//queue family ownership transfers, so uploads run alongside rendering instead of in front of it
+	//Only useful when GFXDevice.bHasTransferQueue, same family uploads can simply be recorded into the frame
+	struct UploadScheduler
+	{
+		VkCommandPool CommandPool = VK_NULL_HANDLE;
+		std::vector<UploadBatch> Batches;
+
+		//Batch currently being recorded, or Batches.size() when none is open
+		size_t RecordingBatch = 0;
+
+		//Submitted batches whose acquire hasn't been recorded yet, oldest first
+		std::deque<size_t> Submitted;
+
+		//Counter of the transfer queue, polled to learn batches are done and waited on by the graphics queue
+		QueueTimeline Timeline;
+
+		//Every batch up to this ticket has been acquired by the graphics queue, its resources are usable there
+		uint64_t AcquiredTicket = UploadTicketNone;
+
+		uint32_t TransferFamily = 0;
+		uint32_t GraphicsFamily = 0;
+		uint32_t FramesInFlight = 2;
+		uint64_t FrameNumber = 0;
+
+		//Transfer timeline value (and the stages that wait for it) the next graphics submit must wait on, 0 when nothing was acquired
+		uint64_t WaitValue = 0;
+		VkPipelineStageFlags WaitStages = 0;
+	};
+
+	UploadScheduler CreateUploadScheduler(GraphicsDevice& GFXDevice, const uint32_t BatchCount, const uint32_t FramesInFlight);
+
+	//Call once per frame after the frame timeline wait, never blocks
+	//Recycles batches whose acquiring frame has finished, then records the acquire barriers of every finished transfer
+	//into GraphicsCommandBuffer (outside a render pass) and sets the timeline wait for this frame's submit
+	void BeginUploadFrame(GraphicsDevice& GFXDevice, UploadScheduler& Scheduler, VkCommandBuffer GraphicsCommandBuffer);
+
+	//Opens a batch if none is open and returns its ticket, UploadTicketNone when all batches are busy (try again next frame)
+	uint64_t BeginUploadBatch(GraphicsDevice& GFXDevice, UploadScheduler& Scheduler);
+
+	//Transfer command buffer of the open batch
+	VkCommandBuffer GetUploadCommandBuffer(UploadScheduler& Scheduler);
+
+	//Releases mips [BaseMip, BaseMip + MipCount) of Image from the transfer queue, moving them from TRANSFER_DST to FinalLayout
+	//The matching acquire is recorded on the graphics queue by the BeginUploadFrame that sees the batch finish
+	void CmdReleaseImageToGraphics(UploadScheduler& Scheduler, VkImage Image, const uint32_t BaseMip, const uint32_t MipCount, const VkImageLayout FinalLayout,
+		const VkAccessFlags DstAccess, const VkPipelineStageFlags DstStage);
+
+	//Same for a buffer written by a transfer
+	void CmdReleaseBufferToGraphics(UploadScheduler& Scheduler, VkBuffer Buffer, const VkDeviceSize Offset, const VkDeviceSize Size,
+		const VkAccessFlags DstAccess, const VkPipelineStageFlags DstStage);
+
+	//Destroys Staging once the open batch has been recycled
+	void RetainStagingBuffer(UploadScheduler& Scheduler, const StagingBuffer& Staging);
+
+	//Ends and submits the open batch to the transfer queue, does nothing when none is open
+	void SubmitUploadBatch(GraphicsDevice& GFXDevice, UploadScheduler& Scheduler);
+
+	//Device must be idle
+	void DestroyUploadScheduler(GraphicsDevice& GFXDevice, UploadScheduler& Scheduler);
+}
@@ -0,0 +1,561 @@
+#include "VectorMath.h"
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+namespace VulkanCore
+{
+	namespace
+	{
+		//Cofactor expansion on the raw 16 floats, works on either majorness since inverse(transpose(M)) = transpose(inverse(M))
+		//Used where there's no SIMD inverse and as the benchmark's scalar reference
+		Mat4 ScalarInverse(const Mat4& M)
+		{
+			const float* m = &M.Columns[0].X;
+			float inv[16];
+
+			inv[0] = m[5] * m[10] * m[15] - m[5] * m[11] * m[14] - m[9] * m[6] * m[15] + m[9] * m[7] * m[14] + m[13] * m[6] * m[11] - m[13] * m[7] * m[10];
+			inv[4] = -m[4] * m[10] * m[15] + m[4] * m[11] * m[14] + m[8] * m[6] * m[15] - m[8] * m[7] * m[14] - m[12] * m[6] * m[11] + m[12] * m[7] * m[10];
+			inv[8] = m[4] * m[9] * m[15] - m[4] * m[11] * m[13] - m[8] * m[5] * m[15] + m[8] * m[7] * m[13] + m[12] * m[5] * m[11] - m[12] * m[7] * m[9];
+			inv[12] = -m[4] * m[9] * m[14] + m[4] * m[10] * m[13] + m[8] * m[5] * m[14] - m[8] * m[6] * m[13] - m[12] * m[5] * m[10] + m[12] * m[6] * m[9];
+			inv[1] = -m[1] * m[10] * m[15] + m[1] * m[11] * m[14] + m[9] * m[2] * m[15] - m[9] * m[3] * m[14] - m[13] * m[2] * m[11] + m[13] * m[3] * m[10];
+			inv[5] = m[0] * m[10] * m[15] - m[0] * m[11] * m[14] - m[8] * m[2] * m[15] + m[8] * m[3] * m[14] + m[12] * m[2] * m[11] - m[12] * m[3] * m[10];
+			inv[9] = -m[0] * m[9] * m[15] + m[0] * m[11] * m[13] + m[8] * m[1] * m[15] - m[8] * m[3] * m[13] - m[12] * m[1] * m[11] + m[12] * m[3] * m[9];
+			inv[13] = m[0] * m[9] * m[14] - m[0] * m[10] * m[13] - m[8] * m[1] * m[14] + m[8] * m[2] * m[13] + m[12] * m[1] * m[10] - m[12] * m[2] * m[9];
+			inv[2] = m[1] * m[6] * m[15] - m[1] * m[7] * m[14] - m[5] * m[2] * m[15] + m[5] * m[3] * m[14] + m[13] * m[2] * m[7] - m[13] * m[3] * m[6];
+			inv[6] = -m[0] * m[6] * m[15] + m[0] * m[7] * m[14] + m[4] * m[2] * m[15] - m[4] * m[3] * m[14] - m[12] * m[2] * m[7] + m[12] * m[3] * m[6];
+			inv[10] = m[0] * m[5] * m[15] - m[0] * m[7] * m[13] - m[4] * m[1] * m[15] + m[4] * m[3] * m[13] + m[12] * m[1] * m[7] - m[12] * m[3] * m[5];
+			inv[14] = -m[0] * m[5] * m[14] + m[0] * m[6] * m[13] + m[4] * m[1] * m[14] - m[4] * m[2] * m[13] - m[12] * m[1] * m[6] + m[12] * m[2] * m[5];
+			inv[3] = -m[1] * m[6] * m[11] + m[1] * m[7] * m[10] + m[5] * m[2] * m[11] - m[5] * m[3] * m[10] - m[9] * m[2] * m[7] + m[9] * m[3] * m[6];
+			inv[7] = m[0] * m[6] * m[11] - m[0] * m[7] * m[10] - m[4] * m[2] * m[11] + m[4] * m[3] * m[10] + m[8] * m[2] * m[7] - m[8] * m[3] * m[6];
+			inv[11] = -m[0] * m[5] * m[11] + m[0] * m[7] * m[9] + m[4] * m[1] * m[11] - m[4] * m[3] * m[9] - m[8] * m[1] * m[7] + m[8] * m[3] * m[5];
+			inv[15] = m[0] * m[5] * m[10] - m[0] * m[6] * m[9] - m[4] * m[1] * m[10] + m[4] * m[2] * m[9] + m[8] * m[1] * m[6] - m[8] * m[2] * m[5];
+
+			const float InvDet = 1.0f / (m[0] * inv[0] + m[1] * inv[4] + m[2] * inv[8] + m[3] * inv[12]);
+
+			Mat4 RetVal;
+			float* r = &RetVal.Columns[0].X;
+			for (int i = 0; i < 16; ++i)
+			{
+				r[i] = inv[i] * InvDet;
+			}
+			return RetVal;
+		}
+
+#ifdef VECTORMATH_SSE
+		//Lane order X, Y, Z, W is the reverse of _MM_SHUFFLE's
+#define VECTORMATH_SHUFFLE(A, B, X, Y, Z, W) _mm_shuffle_ps(A, B, _MM_SHUFFLE(W, Z, Y, X))
+#define VECTORMATH_SWIZZLE(V, X, Y, Z, W) VECTORMATH_SHUFFLE(V, V, X, Y, Z, W)
+
+		//2x2 matrices packed row-major in one register: A * B, adj(A) * B and A * adj(B)
+		__m128 Mat2Mul(__m128 A, __m128 B)
+		{
+			return _mm_add_ps(_mm_mul_ps(A, VECTORMATH_SWIZZLE(B, 0, 3, 0, 3)), _mm_mul_ps(VECTORMATH_SWIZZLE(A, 1, 0, 3, 2), VECTORMATH_SWIZZLE(B, 2, 1, 2, 1)));
+		}
+
+		__m128 Mat2AdjMul(__m128 A, __m128 B)
+		{
+			return _mm_sub_ps(_mm_mul_ps(VECTORMATH_SWIZZLE(A, 3, 3, 0, 0), B), _mm_mul_ps(VECTORMATH_SWIZZLE(A, 1, 1, 2, 2), VECTORMATH_SWIZZLE(B, 2, 3, 0, 1)));
+		}
+
+		__m128 Mat2MulAdj(__m128 A, __m128 B)
+		{
+			return _mm_sub_ps(_mm_mul_ps(A, VECTORMATH_SWIZZLE(B, 3, 0, 3, 0)), _mm_mul_ps(VECTORMATH_SWIZZLE(A, 1, 0, 3, 2), VECTORMATH_SWIZZLE(B, 2, 1, 2, 1)));
+		}
+
+		//Blockwise inverse of [A B; C D] through the adjugates of the 2x2 blocks, no per-element cofactors
+		Mat4 SSEInverse(const Mat4& M)
+		{
+			const __m128 C0 = _mm_load_ps(&M.Columns[0].X);
+			const __m128 C1 = _mm_load_ps(&M.Columns[1].X);
+			const __m128 C2 = _mm_load_ps(&M.Columns[2].X);
+			const __m128 C3 = _mm_load_ps(&M.Columns[3].X);
+
+			const __m128 A = _mm_movelh_ps(C0, C1);
+			const __m128 B = _mm_movehl_ps(C1, C0);
+			const __m128 C = _mm_movelh_ps(C2, C3);
+			const __m128 D = _mm_movehl_ps(C3, C2);
+
+			//Determinants of the four blocks
+			const __m128 DetSub = _mm_sub_ps(
+				_mm_mul_ps(VECTORMATH_SHUFFLE(C0, C2, 0, 2, 0, 2), VECTORMATH_SHUFFLE(C1, C3, 1, 3, 1, 3)),
+				_mm_mul_ps(VECTORMATH_SHUFFLE(C0, C2, 1, 3, 1, 3), VECTORMATH_SHUFFLE(C1, C3, 0, 2, 0, 2)));
+			const __m128 DetA = VECTORMATH_SWIZZLE(DetSub, 0, 0, 0, 0);
+			const __m128 DetB = VECTORMATH_SWIZZLE(DetSub, 1, 1, 1, 1);
+			const __m128 DetC = VECTORMATH_SWIZZLE(DetSub, 2, 2, 2, 2);
+			const __m128 DetD = VECTORMATH_SWIZZLE(DetSub, 3, 3, 3, 3);
+
+			const __m128 D_C = Mat2AdjMul(D, C);
+			const __m128 A_B = Mat2AdjMul(A, B);
+
+			__m128 X = _mm_sub_ps(_mm_mul_ps(DetD, A), Mat2Mul(B, D_C));
+			__m128 W = _mm_sub_ps(_mm_mul_ps(DetA, D), Mat2Mul(C, A_B));
+			__m128 Y = _mm_sub_ps(_mm_mul_ps(DetB, C), Mat2MulAdj(D, A_B));
+			__m128 Z = _mm_sub_ps(_mm_mul_ps(DetC, B), Mat2MulAdj(A, D_C));
+
+			//|M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C), the trace summed without SSE3's hadd
+			__m128 Trace = _mm_mul_ps(A_B, VECTORMATH_SWIZZLE(D_C, 0, 2, 1, 3));
+			Trace = _mm_add_ps(Trace, _mm_movehl_ps(Trace, Trace));
+			Trace = _mm_add_ps(Trace, VECTORMATH_SWIZZLE(Trace, 1, 1, 1, 1));
+			Trace = VECTORMATH_SWIZZLE(Trace, 0, 0, 0, 0);
+
+			__m128 DetM = _mm_add_ps(_mm_mul_ps(DetA, DetD), _mm_mul_ps(DetB, DetC));
+			DetM = _mm_sub_ps(DetM, Trace);
+
+			const __m128 RcpDetM = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), DetM);
+			X = _mm_mul_ps(X, RcpDetM);
+			Y = _mm_mul_ps(Y, RcpDetM);
+			Z = _mm_mul_ps(Z, RcpDetM);
+			W = _mm_mul_ps(W, RcpDetM);
+
+			//The adjugate's swaps folded into the final shuffles
+			Mat4 RetVal;
+			_mm_store_ps(&RetVal.Columns[0].X, VECTORMATH_SHUFFLE(X, Y, 3, 1, 3, 1));
+			_mm_store_ps(&RetVal.Columns[1].X, VECTORMATH_SHUFFLE(X, Y, 2, 0, 2, 0));
+			_mm_store_ps(&RetVal.Columns[2].X, VECTORMATH_SHUFFLE(Z, W, 3, 1, 3, 1));
+			_mm_store_ps(&RetVal.Columns[3].X, VECTORMATH_SHUFFLE(Z, W, 2, 0, 2, 0));
+			return RetVal;
+		}
+
+#undef VECTORMATH_SWIZZLE
+#undef VECTORMATH_SHUFFLE
+#endif
+
+		void NormalizePlane(float* Plane)
+		{
+			float Length = sqrtf(Plane[0] * Plane[0] + Plane[1] * Plane[1] + Plane[2] * Plane[2]);
+			if (Length > 0.0f)
+			{
+				SimdStore(Plane, SimdMul(SimdLoad(Plane), SimdSplat(1.0f / Length)));
+			}
+		}
+	}
+
+	float Length(const Vec3& V)
+	{
+		return sqrtf(Dot(V, V));
+	}
+
+	Vec3 Normalize(const Vec3& V)
+	{
+		const float Len = Length(V);
+		return Len > 0.0f ? Scale(V, 1.0f / Len) : V;
+	}
+
+	Quat QuatIdentity()
+	{
+		Quat RetVal = { 0.0f, 0.0f, 0.0f, 1.0f };
+		return RetVal;
+	}
+
+	Quat QuatFromAxisAngle(const Vec3& Axis, const float Radians)
+	{
+		const Vec3 UnitAxis = Normalize(Axis);
+		const float S = sinf(Radians * 0.5f);
+		Quat RetVal = { UnitAxis.X * S, UnitAxis.Y * S, UnitAxis.Z * S, cosf(Radians * 0.5f) };
+		return RetVal;
+	}
+
+	Quat QuatMultiply(const Quat& A, const Quat& B)
+	{
+		Quat RetVal;
+		RetVal.X = A.W * B.X + A.X * B.W + A.Y * B.Z - A.Z * B.Y;
+		RetVal.Y = A.W * B.Y - A.X * B.Z + A.Y * B.W + A.Z * B.X;
+		RetVal.Z = A.W * B.Z + A.X * B.Y - A.Y * B.X + A.Z * B.W;
+		RetVal.W = A.W * B.W - A.X * B.X - A.Y * B.Y - A.Z * B.Z;
+		return RetVal;
+	}
+
+	Vec3 QuatRotate(const Quat& Q, const Vec3& V)
+	{
+		//V + 2w(q x V) + 2q x (q x V), without building the matrix
+		const Vec3 Axis = MakeVec3(Q.X, Q.Y, Q.Z);
+		const Vec3 T = Scale(Cross(Axis, V), 2.0f);
+		return Add(Add(V, Scale(T, Q.W)), Cross(Axis, T));
+	}
+
+	Quat QuatNormalize(const Quat& Q)
+	{
+		const float Len = sqrtf(Q.X * Q.X + Q.Y * Q.Y + Q.Z * Q.Z + Q.W * Q.W);
+		const float InvLen = Len > 0.0f ? 1.0f / Len : 0.0f;
+		Quat RetVal = { Q.X * InvLen, Q.Y * InvLen, Q.Z * InvLen, Q.W * InvLen };
+		return RetVal;
+	}
+
+	Quat QuatSlerp(const Quat& A, const Quat& B, const float T)
+	{
+		float CosTheta = A.X * B.X + A.Y * B.Y + A.Z * B.Z + A.W * B.W;
+
+		//q and -q are the same rotation, take the short way around
+		const float Sign = CosTheta < 0.0f ? -1.0f : 1.0f;
+		CosTheta *= Sign;
+
+		float WeightA = 1.0f - T;
+		float WeightB = T * Sign;
+		if (CosTheta < 0.9995f)
+		{
+			const float Theta = acosf(CosTheta);
+			const float InvSinTheta = 1.0f / sinf(Theta);
+			WeightA = sinf((1.0f - T) * Theta) * InvSinTheta;
+			WeightB = sinf(T * Theta) * InvSinTheta * Sign;
+		}
+
+		Quat RetVal = { A.X * WeightA + B.X * WeightB, A.Y * WeightA + B.Y * WeightB, A.Z * WeightA + B.Z * WeightB, A.W * WeightA + B.W * WeightB };
+		return QuatNormalize(RetVal);
+	}
+
+	Mat4 Mat4Identity()
+	{
+		Mat4 RetVal;
+		RetVal.Columns[0] = MakeVec4(1.0f, 0.0f, 0.0f, 0.0f);
+		RetVal.Columns[1] = MakeVec4(0.0f, 1.0f, 0.0f, 0.0f);
+		RetVal.Columns[2] = MakeVec4(0.0f, 0.0f, 1.0f, 0.0f);
+		RetVal.Columns[3] = MakeVec4(0.0f, 0.0f, 0.0f, 1.0f);
+		return RetVal;
+	}
+
+	Mat4 Mat4Translation(const Vec3& Translation)
+	{
+		Mat4 RetVal = Mat4Identity();
+		RetVal.Columns[3] = MakeVec4(Translation.X, Translation.Y, Translation.Z, 1.0f);
+		return RetVal;
+	}
+
+	Mat4 Mat4Scale(const Vec3& Scale)
+	{
+		Mat4 RetVal = Mat4Identity();
+		RetVal.Columns[0].X = Scale.X;
+		RetVal.Columns[1].Y = Scale.Y;
+		RetVal.Columns[2].Z = Scale.Z;
+		return RetVal;
+	}
+
+	Mat4 Mat4FromQuat(const Quat& Rotation)
+	{
+		const float X = Rotation.X, Y = Rotation.Y, Z = Rotation.Z, W = Rotation.W;
+
+		Mat4 RetVal;
+		RetVal.Columns[0] = MakeVec4(1.0f - 2.0f * (Y * Y + Z * Z), 2.0f * (X * Y + Z * W), 2.0f * (X * Z - Y * W), 0.0f);
+		RetVal.Columns[1] = MakeVec4(2.0f * (X * Y - Z * W), 1.0f - 2.0f * (X * X + Z * Z), 2.0f * (Y * Z + X * W), 0.0f);
+		RetVal.Columns[2] = MakeVec4(2.0f * (X * Z + Y * W), 2.0f * (Y * Z - X * W), 1.0f - 2.0f * (X * X + Y * Y), 0.0f);
+		RetVal.Columns[3] = MakeVec4(0.0f, 0.0f, 0.0f, 1.0f);
+		return RetVal;
+	}
+
+	Mat4 Mat4FromTRS(const Vec3& Translation, const Quat& Rotation, const Vec3& Scale)
+	{
+		//Scaling the rotation's columns is the same as multiplying by the scale matrix
+		Mat4 RetVal = Mat4FromQuat(Rotation);
+		SimdStore(&RetVal.Columns[0].X, SimdMul(SimdLoad(&RetVal.Columns[0].X), SimdSplat(Scale.X)));
+		SimdStore(&RetVal.Columns[1].X, SimdMul(SimdLoad(&RetVal.Columns[1].X), SimdSplat(Scale.Y)));
+		SimdStore(&RetVal.Columns[2].X, SimdMul(SimdLoad(&RetVal.Columns[2].X), SimdSplat(Scale.Z)));
+		RetVal.Columns[3] = MakeVec4(Translation.X, Translation.Y, Translation.Z, 1.0f);
+		return RetVal;
+	}
+
+	Mat4 Mat4LookAt(const Vec3& Eye, const Vec3& Target, const Vec3& Up)
+	{
+		const Vec3 Forward = Normalize(Sub(Target, Eye));
+		const Vec3 Right = Normalize(Cross(Forward, Up));
+		const Vec3 CameraUp = Cross(Right, Forward);
+
+		Mat4 RetVal;
+		RetVal.Columns[0] = MakeVec4(Right.X, CameraUp.X, -Forward.X, 0.0f);
+		RetVal.Columns[1] = MakeVec4(Right.Y, CameraUp.Y, -Forward.Y, 0.0f);
+		RetVal.Columns[2] = MakeVec4(Right.Z, CameraUp.Z, -Forward.Z, 0.0f);
+		RetVal.Columns[3] = MakeVec4(-Dot(Right, Eye), -Dot(CameraUp, Eye), Dot(Forward, Eye), 1.0f);
+		return RetVal;
+	}
+
+	Mat4 Mat4Perspective(const float VerticalFov, const float Aspect, const float Near, const float Far)
+	{
+		const float Focal = 1.0f / tanf(VerticalFov * 0.5f);
+
+		Mat4 RetVal;
+		RetVal.Columns[0] = MakeVec4(Focal / Aspect, 0.0f, 0.0f, 0.0f);
+		RetVal.Columns[1] = MakeVec4(0.0f, -Focal, 0.0f, 0.0f);
+		RetVal.Columns[2] = MakeVec4(0.0f, 0.0f, Far / (Near - Far), -1.0f);
+		RetVal.Columns[3] = MakeVec4(0.0f, 0.0f, Near * Far / (Near - Far), 0.0f);
+		return RetVal;
+	}
+
+	Mat4 Mat4Transpose(const Mat4& M)
+	{
+#ifdef VECTORMATH_SSE
+		__m128 C0 = _mm_load_ps(&M.Columns[0].X);
+		__m128 C1 = _mm_load_ps(&M.Columns[1].X);
+		__m128 C2 = _mm_load_ps(&M.Columns[2].X);
+		__m128 C3 = _mm_load_ps(&M.Columns[3].X);
+		_MM_TRANSPOSE4_PS(C0, C1, C2, C3);
+
+		Mat4 RetVal;
+		_mm_store_ps(&RetVal.Columns[0].X, C0);
+		_mm_store_ps(&RetVal.Columns[1].X, C1);
+		_mm_store_ps(&RetVal.Columns[2].X, C2);
+		_mm_store_ps(&RetVal.Columns[3].X, C3);
+		return RetVal;
+#else
+		const float* m = &M.Columns[0].X;
+		Mat4 RetVal;
+		float* r = &RetVal.Columns[0].X;
+		for (int c = 0; c < 4; ++c)
+		{
+			for (int Row = 0; Row < 4; ++Row)
+			{
+				r[c * 4 + Row] = m[Row * 4 + c];
+			}
+		}
+		return RetVal;
+#endif
+	}
+
+	Mat4 Mat4Inverse(const Mat4& M)
+	{
+#ifdef VECTORMATH_SSE
+		return SSEInverse(M);
+#else
+		return ScalarInverse(M);
+#endif
+	}
+
+	void TransformPoints(const Mat4& M, const Vec3* In, Vec3* Out, const size_t Count)
+	{
+		size_t i = 0;
+
+#ifdef VECTORMATH_AVX
+		//Two padded points fill a 256 bit register, the columns are repeated in both halves
+		const __m256 Wide0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*> (&M.Columns[0].X));
+		const __m256 Wide1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*> (&M.Columns[1].X));
+		const __m256 Wide2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*> (&M.Columns[2].X));
+		const __m256 Wide3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*> (&M.Columns[3].X));
+
+		for (; i + 2 <= Count; i += 2)
+		{
+			//Arrays are only guaranteed 16 byte alignment
+			const __m256 P = _mm256_loadu_ps(&In[i].X);
+			__m256 R = _mm256_add_ps(Wide3, _mm256_mul_ps(Wide0, _mm256_permute_ps(P, 0x00)));
+			R = _mm256_add_ps(R, _mm256_mul_ps(Wide1, _mm256_permute_ps(P, 0x55)));
+			R = _mm256_add_ps(R, _mm256_mul_ps(Wide2, _mm256_permute_ps(P, 0xAA)));
+			_mm256_storeu_ps(&Out[i].X, R);
+		}
+#endif
+
+		const SimdFloat4 C0 = SimdLoad(&M.Columns[0].X);
+		const SimdFloat4 C1 = SimdLoad(&M.Columns[1].X);
+		const SimdFloat4 C2 = SimdLoad(&M.Columns[2].X);
+		const SimdFloat4 C3 = SimdLoad(&M.Columns[3].X);
+		for (; i < Count; ++i)
+		{
+			const SimdFloat4 P = SimdLoad(&In[i].X);
+			SimdFloat4 R = SimdMulAdd(C0, SimdSplatX(P), C3);
+			R = SimdMulAdd(C1, SimdSplatY(P), R);
+			R = SimdMulAdd(C2, SimdSplatZ(P), R);
+			SimdStore(&Out[i].X, R);
+		}
+	}
+
+	void TransformAABBs(const Mat4& M, const AABB* In, AABB* Out, const size_t Count)
+	{
+		//Center goes through the full transform, the extent through the absolute 3x3 part
+		const SimdFloat4 C0 = SimdLoad(&M.Columns[0].X);
+		const SimdFloat4 C1 = SimdLoad(&M.Columns[1].X);
+		const SimdFloat4 C2 = SimdLoad(&M.Columns[2].X);
+		const SimdFloat4 C3 = SimdLoad(&M.Columns[3].X);
+		const SimdFloat4 Abs0 = SimdAbs(C0);
+		const SimdFloat4 Abs1 = SimdAbs(C1);
+		const SimdFloat4 Abs2 = SimdAbs(C2);
+		const SimdFloat4 Half = SimdSplat(0.5f);
+
+		for (size_t i = 0; i < Count; ++i)
+		{
+			const SimdFloat4 Min = SimdLoad(&In[i].Min.X);
+			const SimdFloat4 Max = SimdLoad(&In[i].Max.X);
+			const SimdFloat4 Center = SimdMul(SimdAdd(Min, Max), Half);
+			const SimdFloat4 Extent = SimdMul(SimdSub(Max, Min), Half);
+
+			SimdFloat4 NewCenter = SimdMulAdd(C0, SimdSplatX(Center), C3);
+			NewCenter = SimdMulAdd(C1, SimdSplatY(Center), NewCenter);
+			NewCenter = SimdMulAdd(C2, SimdSplatZ(Center), NewCenter);
+
+			SimdFloat4 NewExtent = SimdMul(Abs0, SimdSplatX(Extent));
+			NewExtent = SimdMulAdd(Abs1, SimdSplatY(Extent), NewExtent);
+			NewExtent = SimdMulAdd(Abs2, SimdSplatZ(Extent), NewExtent);
+
+			SimdStore(&Out[i].Min.X, SimdSub(NewCenter, NewExtent));
+			SimdStore(&Out[i].Max.X, SimdAdd(NewCenter, NewExtent));
+		}
+	}
+
+	Frustum ExtractFrustumPlanes(const Mat4& ViewProjection)
+	{
+		//Rows of the matrix are the transpose's columns
+		const Mat4 Rows = Mat4Transpose(ViewProjection);
+		const SimdFloat4 Row0 = SimdLoad(&Rows.Columns[0].X);
+		const SimdFloat4 Row1 = SimdLoad(&Rows.Columns[1].X);
+		const SimdFloat4 Row2 = SimdLoad(&Rows.Columns[2].X);
+		const SimdFloat4 Row3 = SimdLoad(&Rows.Columns[3].X);
+
+		Frustum Result;
+		SimdStore(Result.Planes[0], SimdAdd(Row3, Row0)); //Left
+		SimdStore(Result.Planes[1], SimdSub(Row3, Row0)); //Right
+		SimdStore(Result.Planes[2], SimdAdd(Row3, Row1)); //Bottom
+		SimdStore(Result.Planes[3], SimdSub(Row3, Row1)); //Top
+		SimdStore(Result.Planes[4], Row2);                //Near (0..1 depth)
+		SimdStore(Result.Planes[5], SimdSub(Row3, Row2)); //Far
+
+		for (int p = 0; p < 6; ++p)
+		{
+			NormalizePlane(Result.Planes[p]);
+		}
+
+		return Result;
+	}
+
+	namespace
+	{
+		//The straightforward loops the SIMD paths replace
+		void ScalarMultiply(const Mat4& A, const Mat4& B, Mat4& Out)
+		{
+			const float* a = &A.Columns[0].X;
+			const float* b = &B.Columns[0].X;
+			float* r = &Out.Columns[0].X;
+			for (int c = 0; c < 4; ++c)
+			{
+				for (int Row = 0; Row < 4; ++Row)
+				{
+					r[c * 4 + Row] = a[Row] * b[c * 4] + a[4 + Row] * b[c * 4 + 1] + a[8 + Row] * b[c * 4 + 2] + a[12 + Row] * b[c * 4 + 3];
+				}
+			}
+		}
+
+		void ScalarTransformPoints(const Mat4& M, const Vec3* In, Vec3* Out, const size_t Count)
+		{
+			const float* m = &M.Columns[0].X;
+			for (size_t i = 0; i < Count; ++i)
+			{
+				const float X = In[i].X, Y = In[i].Y, Z = In[i].Z;
+				Out[i].X = m[0] * X + m[4] * Y + m[8] * Z + m[12];
+				Out[i].Y = m[1] * X + m[5] * Y + m[9] * Z + m[13];
+				Out[i].Z = m[2] * X + m[6] * Y + m[10] * Z + m[14];
+			}
+		}
+
+		//Transforms all 8 corners and takes their bounds
+		void ScalarTransformAABBs(const Mat4& M, const AABB* In, AABB* Out, const size_t Count)
+		{
+			for (size_t i = 0; i < Count; ++i)
+			{
+				Vec3 Min = MakeVec3(1e30f, 1e30f, 1e30f);
+				Vec3 Max = MakeVec3(-1e30f, -1e30f, -1e30f);
+				for (int Corner = 0; Corner < 8; ++Corner)
+				{
+					const Vec3 P = MakeVec3((Corner & 1) ? In[i].Max.X : In[i].Min.X, (Corner & 2) ? In[i].Max.Y : In[i].Min.Y, (Corner & 4) ? In[i].Max.Z : In[i].Min.Z);
+					Vec3 T;
+					ScalarTransformPoints(M, &P, &T, 1);
+					Min = MakeVec3(std::min(Min.X, T.X), std::min(Min.Y, T.Y), std::min(Min.Z, T.Z));
+					Max = MakeVec3(std::max(Max.X, T.X), std::max(Max.Y, T.Y), std::max(Max.Z, T.Z));
+				}
+				Out[i].Min = Min;
+				Out[i].Max = Max;
+			}
+		}
+
+		//Best of Runs in milliseconds
+		template<typename FunctionType>
+		double TimeBest(const uint32_t Runs, FunctionType Function)
+		{
+			double Best = 1e9;
+			for (uint32_t Run = 0; Run < Runs; ++Run)
+			{
+				auto Start = std::chrono::high_resolution_clock::now();
+				Function();
+				Best = std::min(Best, std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - Start).count());
+			}
+			return Best;
+		}
+
+		void PrintResult(const char* Name, const double ScalarMs, const double SimdMs, const float MaxError)
+		{
+			std::cout << Name << ": scalar " << ScalarMs << " ms, SIMD " << SimdMs << " ms (" << ScalarMs / SimdMs << "x), max difference " << MaxError << std::endl;
+		}
+	}
+
+	void RunMathBenchmark()
+	{
+		const size_t Count = 1 << 20;
+		const uint32_t Runs = 10;
+
+#if defined(VECTORMATH_AVX)
+		std::cout << "Math benchmark, SSE + AVX, ";
+#elif defined(VECTORMATH_SSE)
+		std::cout << "Math benchmark, SSE, ";
+#elif defined(VECTORMATH_NEON)
+		std::cout << "Math benchmark, NEON, ";
+#else
+		std::cout << "Math benchmark, no SIMD, ";
+#endif
+		std::cout << Count << " elements, best of " << Runs << " runs" << std::endl;
+
+		//Well conditioned affine transforms so inverses stay accurate
+		std::vector<Mat4> Matrices(Count);
+		std::vector<Vec3> Points(Count);
+		std::vector<AABB> Boxes(Count);
+		for (size_t i = 0; i < Count; ++i)
+		{
+			const float F = static_cast<float> (i);
+			Matrices[i] = Mat4FromTRS(MakeVec3(sinf(F), cosf(F * 0.5f), F * 0.001f), QuatFromAxisAngle(MakeVec3(1.0f, sinf(F), 0.5f), F * 0.01f),
+				MakeVec3(1.0f + 0.5f * sinf(F * 0.3f), 1.5f, 0.75f));
+			Points[i] = MakeVec3(sinf(F * 0.7f) * 10.0f, cosf(F * 0.3f) * 10.0f, F * 0.01f);
+			Boxes[i].Min = Sub(Points[i], MakeVec3(1.0f, 2.0f, 0.5f));
+			Boxes[i].Max = Add(Points[i], MakeVec3(1.0f, 2.0f, 0.5f));
+		}
+		const Mat4 Transform = Matrices[Count / 2];
+
+		std::vector<Mat4> ScalarMatrices(Count);
+		std::vector<Mat4> SimdMatrices(Count);
+		auto MatrixError = [&]()
+		{
+			float MaxError = 0.0f;
+			for (size_t i = 0; i < Count; ++i)
+			{
+				for (int e = 0; e < 16; ++e)
+				{
+					MaxError = std::max(MaxError, fabsf((&ScalarMatrices[i].Columns[0].X)[e] - (&SimdMatrices[i].Columns[0].X)[e]));
+				}
+			}
+			return MaxError;
+		};
+
+		double ScalarMs = TimeBest(Runs, [&]() { for (size_t i = 0; i < Count; ++i) ScalarMultiply(Transform, Matrices[i], ScalarMatrices[i]); });
+		double SimdMs = TimeBest(Runs, [&]() { for (size_t i = 0; i < Count; ++i) SimdMatrices[i] = Mat4Multiply(Transform, Matrices[i]); });
+		PrintResult("Mat4 multiply", ScalarMs, SimdMs, MatrixError());
+
+		ScalarMs = TimeBest(Runs, [&]() { for (size_t i = 0; i < Count; ++i) ScalarMatrices[i] = ScalarInverse(Matrices[i]); });
+		SimdMs = TimeBest(Runs, [&]() { for (size_t i = 0; i < Count; ++i) SimdMatrices[i] = Mat4Inverse(Matrices[i]); });
+		PrintResult("Mat4 inverse", ScalarMs, SimdMs, MatrixError());
+
+		std::vector<Vec3> ScalarPoints(Count);
+		std::vector<Vec3> SimdPoints(Count);
+		ScalarMs = TimeBest(Runs, [&]() { ScalarTransformPoints(Transform, Points.data(), ScalarPoints.data(), Count); });
+		SimdMs = TimeBest(Runs, [&]() { TransformPoints(Transform, Points.data(), SimdPoints.data(), Count); });
+		float MaxError = 0.0f;
+		for (size_t i = 0; i < Count; ++i)
+		{
+			MaxError = std::max(MaxError, Length(Sub(ScalarPoints[i], SimdPoints[i])));
+		}
+		PrintResult("Transform points", ScalarMs, SimdMs, MaxError);
+
+		std::vector<AABB> ScalarBoxes(Count);
+		std::vector<AABB> SimdBoxes(Count);
+		ScalarMs = TimeBest(Runs, [&]() { ScalarTransformAABBs(Transform, Boxes.data(), ScalarBoxes.data(), Count); });
+		SimdMs = TimeBest(Runs, [&]() { TransformAABBs(Transform, Boxes.data(), SimdBoxes.data(), Count); });
+		MaxError = 0.0f;
+		for (size_t i = 0; i < Count; ++i)
+		{
+			MaxError = std::max(MaxError, std::max(Length(Sub(ScalarBoxes[i].Min, SimdBoxes[i].Min)), Length(Sub(ScalarBoxes[i].Max, SimdBoxes[i].Max))));
+		}
+		PrintResult("Transform AABBs (8 corners vs center/extent)", ScalarMs, SimdMs, MaxError);
+	}
+}
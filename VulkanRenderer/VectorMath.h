@@ -0,0 +1,219 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+//SIMD backend, picked at compile time: NEON on ARM, SSE2 on x86/x64, plain floats otherwise
+//AVX is used on top of SSE by the batch kernels when the compiler targets it (/arch:AVX, -mavx)
+#if defined(__ARM_NEON) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define VECTORMATH_NEON 1
+#elif defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define VECTORMATH_SSE 1
+#if defined(__AVX__)
+#include <immintrin.h>
+#define VECTORMATH_AVX 1
+#endif
+#endif
+
+namespace VulkanCore
+{
+	//Math types are 16 byte aligned so they load straight into SIMD registers (what 64 bit allocators return anyway)
+	//None of them initialize their members, large arrays of them cost nothing to create
+	struct alignas(16) Vec3
+	{
+		float X, Y, Z;
+
+		//Keeps the size at 16 bytes, undefined after SIMD writes
+		float Pad;
+	};
+
+	struct alignas(16) Vec4
+	{
+		float X, Y, Z, W;
+	};
+
+	//Unit quaternion, W is the real part
+	struct alignas(16) Quat
+	{
+		float X, Y, Z, W;
+	};
+
+	//Column-major like GLSL, Columns[3] holds the translation
+	struct alignas(16) Mat4
+	{
+		Vec4 Columns[4];
+	};
+
+	struct AABB
+	{
+		Vec3 Min;
+		Vec3 Max;
+	};
+
+	//6 planes (xyz normal, w distance) pointing inwards
+	struct alignas(16) Frustum
+	{
+		float Planes[6][4];
+	};
+
+	//4 wide register and the handful of operations everything else is written with
+#if defined(VECTORMATH_NEON)
+	typedef float32x4_t SimdFloat4;
+
+	inline SimdFloat4 SimdLoad(const float* Source) { return vld1q_f32(Source); }
+	inline void SimdStore(float* Dest, SimdFloat4 V) { vst1q_f32(Dest, V); }
+	inline SimdFloat4 SimdSplat(const float Value) { return vdupq_n_f32(Value); }
+	inline SimdFloat4 SimdSplatX(SimdFloat4 V) { return vdupq_lane_f32(vget_low_f32(V), 0); }
+	inline SimdFloat4 SimdSplatY(SimdFloat4 V) { return vdupq_lane_f32(vget_low_f32(V), 1); }
+	inline SimdFloat4 SimdSplatZ(SimdFloat4 V) { return vdupq_lane_f32(vget_high_f32(V), 0); }
+	inline SimdFloat4 SimdSplatW(SimdFloat4 V) { return vdupq_lane_f32(vget_high_f32(V), 1); }
+	inline SimdFloat4 SimdAdd(SimdFloat4 A, SimdFloat4 B) { return vaddq_f32(A, B); }
+	inline SimdFloat4 SimdSub(SimdFloat4 A, SimdFloat4 B) { return vsubq_f32(A, B); }
+	inline SimdFloat4 SimdMul(SimdFloat4 A, SimdFloat4 B) { return vmulq_f32(A, B); }
+	inline SimdFloat4 SimdMulAdd(SimdFloat4 A, SimdFloat4 B, SimdFloat4 C) { return vmlaq_f32(C, A, B); }
+	inline SimdFloat4 SimdMin(SimdFloat4 A, SimdFloat4 B) { return vminq_f32(A, B); }
+	inline SimdFloat4 SimdMax(SimdFloat4 A, SimdFloat4 B) { return vmaxq_f32(A, B); }
+	inline SimdFloat4 SimdAbs(SimdFloat4 V) { return vabsq_f32(V); }
+#elif defined(VECTORMATH_SSE)
+	typedef __m128 SimdFloat4;
+
+	inline SimdFloat4 SimdLoad(const float* Source) { return _mm_load_ps(Source); }
+	inline void SimdStore(float* Dest, SimdFloat4 V) { _mm_store_ps(Dest, V); }
+	inline SimdFloat4 SimdSplat(const float Value) { return _mm_set1_ps(Value); }
+	inline SimdFloat4 SimdSplatX(SimdFloat4 V) { return _mm_shuffle_ps(V, V, _MM_SHUFFLE(0, 0, 0, 0)); }
+	inline SimdFloat4 SimdSplatY(SimdFloat4 V) { return _mm_shuffle_ps(V, V, _MM_SHUFFLE(1, 1, 1, 1)); }
+	inline SimdFloat4 SimdSplatZ(SimdFloat4 V) { return _mm_shuffle_ps(V, V, _MM_SHUFFLE(2, 2, 2, 2)); }
+	inline SimdFloat4 SimdSplatW(SimdFloat4 V) { return _mm_shuffle_ps(V, V, _MM_SHUFFLE(3, 3, 3, 3)); }
+	inline SimdFloat4 SimdAdd(SimdFloat4 A, SimdFloat4 B) { return _mm_add_ps(A, B); }
+	inline SimdFloat4 SimdSub(SimdFloat4 A, SimdFloat4 B) { return _mm_sub_ps(A, B); }
+	inline SimdFloat4 SimdMul(SimdFloat4 A, SimdFloat4 B) { return _mm_mul_ps(A, B); }
+	inline SimdFloat4 SimdMulAdd(SimdFloat4 A, SimdFloat4 B, SimdFloat4 C) { return _mm_add_ps(_mm_mul_ps(A, B), C); }
+	inline SimdFloat4 SimdMin(SimdFloat4 A, SimdFloat4 B) { return _mm_min_ps(A, B); }
+	inline SimdFloat4 SimdMax(SimdFloat4 A, SimdFloat4 B) { return _mm_max_ps(A, B); }
+	inline SimdFloat4 SimdAbs(SimdFloat4 V) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), V); }
+#else
+	struct SimdFloat4
+	{
+		float V[4];
+	};
+
+	inline SimdFloat4 SimdLoad(const float* Source) { SimdFloat4 R = { { Source[0], Source[1], Source[2], Source[3] } }; return R; }
+	inline void SimdStore(float* Dest, SimdFloat4 V) { Dest[0] = V.V[0]; Dest[1] = V.V[1]; Dest[2] = V.V[2]; Dest[3] = V.V[3]; }
+	inline SimdFloat4 SimdSplat(const float Value) { SimdFloat4 R = { { Value, Value, Value, Value } }; return R; }
+	inline SimdFloat4 SimdSplatX(SimdFloat4 V) { return SimdSplat(V.V[0]); }
+	inline SimdFloat4 SimdSplatY(SimdFloat4 V) { return SimdSplat(V.V[1]); }
+	inline SimdFloat4 SimdSplatZ(SimdFloat4 V) { return SimdSplat(V.V[2]); }
+	inline SimdFloat4 SimdSplatW(SimdFloat4 V) { return SimdSplat(V.V[3]); }
+	inline SimdFloat4 SimdAdd(SimdFloat4 A, SimdFloat4 B) { SimdFloat4 R = { { A.V[0] + B.V[0], A.V[1] + B.V[1], A.V[2] + B.V[2], A.V[3] + B.V[3] } }; return R; }
+	inline SimdFloat4 SimdSub(SimdFloat4 A, SimdFloat4 B) { SimdFloat4 R = { { A.V[0] - B.V[0], A.V[1] - B.V[1], A.V[2] - B.V[2], A.V[3] - B.V[3] } }; return R; }
+	inline SimdFloat4 SimdMul(SimdFloat4 A, SimdFloat4 B) { SimdFloat4 R = { { A.V[0] * B.V[0], A.V[1] * B.V[1], A.V[2] * B.V[2], A.V[3] * B.V[3] } }; return R; }
+	inline SimdFloat4 SimdMulAdd(SimdFloat4 A, SimdFloat4 B, SimdFloat4 C) { return SimdAdd(SimdMul(A, B), C); }
+	inline SimdFloat4 SimdMin(SimdFloat4 A, SimdFloat4 B) { SimdFloat4 R = { { A.V[0] < B.V[0] ? A.V[0] : B.V[0], A.V[1] < B.V[1] ? A.V[1] : B.V[1], A.V[2] < B.V[2] ? A.V[2] : B.V[2], A.V[3] < B.V[3] ? A.V[3] : B.V[3] } }; return R; }
+	inline SimdFloat4 SimdMax(SimdFloat4 A, SimdFloat4 B) { SimdFloat4 R = { { A.V[0] > B.V[0] ? A.V[0] : B.V[0], A.V[1] > B.V[1] ? A.V[1] : B.V[1], A.V[2] > B.V[2] ? A.V[2] : B.V[2], A.V[3] > B.V[3] ? A.V[3] : B.V[3] } }; return R; }
+	inline SimdFloat4 SimdAbs(SimdFloat4 V) { SimdFloat4 R = { { V.V[0] < 0.0f ? -V.V[0] : V.V[0], V.V[1] < 0.0f ? -V.V[1] : V.V[1], V.V[2] < 0.0f ? -V.V[2] : V.V[2], V.V[3] < 0.0f ? -V.V[3] : V.V[3] } }; return R; }
+#endif
+
+	//Single Vec3/Quat operations stay scalar, 3 lanes of work don't pay for the shuffles
+	inline Vec3 MakeVec3(const float X, const float Y, const float Z) { Vec3 R; R.X = X; R.Y = Y; R.Z = Z; R.Pad = 0.0f; return R; }
+	inline Vec3 Add(const Vec3& A, const Vec3& B) { return MakeVec3(A.X + B.X, A.Y + B.Y, A.Z + B.Z); }
+	inline Vec3 Sub(const Vec3& A, const Vec3& B) { return MakeVec3(A.X - B.X, A.Y - B.Y, A.Z - B.Z); }
+	inline Vec3 Scale(const Vec3& V, const float S) { return MakeVec3(V.X * S, V.Y * S, V.Z * S); }
+	inline float Dot(const Vec3& A, const Vec3& B) { return A.X * B.X + A.Y * B.Y + A.Z * B.Z; }
+	inline Vec3 Cross(const Vec3& A, const Vec3& B) { return MakeVec3(A.Y * B.Z - A.Z * B.Y, A.Z * B.X - A.X * B.Z, A.X * B.Y - A.Y * B.X); }
+	float Length(const Vec3& V);
+	Vec3 Normalize(const Vec3& V);
+
+	inline Vec4 MakeVec4(const float X, const float Y, const float Z, const float W) { Vec4 R; R.X = X; R.Y = Y; R.Z = Z; R.W = W; return R; }
+	inline float Dot(const Vec4& A, const Vec4& B) { return A.X * B.X + A.Y * B.Y + A.Z * B.Z + A.W * B.W; }
+
+	Quat QuatIdentity();
+	Quat QuatFromAxisAngle(const Vec3& Axis, const float Radians);
+
+	//A * B applies B first
+	Quat QuatMultiply(const Quat& A, const Quat& B);
+	Vec3 QuatRotate(const Quat& Q, const Vec3& V);
+	Quat QuatNormalize(const Quat& Q);
+
+	//Shortest path spherical interpolation, falls back to normalized lerp for nearly equal rotations
+	Quat QuatSlerp(const Quat& A, const Quat& B, const float T);
+
+	Mat4 Mat4Identity();
+	Mat4 Mat4Translation(const Vec3& Translation);
+	Mat4 Mat4Scale(const Vec3& Scale);
+	Mat4 Mat4FromQuat(const Quat& Rotation);
+
+	//Scale, then rotation, then translation, the usual node transform
+	Mat4 Mat4FromTRS(const Vec3& Translation, const Quat& Rotation, const Vec3& Scale);
+
+	//Right handed view looking from Eye towards Target
+	Mat4 Mat4LookAt(const Vec3& Eye, const Vec3& Target, const Vec3& Up);
+
+	//Vulkan clip space: y points down, depth 0 at Near and 1 at Far
+	Mat4 Mat4Perspective(const float VerticalFov, const float Aspect, const float Near, const float Far);
+
+	Mat4 Mat4Transpose(const Mat4& M);
+
+	//General inverse through 2x2 block adjugates (SSE), cofactors elsewhere, M must be invertible
+	Mat4 Mat4Inverse(const Mat4& M);
+
+	inline Vec4 Mat4Transform(const Mat4& M, const Vec4& V)
+	{
+		SimdFloat4 In = SimdLoad(&V.X);
+		SimdFloat4 R = SimdMul(SimdLoad(&M.Columns[0].X), SimdSplatX(In));
+		R = SimdMulAdd(SimdLoad(&M.Columns[1].X), SimdSplatY(In), R);
+		R = SimdMulAdd(SimdLoad(&M.Columns[2].X), SimdSplatZ(In), R);
+		R = SimdMulAdd(SimdLoad(&M.Columns[3].X), SimdSplatW(In), R);
+
+		Vec4 RetVal;
+		SimdStore(&RetVal.X, R);
+		return RetVal;
+	}
+
+	//Point with w = 1, no perspective divide
+	inline Vec3 Mat4TransformPoint(const Mat4& M, const Vec3& P)
+	{
+		SimdFloat4 In = SimdLoad(&P.X);
+		SimdFloat4 R = SimdMulAdd(SimdLoad(&M.Columns[0].X), SimdSplatX(In), SimdLoad(&M.Columns[3].X));
+		R = SimdMulAdd(SimdLoad(&M.Columns[1].X), SimdSplatY(In), R);
+		R = SimdMulAdd(SimdLoad(&M.Columns[2].X), SimdSplatZ(In), R);
+
+		Vec3 RetVal;
+		SimdStore(&RetVal.X, R);
+		return RetVal;
+	}
+
+	//A * B applies B first
+	inline Mat4 Mat4Multiply(const Mat4& A, const Mat4& B)
+	{
+		SimdFloat4 A0 = SimdLoad(&A.Columns[0].X);
+		SimdFloat4 A1 = SimdLoad(&A.Columns[1].X);
+		SimdFloat4 A2 = SimdLoad(&A.Columns[2].X);
+		SimdFloat4 A3 = SimdLoad(&A.Columns[3].X);
+
+		Mat4 RetVal;
+		for (int c = 0; c < 4; ++c)
+		{
+			SimdFloat4 Column = SimdLoad(&B.Columns[c].X);
+			SimdFloat4 R = SimdMul(A0, SimdSplatX(Column));
+			R = SimdMulAdd(A1, SimdSplatY(Column), R);
+			R = SimdMulAdd(A2, SimdSplatZ(Column), R);
+			R = SimdMulAdd(A3, SimdSplatW(Column), R);
+			SimdStore(&RetVal.Columns[c].X, R);
+		}
+		return RetVal;
+	}
+
+	//Batch kernels, In and Out may be the same array
+	void TransformPoints(const Mat4& M, const Vec3* In, Vec3* Out, const size_t Count);
+
+	//Tightest box around each transformed box, same result as transforming all 8 corners
+	void TransformAABBs(const Mat4& M, const AABB* In, AABB* Out, const size_t Count);
+
+	//Extracts frustum planes from a view projection matrix (Vulkan 0..1 depth range)
+	Frustum ExtractFrustumPlanes(const Mat4& ViewProjection);
+
+	//Times the SIMD paths above against plain scalar loops and prints the speedups
+	void RunMathBenchmark();
+}
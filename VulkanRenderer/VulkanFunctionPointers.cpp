@@ -3,7 +3,16 @@
 #define GET_INSTANCE_ENTRYPOINT(i, w) w = reinterpret_cast<PFN_##w>(vkGetInstanceProcAddr(i, #w))
 #define GET_DEVICE_ENTRYPOINT(i, w) w = reinterpret_cast<PFN_##w>(vkGetDeviceProcAddr(i, #w))
 
-void VulkanFunctionPointers::FetchFunctionPointers()
+namespace VulkanFunctionPointers
 {
+	PFN_vkGetSemaphoreCounterValueKHR vkGetSemaphoreCounterValueKHR = nullptr;
+	PFN_vkWaitSemaphoresKHR vkWaitSemaphoresKHR = nullptr;
+	PFN_vkSignalSemaphoreKHR vkSignalSemaphoreKHR = nullptr;
+}
 
-}
\ No newline at end of file
+void VulkanFunctionPointers::FetchFunctionPointers(VkDevice Device)
+{
+	GET_DEVICE_ENTRYPOINT(Device, vkGetSemaphoreCounterValueKHR);
+	GET_DEVICE_ENTRYPOINT(Device, vkWaitSemaphoresKHR);
+	GET_DEVICE_ENTRYPOINT(Device, vkSignalSemaphoreKHR);
+}
@@ -4,7 +4,12 @@
 
 namespace VulkanFunctionPointers
 {
-	void FetchFunctionPointers();
+	//Device level entry points of enabled extensions, null when the device didn't enable the extension
+	//VK_KHR_timeline_semaphore
+	extern PFN_vkGetSemaphoreCounterValueKHR vkGetSemaphoreCounterValueKHR;
+	extern PFN_vkWaitSemaphoresKHR vkWaitSemaphoresKHR;
+	extern PFN_vkSignalSemaphoreKHR vkSignalSemaphoreKHR;
+
+	void FetchFunctionPointers(VkDevice Device);
 	
 }
-
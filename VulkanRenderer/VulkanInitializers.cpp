@@ -9,6 +9,8 @@
 
 namespace VulkanCore
 {
+	//Version the instance was created with, device level 1.1 entry points are only callable when this is 1.1
+	static uint32_t InstanceApiVersion = VK_API_VERSION_1_0;
 
 	VkInstance CreateInstance()
 	{
@@ -52,9 +54,17 @@ namespace VulkanCore
 		instanceCreateInfo.ppEnabledLayerNames = instanceLayers.data();
 		instanceCreateInfo.enabledLayerCount = static_cast<uint32_t> (instanceLayers.size());
 
+		//Ask for 1.1 when the loader has it, descriptor indexing needs vkGetPhysicalDeviceFeatures2
+		PFN_vkEnumerateInstanceVersion EnumerateInstanceVersion = reinterpret_cast<PFN_vkEnumerateInstanceVersion>(vkGetInstanceProcAddr(VK_NULL_HANDLE, "vkEnumerateInstanceVersion"));
+		uint32_t LoaderApiVersion = VK_API_VERSION_1_0;
+		if (EnumerateInstanceVersion != nullptr && EnumerateInstanceVersion(&LoaderApiVersion) == VK_SUCCESS && LoaderApiVersion >= VK_API_VERSION_1_1)
+		{
+			InstanceApiVersion = VK_API_VERSION_1_1;
+		}
+
 		VkApplicationInfo applicationInfo = {};
 		applicationInfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
-		applicationInfo.apiVersion = VK_API_VERSION_1_0;
+		applicationInfo.apiVersion = InstanceApiVersion;
 		applicationInfo.applicationVersion = VK_MAKE_VERSION(1, 0, 0);
 		applicationInfo.engineVersion = VK_MAKE_VERSION(1, 0, 0);
 		applicationInfo.pApplicationName = "Vulkan Test";
@@ -115,18 +125,260 @@ namespace VulkanCore
 			}
 		}
 
+		vkGetPhysicalDeviceProperties(GFXDevice.PhysicalDevice, &GFXDevice.Properties);
+
+		//Look for a transfer family without graphics, ideally without compute too (a dedicated copy engine)
+		uint32_t FamilyCount = 0;
+		vkGetPhysicalDeviceQueueFamilyProperties(GFXDevice.PhysicalDevice, &FamilyCount, nullptr);
+		std::vector<VkQueueFamilyProperties> Families{ FamilyCount };
+		vkGetPhysicalDeviceQueueFamilyProperties(GFXDevice.PhysicalDevice, &FamilyCount, Families.data());
+
+		GFXDevice.TransferQueueIndex = GFXDevice.GraphicsQueueIndex;
+		for (uint32_t i = 0; i < FamilyCount; ++i)
+		{
+			const VkQueueFlags Flags = Families[i].queueFlags;
+			if ((Flags & VK_QUEUE_TRANSFER_BIT) == 0 || (Flags & VK_QUEUE_GRAPHICS_BIT) != 0)
+			{
+				continue;
+			}
+			if (!GFXDevice.bHasTransferQueue || (Flags & VK_QUEUE_COMPUTE_BIT) == 0)
+			{
+				GFXDevice.TransferQueueIndex = i;
+				GFXDevice.bHasTransferQueue = true;
+			}
+		}
+
+		//Async compute wants a compute family without graphics, a different one from the transfer family if possible
+		GFXDevice.ComputeQueueIndex = GFXDevice.GraphicsQueueIndex;
+		for (uint32_t i = 0; i < FamilyCount; ++i)
+		{
+			const VkQueueFlags Flags = Families[i].queueFlags;
+			if ((Flags & VK_QUEUE_COMPUTE_BIT) == 0 || (Flags & VK_QUEUE_GRAPHICS_BIT) != 0)
+			{
+				continue;
+			}
+			if (!GFXDevice.bHasComputeQueue || GFXDevice.ComputeQueueIndex == GFXDevice.TransferQueueIndex)
+			{
+				GFXDevice.ComputeQueueIndex = i;
+				GFXDevice.bHasComputeQueue = true;
+			}
+		}
+
+		//Only turn on the optional features we actually use
+		VkPhysicalDeviceFeatures SupportedFeatures = {};
+		vkGetPhysicalDeviceFeatures(GFXDevice.PhysicalDevice, &SupportedFeatures);
+
+		VkPhysicalDeviceFeatures EnabledFeatures = {};
+		EnabledFeatures.multiDrawIndirect = SupportedFeatures.multiDrawIndirect;
+		GFXDevice.bSupportsMultiDrawIndirect = SupportedFeatures.multiDrawIndirect == VK_TRUE;
+
+		//Block compressed formats are only usable with their feature enabled, the texture loader checks support per format
+		EnabledFeatures.textureCompressionBC = SupportedFeatures.textureCompressionBC;
+		EnabledFeatures.textureCompressionETC2 = SupportedFeatures.textureCompressionETC2;
+		EnabledFeatures.textureCompressionASTC_LDR = SupportedFeatures.textureCompressionASTC_LDR;
+
+		//The forward fragment shaders write texture streaming feedback (see TextureStreaming.h)
+		EnabledFeatures.fragmentStoresAndAtomics = SupportedFeatures.fragmentStoresAndAtomics;
+		if (!SupportedFeatures.fragmentStoresAndAtomics)
+		{
+			std::cout << "Fragment stores and atomics not supported, texture streaming feedback can't be written" << std::endl;
+		}
+
+		std::vector<const char*> deviceExtensions =
+		{
+			"VK_KHR_swapchain"
+		};
+
+		//Bindless needs the extension plus the individual indexing features, queried through the 1.1 features chain
+		uint32_t ExtensionCount = 0;
+		vkEnumerateDeviceExtensionProperties(GFXDevice.PhysicalDevice, nullptr, &ExtensionCount, nullptr);
+		std::vector<VkExtensionProperties> Extensions{ ExtensionCount };
+		vkEnumerateDeviceExtensionProperties(GFXDevice.PhysicalDevice, nullptr, &ExtensionCount, Extensions.data());
+
+		bool bHasDescriptorIndexingExtension = false;
+		for (const VkExtensionProperties& Extension : Extensions)
+		{
+			if (strcmp(Extension.extensionName, VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME) == 0)
+			{
+				bHasDescriptorIndexingExtension = true;
+			}
+		}
+
+		VkPhysicalDeviceDescriptorIndexingFeaturesEXT IndexingFeatures = {};
+		IndexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+
+		if (bHasDescriptorIndexingExtension && InstanceApiVersion >= VK_API_VERSION_1_1 && GFXDevice.Properties.apiVersion >= VK_API_VERSION_1_1)
+		{
+			VkPhysicalDeviceFeatures2 SupportedFeatures2 = {};
+			SupportedFeatures2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+			SupportedFeatures2.pNext = &IndexingFeatures;
+			vkGetPhysicalDeviceFeatures2(GFXDevice.PhysicalDevice, &SupportedFeatures2);
+
+			GFXDevice.bSupportsDescriptorIndexing = SupportedFeatures.shaderSampledImageArrayDynamicIndexing
+				&& SupportedFeatures.shaderStorageBufferArrayDynamicIndexing
+				&& IndexingFeatures.runtimeDescriptorArray
+				&& IndexingFeatures.descriptorBindingPartiallyBound
+				&& IndexingFeatures.descriptorBindingUpdateUnusedWhilePending
+				&& IndexingFeatures.descriptorBindingSampledImageUpdateAfterBind
+				&& IndexingFeatures.descriptorBindingStorageBufferUpdateAfterBind;
+		}
+
+		std::cout << "Descriptor indexing: " << (GFXDevice.bSupportsDescriptorIndexing ? "supported" : "not supported, using per-draw descriptor sets") << std::endl;
+
+		//Enable only the indexing features bindless uses, the rest of the queried struct is cleared
+		VkPhysicalDeviceDescriptorIndexingFeaturesEXT EnabledIndexingFeatures = {};
+		EnabledIndexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+		if (GFXDevice.bSupportsDescriptorIndexing)
+		{
+			EnabledFeatures.shaderSampledImageArrayDynamicIndexing = VK_TRUE;
+			EnabledFeatures.shaderStorageBufferArrayDynamicIndexing = VK_TRUE;
+			EnabledIndexingFeatures.runtimeDescriptorArray = VK_TRUE;
+			EnabledIndexingFeatures.descriptorBindingPartiallyBound = VK_TRUE;
+			EnabledIndexingFeatures.descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+			EnabledIndexingFeatures.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+			EnabledIndexingFeatures.descriptorBindingStorageBufferUpdateAfterBind = VK_TRUE;
+			deviceExtensions.push_back(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME);
+		}
+
+		//Timeline semaphores back the per-queue sync counters (see Sync.h)
+		bool bHasTimelineSemaphoreExtension = false;
+		for (const VkExtensionProperties& Extension : Extensions)
+		{
+			if (strcmp(Extension.extensionName, VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME) == 0)
+			{
+				bHasTimelineSemaphoreExtension = true;
+			}
+		}
+
+		if (bHasTimelineSemaphoreExtension && InstanceApiVersion >= VK_API_VERSION_1_1 && GFXDevice.Properties.apiVersion >= VK_API_VERSION_1_1)
+		{
+			VkPhysicalDeviceTimelineSemaphoreFeaturesKHR TimelineFeatures = {};
+			TimelineFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR;
+
+			VkPhysicalDeviceFeatures2 SupportedFeatures2 = {};
+			SupportedFeatures2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+			SupportedFeatures2.pNext = &TimelineFeatures;
+			vkGetPhysicalDeviceFeatures2(GFXDevice.PhysicalDevice, &SupportedFeatures2);
+
+			GFXDevice.bSupportsTimelineSemaphores = TimelineFeatures.timelineSemaphore == VK_TRUE;
+		}
+
+		std::cout << "Timeline semaphores: " << (GFXDevice.bSupportsTimelineSemaphores ? "supported" : "not supported, using a single queue and fences") << std::endl;
+
+		VkPhysicalDeviceTimelineSemaphoreFeaturesKHR EnabledTimelineFeatures = {};
+		EnabledTimelineFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR;
+		if (GFXDevice.bSupportsTimelineSemaphores)
+		{
+			EnabledTimelineFeatures.timelineSemaphore = VK_TRUE;
+			deviceExtensions.push_back(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+		}
+		else
+		{
+			//Cross queue waits need timeline values, without them everything goes through the graphics queue in submission order
+			GFXDevice.TransferQueueIndex = GFXDevice.GraphicsQueueIndex;
+			GFXDevice.bHasTransferQueue = false;
+			GFXDevice.ComputeQueueIndex = GFXDevice.GraphicsQueueIndex;
+			GFXDevice.bHasComputeQueue = false;
+		}
+
+		//Imageless framebuffers need VK_KHR_image_format_list too, VK_KHR_maintenance2 is core in 1.1
+		bool bHasImagelessFramebufferExtension = false;
+		bool bHasImageFormatListExtension = false;
+		for (const VkExtensionProperties& Extension : Extensions)
+		{
+			if (strcmp(Extension.extensionName, VK_KHR_IMAGELESS_FRAMEBUFFER_EXTENSION_NAME) == 0)
+			{
+				bHasImagelessFramebufferExtension = true;
+			}
+			if (strcmp(Extension.extensionName, VK_KHR_IMAGE_FORMAT_LIST_EXTENSION_NAME) == 0)
+			{
+				bHasImageFormatListExtension = true;
+			}
+		}
+
+		if (bHasImagelessFramebufferExtension && bHasImageFormatListExtension && InstanceApiVersion >= VK_API_VERSION_1_1 && GFXDevice.Properties.apiVersion >= VK_API_VERSION_1_1)
+		{
+			VkPhysicalDeviceImagelessFramebufferFeaturesKHR ImagelessFeatures = {};
+			ImagelessFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES_KHR;
+
+			VkPhysicalDeviceFeatures2 SupportedFeatures2 = {};
+			SupportedFeatures2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+			SupportedFeatures2.pNext = &ImagelessFeatures;
+			vkGetPhysicalDeviceFeatures2(GFXDevice.PhysicalDevice, &SupportedFeatures2);
+
+			GFXDevice.bSupportsImagelessFramebuffer = ImagelessFeatures.imagelessFramebuffer == VK_TRUE;
+		}
+
+		std::cout << "Imageless framebuffers: " << (GFXDevice.bSupportsImagelessFramebuffer ? "supported" : "not supported, using one framebuffer per set of views") << std::endl;
+
+		VkPhysicalDeviceImagelessFramebufferFeaturesKHR EnabledImagelessFeatures = {};
+		EnabledImagelessFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES_KHR;
+		if (GFXDevice.bSupportsImagelessFramebuffer)
+		{
+			EnabledImagelessFeatures.imagelessFramebuffer = VK_TRUE;
+			deviceExtensions.push_back(VK_KHR_IMAGE_FORMAT_LIST_EXTENSION_NAME);
+			deviceExtensions.push_back(VK_KHR_IMAGELESS_FRAMEBUFFER_EXTENSION_NAME);
+		}
+
+		static const float QueuePriorities[] = { 1.0f, 1.0f };
+		std::vector<VkDeviceQueueCreateInfo> DeviceQueueCreateInfos;
+
 		VkDeviceQueueCreateInfo DeviceQueueCreateInfo = {};
 		DeviceQueueCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
 		DeviceQueueCreateInfo.queueCount = 1;
 		DeviceQueueCreateInfo.queueFamilyIndex = GFXDevice.GraphicsQueueIndex;
-
-		static const float QueuePriorities[] = { 1.0f };
 		DeviceQueueCreateInfo.pQueuePriorities = QueuePriorities;
+		DeviceQueueCreateInfos.push_back(DeviceQueueCreateInfo);
+
+		if (GFXDevice.bHasTransferQueue)
+		{
+			DeviceQueueCreateInfo.queueFamilyIndex = GFXDevice.TransferQueueIndex;
+			DeviceQueueCreateInfos.push_back(DeviceQueueCreateInfo);
+		}
+
+		//A compute family shared with transfer gets its own queue in it when there are two, otherwise both use queue 0
+		uint32_t ComputeQueueSlot = 0;
+		if (GFXDevice.bHasComputeQueue)
+		{
+			if (GFXDevice.bHasTransferQueue && GFXDevice.ComputeQueueIndex == GFXDevice.TransferQueueIndex)
+			{
+				if (Families[GFXDevice.ComputeQueueIndex].queueCount > 1)
+				{
+					DeviceQueueCreateInfos.back().queueCount = 2;
+					ComputeQueueSlot = 1;
+				}
+			}
+			else
+			{
+				DeviceQueueCreateInfo.queueFamilyIndex = GFXDevice.ComputeQueueIndex;
+				DeviceQueueCreateInfos.push_back(DeviceQueueCreateInfo);
+			}
+		}
+
+		//Enabled feature structs chained in front of each other
+		void* FeatureChain = nullptr;
+		if (GFXDevice.bSupportsTimelineSemaphores)
+		{
+			EnabledTimelineFeatures.pNext = FeatureChain;
+			FeatureChain = &EnabledTimelineFeatures;
+		}
+		if (GFXDevice.bSupportsDescriptorIndexing)
+		{
+			EnabledIndexingFeatures.pNext = FeatureChain;
+			FeatureChain = &EnabledIndexingFeatures;
+		}
+		if (GFXDevice.bSupportsImagelessFramebuffer)
+		{
+			EnabledImagelessFeatures.pNext = FeatureChain;
+			FeatureChain = &EnabledImagelessFeatures;
+		}
 
 		VkDeviceCreateInfo DeviceCreateInfo = {};
 		DeviceCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
-		DeviceCreateInfo.queueCreateInfoCount = 1;
-		DeviceCreateInfo.pQueueCreateInfos = &DeviceQueueCreateInfo;
+		DeviceCreateInfo.pNext = FeatureChain;
+		DeviceCreateInfo.queueCreateInfoCount = static_cast<uint32_t> (DeviceQueueCreateInfos.size());
+		DeviceCreateInfo.pQueueCreateInfos = DeviceQueueCreateInfos.data();
+		DeviceCreateInfo.pEnabledFeatures = &EnabledFeatures;
 
 		std::vector<const char*> DeviceLayers;
 
@@ -139,11 +391,6 @@ namespace VulkanCore
 		DeviceCreateInfo.ppEnabledLayerNames = DeviceLayers.data();
 		DeviceCreateInfo.enabledLayerCount = static_cast<uint32_t> (DeviceLayers.size());
 
-		std::vector<const char*> deviceExtensions =
-		{
-			"VK_KHR_swapchain"
-		};
-
 		DeviceCreateInfo.ppEnabledExtensionNames = deviceExtensions.data();
 		DeviceCreateInfo.enabledExtensionCount = static_cast<uint32_t> (deviceExtensions.size());
 		VkResult R = VK_SUCCESS;
@@ -152,6 +399,8 @@ namespace VulkanCore
 		{
 			std::cout << "Device Created Successfully" << std::endl;
 			std::cout << "Graphics Queue Index: " << GFXDevice.GraphicsQueueIndex << std::endl;
+			std::cout << "Transfer Queue Index: " << GFXDevice.TransferQueueIndex << (GFXDevice.bHasTransferQueue ? " (dedicated)" : " (shared with graphics)") << std::endl;
+			std::cout << "Compute Queue Index: " << GFXDevice.ComputeQueueIndex << (GFXDevice.bHasComputeQueue ? " (async)" : " (shared with graphics)") << std::endl;
 		}
 		else
 		{
@@ -159,6 +408,10 @@ namespace VulkanCore
 		}
 
 		vkGetDeviceQueue(GFXDevice.Device, GFXDevice.GraphicsQueueIndex, 0, &GFXDevice.GraphicsQueue);
+		vkGetDeviceQueue(GFXDevice.Device, GFXDevice.TransferQueueIndex, 0, &GFXDevice.TransferQueue);
+		vkGetDeviceQueue(GFXDevice.Device, GFXDevice.ComputeQueueIndex, ComputeQueueSlot, &GFXDevice.ComputeQueue);
+
+		VulkanFunctionPointers::FetchFunctionPointers(GFXDevice.Device);
 
 		return GFXDevice;
 	}
@@ -254,7 +507,9 @@ namespace VulkanCore
 		SwapchainCreateInfo.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR;
 		SwapchainCreateInfo.surface = Surface;
 		SwapchainCreateInfo.minImageCount = SwapChainImageCount;
-		SwapchainCreateInfo.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+		//Copy destination too when allowed, so a frame rendered offscreen can be copied in
+		SwapData.Usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | (SurfaceCapabilities.supportedUsageFlags & VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+		SwapchainCreateInfo.imageUsage = SwapData.Usage;
 		SwapchainCreateInfo.preTransform = SurfaceTransformFlags;
 		SwapchainCreateInfo.imageColorSpace = ColorSpace;
 		SwapchainCreateInfo.imageFormat = SwapData.Format;
@@ -281,6 +536,23 @@ namespace VulkanCore
 		return SwapData;
 	}
 
+	VkFormat FindDepthFormat(GraphicsDevice& GFXDevice)
+	{
+		const VkFormat Candidates[] = { VK_FORMAT_D32_SFLOAT, VK_FORMAT_X8_D24_UNORM_PACK32, VK_FORMAT_D16_UNORM };
+		for (VkFormat Format : Candidates)
+		{
+			VkFormatProperties FormatProperties = {};
+			vkGetPhysicalDeviceFormatProperties(GFXDevice.PhysicalDevice, Format, &FormatProperties);
+			if (FormatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT)
+			{
+				return Format;
+			}
+		}
+
+		std::cout << "No depth attachment format found" << std::endl;
+		return VK_FORMAT_UNDEFINED;
+	}
+
 	std::vector<VkImage> GetSwapchainImages(GraphicsDevice& GFXDevice, VkSwapchainKHR& Swapchain)
 	{
 		uint32_t SwapchainImageCount(0);
@@ -329,102 +601,16 @@ namespace VulkanCore
 		return SwapchainImageViews;
 	}
 
-	VkRenderPass CreateForwardRenderpass(GraphicsDevice& GFXDevice, VkFormat SwapFormat)
-	{
-		//Describe Color Attachment (this is where the final result gets drawn)
-		VkAttachmentDescription AttachmentDescription = {};
-		AttachmentDescription.samples = VK_SAMPLE_COUNT_1_BIT;
-		AttachmentDescription.format = SwapFormat;
-		AttachmentDescription.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
-		AttachmentDescription.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
-		AttachmentDescription.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-		AttachmentDescription.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
-		AttachmentDescription.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-		AttachmentDescription.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-
-		//TODO: Depth attach
-
-		//A reference to the above attachment, for use with the subpass 
-		//This is how subpasses reference attachments set up in the overarching render pass
-		VkAttachmentReference AttachmentReference = {};
-		AttachmentReference.attachment = 0;
-		AttachmentReference.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
-
-		//Describe our single (the minimum required) subpass 
-		//We pass in our attachment reference and tell it it is a graphics subpass
-		VkSubpassDescription SubpassDescription = {};
-		SubpassDescription.inputAttachmentCount = 0;
-		SubpassDescription.pColorAttachments = &AttachmentReference;
-		SubpassDescription.colorAttachmentCount = 1;
-		SubpassDescription.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
-
-		//Hook up the attachment desc and subpass to our renderpass create info struct
-		VkRenderPassCreateInfo RenderPassCreateInfo = {};
-		RenderPassCreateInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
-		RenderPassCreateInfo.attachmentCount = 1;
-		RenderPassCreateInfo.subpassCount = 1;
-		RenderPassCreateInfo.pSubpasses = &SubpassDescription;
-		RenderPassCreateInfo.pAttachments = &AttachmentDescription;
-
-		VkRenderPass RenderPass;
-		VkResult R = vkCreateRenderPass(GFXDevice.Device, &RenderPassCreateInfo, nullptr, &RenderPass);
-
-		if (R == VK_SUCCESS)
-		{
-			std::cout << "Render pass created successfully" << std::endl;
-		}
-		else
-		{
-			std::cout << "Render pass creation failed with error: " << R << std::endl;
-		}
-
-		return RenderPass;	
-	}
-
-	std::vector<VkFramebuffer> CreateFrameBuffers(GraphicsDevice& GFXDevice, VkRenderPass RenderPass, std::vector<VkImageView>& SwapchainViews, const int& width, const int& height)
+	VkCommandPool CreateCommandPool(GraphicsDevice& GFXDevice)
 	{
-		std::vector<VkFramebuffer> Framebuffers;
-
-		VkResult R = VK_SUCCESS;
-		bool bFailed = false;
-
-		for (int i = 0; i < SwapchainViews.size(); ++i)
-		{
-			VkFramebufferCreateInfo FramebufferCreateInfo = {};
-			FramebufferCreateInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
-			FramebufferCreateInfo.attachmentCount = 1;
-			FramebufferCreateInfo.pAttachments = &SwapchainViews[i];
-			FramebufferCreateInfo.height = height;
-			FramebufferCreateInfo.width = width;
-			FramebufferCreateInfo.layers = 1;
-			FramebufferCreateInfo.renderPass = RenderPass;
-
-			VkFramebuffer Framebuffer;
-			R = vkCreateFramebuffer(GFXDevice.Device, &FramebufferCreateInfo, nullptr, &Framebuffer);
-			if (R != VK_SUCCESS)
-			{
-				bFailed = true;
-				std::cout << "Framebuffer creation Failed with error: " << R << std::endl;
-			}
-			else
-			{
-				Framebuffers.push_back(Framebuffer);
-			}
-		}
-
-		if (!bFailed)
-		{
-			std::cout << "All Framebuffers created" << std::endl;
-		}
-
-		return Framebuffers;
+		return CreateCommandPool(GFXDevice, GFXDevice.GraphicsQueueIndex);
 	}
 
-	VkCommandPool CreateCommandPool(GraphicsDevice& GFXDevice)
+	VkCommandPool CreateCommandPool(GraphicsDevice& GFXDevice, const uint32_t QueueFamilyIndex)
 	{
 		VkCommandPoolCreateInfo CommandPoolCreateInfo = {};
 		CommandPoolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-		CommandPoolCreateInfo.queueFamilyIndex = GFXDevice.GraphicsQueueIndex;
+		CommandPoolCreateInfo.queueFamilyIndex = QueueFamilyIndex;
 		CommandPoolCreateInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
 
 		VkCommandPool CommandPool;
@@ -491,12 +677,21 @@ namespace VulkanCore
 
 	VkShaderModule LoadShader(GraphicsDevice& GFXDevice, const void* ShaderContents, const size_t Size)
 	{
+		//pCode must be 4 byte aligned, byte arrays aren't guaranteed to be
+		std::vector<uint32_t> AlignedCode;
+		if (reinterpret_cast<uintptr_t> (ShaderContents) % sizeof(uint32_t) != 0)
+		{
+			AlignedCode.resize((Size + sizeof(uint32_t) - 1) / sizeof(uint32_t));
+			memcpy(AlignedCode.data(), ShaderContents, Size);
+			ShaderContents = AlignedCode.data();
+		}
+
 		VkShaderModuleCreateInfo ShaderModuleCreateInfo = {};
 		ShaderModuleCreateInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
 		ShaderModuleCreateInfo.pCode = static_cast<const uint32_t*> (ShaderContents);
 		ShaderModuleCreateInfo.codeSize = Size;
 		
-		VkShaderModule Shader;
+		VkShaderModule Shader = VK_NULL_HANDLE;
 		VkResult R = vkCreateShaderModule(GFXDevice.Device, &ShaderModuleCreateInfo, nullptr, &Shader);
 		if (R == VK_SUCCESS)
 		{
@@ -510,41 +705,55 @@ namespace VulkanCore
 		return Shader;
 	}
 
-	VkPipeline CreatePipeline(GraphicsDevice& GFXDevice, VkRenderPass& RenderPass, VkShaderModule& VertexShader, VkShaderModule& FragmentShader, VkExtent2D& Extent)
+	bool AddPushConstantRange(GraphicsDevice& GFXDevice, PipelineLayoutDesc& LayoutDesc, const VkShaderStageFlags Stages, const uint32_t Offset, const uint32_t Size)
+	{
+		//Offset and size must both be multiples of 4
+		const uint32_t AlignedSize = RoundToNextMultiple(Size, 4u);
+		if (Offset % 4 != 0 || Offset + AlignedSize > GFXDevice.Properties.limits.maxPushConstantsSize)
+		{
+			return false;
+		}
+
+		VkPushConstantRange Range = {};
+		Range.stageFlags = Stages;
+		Range.offset = Offset;
+		Range.size = AlignedSize;
+		LayoutDesc.PushConstantRanges.push_back(Range);
+		return true;
+	}
+
+	VkPipelineLayout CreatePipelineLayout(GraphicsDevice& GFXDevice, const PipelineLayoutDesc& LayoutDesc)
 	{
 		VkPipelineLayoutCreateInfo LayoutCreateInfo = {};
 		LayoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+		LayoutCreateInfo.setLayoutCount = static_cast<uint32_t> (LayoutDesc.SetLayouts.size());
+		LayoutCreateInfo.pSetLayouts = LayoutDesc.SetLayouts.data();
+		LayoutCreateInfo.pushConstantRangeCount = static_cast<uint32_t> (LayoutDesc.PushConstantRanges.size());
+		LayoutCreateInfo.pPushConstantRanges = LayoutDesc.PushConstantRanges.data();
 
-		VkPipelineLayout PipelineLayout;
-		VkResult R = vkCreatePipelineLayout(GFXDevice.Device, &LayoutCreateInfo, nullptr, &PipelineLayout);
+		VkPipelineLayout Layout = VK_NULL_HANDLE;
+		VkResult R = vkCreatePipelineLayout(GFXDevice.Device, &LayoutCreateInfo, nullptr, &Layout);
 		if (R != VK_SUCCESS)
 		{
 			std::cout << "Pipeline layout creation failed" << std::endl;
 		}
+		return Layout;
+	}
 
-		//Describe per-vertex data
-		VkVertexInputBindingDescription VertInputBindingDesc;
-		VertInputBindingDesc.binding = 0;
-		VertInputBindingDesc.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
-		VertInputBindingDesc.stride = sizeof(float) * 5;
-
-		VkVertexInputAttributeDescription InputAttrDescriptions[2] = {};
-		InputAttrDescriptions[0].binding = VertInputBindingDesc.binding;
-		InputAttrDescriptions[0].format = VK_FORMAT_R32G32B32_SFLOAT;
-		InputAttrDescriptions[0].location = 0;
-		InputAttrDescriptions[0].offset = 0;
-
-		InputAttrDescriptions[1].binding = VertInputBindingDesc.binding;
-		InputAttrDescriptions[1].format = VK_FORMAT_R32G32_SFLOAT;
-		InputAttrDescriptions[1].location = 1;
-		InputAttrDescriptions[1].offset = sizeof(float) * 3;
+	PipelineData CreatePipeline(GraphicsDevice& GFXDevice, VkRenderPass& RenderPass, VkShaderModule& VertexShader, VkShaderModule& FragmentShader, VkExtent2D& Extent,
+		VkPipelineLayout Layout, const VertexInputLayout& VertexInput, const VkSpecializationInfo* Specialization,
+		VkPipelineCache DriverCache, const bool bDepthTest)
+	{
+		PipelineData RetVal;
+		RetVal.Layout = Layout;
 
+		//Describe per-vertex data
 		VkPipelineVertexInputStateCreateInfo PipelineVertexInputStateCreateInfo = {};
 		PipelineVertexInputStateCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-		PipelineVertexInputStateCreateInfo.vertexAttributeDescriptionCount = std::extent<decltype(InputAttrDescriptions)>::value;
-		PipelineVertexInputStateCreateInfo.pVertexAttributeDescriptions = InputAttrDescriptions;
-		PipelineVertexInputStateCreateInfo.vertexBindingDescriptionCount = 1;
-		PipelineVertexInputStateCreateInfo.pVertexBindingDescriptions = &VertInputBindingDesc;
+		PipelineVertexInputStateCreateInfo.vertexAttributeDescriptionCount = static_cast<uint32_t> (VertexInput.Attributes.size());
+		PipelineVertexInputStateCreateInfo.pVertexAttributeDescriptions = VertexInput.Attributes.data();
+		PipelineVertexInputStateCreateInfo.vertexBindingDescriptionCount = static_cast<uint32_t> (VertexInput.Bindings.size());
+		PipelineVertexInputStateCreateInfo.pVertexBindingDescriptions = VertexInput.Bindings.data();
 
 		//Setup Input Assembler
 		VkPipelineInputAssemblyStateCreateInfo InputAssemblyCreateInfo = {};
@@ -599,9 +808,9 @@ namespace VulkanCore
 		//Depth stencil state
 		VkPipelineDepthStencilStateCreateInfo PipelineDepthStencilStateCreateInfo = {};
 		PipelineDepthStencilStateCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
-		PipelineDepthStencilStateCreateInfo.depthTestEnable = VK_FALSE;
-		PipelineDepthStencilStateCreateInfo.depthWriteEnable = VK_FALSE;
-		PipelineDepthStencilStateCreateInfo.depthCompareOp = VK_COMPARE_OP_ALWAYS;
+		PipelineDepthStencilStateCreateInfo.depthTestEnable = bDepthTest ? VK_TRUE : VK_FALSE;
+		PipelineDepthStencilStateCreateInfo.depthWriteEnable = bDepthTest ? VK_TRUE : VK_FALSE;
+		PipelineDepthStencilStateCreateInfo.depthCompareOp = bDepthTest ? VK_COMPARE_OP_LESS_OR_EQUAL : VK_COMPARE_OP_ALWAYS;
 		PipelineDepthStencilStateCreateInfo.depthBoundsTestEnable = VK_FALSE;
 		PipelineDepthStencilStateCreateInfo.back.failOp = VK_STENCIL_OP_KEEP;
 		PipelineDepthStencilStateCreateInfo.back.passOp = VK_STENCIL_OP_KEEP;
@@ -620,18 +829,20 @@ namespace VulkanCore
 		PipelineShaderStageCreateInfos[0].module = VertexShader;
 		PipelineShaderStageCreateInfos[0].pName = "main"; //Entry Point
 		PipelineShaderStageCreateInfos[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+		PipelineShaderStageCreateInfos[0].pSpecializationInfo = Specialization;
 
 		//FRAGMENT STAGE
 		PipelineShaderStageCreateInfos[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
 		PipelineShaderStageCreateInfos[1].module = FragmentShader;
 		PipelineShaderStageCreateInfos[1].pName = "main"; //Entry Point
 		PipelineShaderStageCreateInfos[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+		PipelineShaderStageCreateInfos[1].pSpecializationInfo = Specialization;
 
 		//GFX Pipeline create-info super-struct (we hook up all of the above structs here)
 		VkGraphicsPipelineCreateInfo GraphicsPipelineCreateInfo = {};
 		GraphicsPipelineCreateInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
 
-		GraphicsPipelineCreateInfo.layout = PipelineLayout;
+		GraphicsPipelineCreateInfo.layout = RetVal.Layout;
 		GraphicsPipelineCreateInfo.pVertexInputState = &PipelineVertexInputStateCreateInfo;
 		GraphicsPipelineCreateInfo.pInputAssemblyState = &InputAssemblyCreateInfo;
 		GraphicsPipelineCreateInfo.renderPass = RenderPass;
@@ -643,9 +854,8 @@ namespace VulkanCore
 		GraphicsPipelineCreateInfo.pStages = PipelineShaderStageCreateInfos;
 		GraphicsPipelineCreateInfo.stageCount = 2;
 
-		VkPipeline Pipeline;
-		R = vkCreateGraphicsPipelines(GFXDevice.Device, VK_NULL_HANDLE, 1, &GraphicsPipelineCreateInfo,
-												nullptr, &Pipeline);
+		VkResult R = vkCreateGraphicsPipelines(GFXDevice.Device, DriverCache, 1, &GraphicsPipelineCreateInfo,
+												nullptr, &RetVal.Pipeline);
 		if (R == VK_SUCCESS)
 		{
 			std::cout << "Pipeline Created Successfully" << std::endl;
@@ -655,7 +865,104 @@ namespace VulkanCore
 			std::cout << "Pipeline Creation Failed with error: " << R << std::endl;
 		}
 
-		return Pipeline;
+		return RetVal;
+	}
+
+	PipelineData CreateComputePipeline(GraphicsDevice& GFXDevice, VkShaderModule& ComputeShader, VkPipelineLayout Layout)
+	{
+		PipelineData RetVal;
+		RetVal.Layout = Layout;
+
+		VkComputePipelineCreateInfo ComputePipelineCreateInfo = {};
+		ComputePipelineCreateInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+		ComputePipelineCreateInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+		ComputePipelineCreateInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+		ComputePipelineCreateInfo.stage.module = ComputeShader;
+		ComputePipelineCreateInfo.stage.pName = "main";
+		ComputePipelineCreateInfo.layout = RetVal.Layout;
+
+		VkResult R = vkCreateComputePipelines(GFXDevice.Device, VK_NULL_HANDLE, 1, &ComputePipelineCreateInfo, nullptr, &RetVal.Pipeline);
+		if (R == VK_SUCCESS)
+		{
+			std::cout << "Compute Pipeline Created Successfully" << std::endl;
+		}
+		else
+		{
+			std::cout << "Compute Pipeline Creation Failed with error: " << R << std::endl;
+		}
+
+		return RetVal;
+	}
+
+	VkDescriptorSetLayout CreateDescriptorSetLayout(GraphicsDevice& GFXDevice, const std::vector<VkDescriptorSetLayoutBinding>& Bindings,
+		const VkDescriptorSetLayoutCreateFlags Flags, const std::vector<VkDescriptorBindingFlags>& BindingFlags)
+	{
+		VkDescriptorSetLayoutBindingFlagsCreateInfoEXT BindingFlagsCreateInfo = {};
+		BindingFlagsCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT;
+		BindingFlagsCreateInfo.bindingCount = static_cast<uint32_t> (BindingFlags.size());
+		BindingFlagsCreateInfo.pBindingFlags = BindingFlags.data();
+
+		VkDescriptorSetLayoutCreateInfo LayoutCreateInfo = {};
+		LayoutCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+		LayoutCreateInfo.pNext = BindingFlags.empty() ? nullptr : &BindingFlagsCreateInfo;
+		LayoutCreateInfo.flags = Flags;
+		LayoutCreateInfo.bindingCount = static_cast<uint32_t> (Bindings.size());
+		LayoutCreateInfo.pBindings = Bindings.data();
+
+		VkDescriptorSetLayout Layout = VK_NULL_HANDLE;
+		VkResult R = vkCreateDescriptorSetLayout(GFXDevice.Device, &LayoutCreateInfo, nullptr, &Layout);
+		if (R == VK_SUCCESS)
+		{
+			std::cout << "Descriptor set layout created successfully" << std::endl;
+		}
+		else
+		{
+			std::cout << "Descriptor set layout creation failed with error: " << R << std::endl;
+		}
+
+		return Layout;
+	}
+
+	VkDescriptorPool CreateDescriptorPool(GraphicsDevice& GFXDevice, const std::vector<VkDescriptorPoolSize>& PoolSizes, const uint32_t MaxSets,
+		const VkDescriptorPoolCreateFlags Flags)
+	{
+		VkDescriptorPoolCreateInfo PoolCreateInfo = {};
+		PoolCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+		PoolCreateInfo.flags = Flags;
+		PoolCreateInfo.maxSets = MaxSets;
+		PoolCreateInfo.poolSizeCount = static_cast<uint32_t> (PoolSizes.size());
+		PoolCreateInfo.pPoolSizes = PoolSizes.data();
+
+		VkDescriptorPool Pool = VK_NULL_HANDLE;
+		VkResult R = vkCreateDescriptorPool(GFXDevice.Device, &PoolCreateInfo, nullptr, &Pool);
+		if (R == VK_SUCCESS)
+		{
+			std::cout << "Descriptor pool created successfully" << std::endl;
+		}
+		else
+		{
+			std::cout << "Descriptor pool creation failed with error: " << R << std::endl;
+		}
+
+		return Pool;
+	}
+
+	VkDescriptorSet AllocateDescriptorSet(GraphicsDevice& GFXDevice, VkDescriptorPool Pool, VkDescriptorSetLayout Layout)
+	{
+		VkDescriptorSetAllocateInfo AllocateInfo = {};
+		AllocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+		AllocateInfo.descriptorPool = Pool;
+		AllocateInfo.descriptorSetCount = 1;
+		AllocateInfo.pSetLayouts = &Layout;
+
+		VkDescriptorSet Set = VK_NULL_HANDLE;
+		VkResult R = vkAllocateDescriptorSets(GFXDevice.Device, &AllocateInfo, &Set);
+		if (R != VK_SUCCESS)
+		{
+			std::cout << "Descriptor set allocation failed with error: " << R << std::endl;
+		}
+
+		return Set;
 	}
 
 	std::vector<MemoryTypeInfo> EnumerateHeaps(VkPhysicalDevice Device)
@@ -732,6 +1039,57 @@ namespace VulkanCore
 		return VK_NULL_HANDLE;
 	}
 
+	VkDeviceMemory AllocateMemory(VkDevice Device, std::vector<MemoryTypeInfo>& MemoryInfos, const VkMemoryRequirements& Requirements, const bool bDeviceLocal)
+	{
+		//Best match first, then anything the resource accepts that still has the required property
+		int BestIndex = -1;
+		int FallbackIndex = -1;
+		for (auto& memoryInfo : MemoryInfos)
+		{
+			if ((Requirements.memoryTypeBits & (1u << memoryInfo.index)) == 0)
+			{
+				continue;
+			}
+
+			bool bPreferred = bDeviceLocal ? (memoryInfo.deviceLocal && !memoryInfo.hostVisible) : (memoryInfo.hostVisible && memoryInfo.hostCoherent);
+			bool bAcceptable = bDeviceLocal ? memoryInfo.deviceLocal : memoryInfo.hostVisible;
+
+			if (bPreferred && BestIndex < 0)
+			{
+				BestIndex = memoryInfo.index;
+			}
+			if (bAcceptable && FallbackIndex < 0)
+			{
+				FallbackIndex = memoryInfo.index;
+			}
+		}
+
+		int TypeIndex = BestIndex >= 0 ? BestIndex : FallbackIndex;
+		if (TypeIndex < 0)
+		{
+			std::cout << "memory alloc failed: no compatible memory type" << std::endl;
+			return VK_NULL_HANDLE;
+		}
+
+		VkMemoryAllocateInfo memoryAllocateInfo = {};
+		memoryAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+		memoryAllocateInfo.memoryTypeIndex = TypeIndex;
+		memoryAllocateInfo.allocationSize = Requirements.size;
+
+		VkDeviceMemory deviceMemory = VK_NULL_HANDLE;
+		VkResult R = vkAllocateMemory(Device, &memoryAllocateInfo, nullptr, &deviceMemory);
+		if (R == VK_SUCCESS)
+		{
+			std::cout << "GPU Memory successfully allocated" << std::endl;
+		}
+		else
+		{
+			std::cout << "memory alloc failed with error: " << R << std::endl;
+		}
+
+		return deviceMemory;
+	}
+
 	VkBuffer AllocateBuffer(VkDevice Device, const int Size, const VkBufferUsageFlagBits UsageFlags)
 	{
 		VkBufferCreateInfo bufferCreateInfo = {};
@@ -753,7 +1111,7 @@ namespace VulkanCore
 		return result;
 	}
 
-	TestMesh CreateMeshBuffers(GraphicsDevice& GFXDevice, VkCommandBuffer UploadCommandBuffer)
+	TestMesh CreateMeshBuffers(GeometryBuffer& Geometry)
 	{
 		struct Vertex
 		{
@@ -772,69 +1130,18 @@ namespace VulkanCore
 			{ { -1.0f, -1.0f, 0 },{ 0, 1 } }
 		};
 
-		static const int indices[6] = {
+		static const uint32_t indices[6] = {
 			0, 1, 2, 2, 3, 0
 		};
 
 		TestMesh RetVal;
 
-		//Get info on physical device memory heaps
-		std::vector<VulkanCore::MemoryTypeInfo> MemoryHeaps = EnumerateHeaps(GFXDevice.PhysicalDevice);
-
-		//Allocate our buffers and fetch memory requirements
-		RetVal.IndexBuffer = AllocateBuffer(GFXDevice.Device, sizeof(indices), VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
-		RetVal.VertexBuffer = AllocateBuffer(GFXDevice.Device, sizeof(vertices), VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
-		VkMemoryRequirements vertexBufferMemoryRequirements = {};
-		vkGetBufferMemoryRequirements(GFXDevice.Device, RetVal.VertexBuffer, &vertexBufferMemoryRequirements);
-		VkMemoryRequirements indexBufferMemoryRequirements = {};
-		vkGetBufferMemoryRequirements(GFXDevice.Device, RetVal.IndexBuffer, &indexBufferMemoryRequirements);
-
-		VkDeviceSize bufferSize = vertexBufferMemoryRequirements.size;
-		// We want to place the index buffer behind the vertex buffer. Need to take
-		// the alignment into account to find the next suitable location
-		VkDeviceSize indexBufferOffset = RoundToNextMultiple(bufferSize, indexBufferMemoryRequirements.alignment);
-
-		bufferSize = indexBufferOffset + indexBufferMemoryRequirements.size;
-
-		RetVal.DeviceMemory = AllocateMemory(GFXDevice.Device, MemoryHeaps, static_cast<int>(bufferSize));
-
-		VkResult R = VK_SUCCESS;
-
-		R = vkBindBufferMemory(GFXDevice.Device, RetVal.VertexBuffer, RetVal.DeviceMemory, 0);
-		switch (R)
-		{
-		case VK_SUCCESS:
-			std::cout << "Vertex Buffer memory bind successful" << std::endl; break;
-		case VK_ERROR_OUT_OF_HOST_MEMORY:
-			std::cout << "VertexBuffer memory bind Error: Out of Host Memory" << std::endl; break;
-		case VK_ERROR_OUT_OF_DEVICE_MEMORY:
-			std::cout << "VertexBuffer memory bind Error: Out of Device Memory" << std::endl; break;
-		default:
-			std::cout << "VertexBuffer memory bind Unknown error" << std::endl;
-		}
-		
-		vkBindBufferMemory(GFXDevice.Device, RetVal.IndexBuffer, RetVal.DeviceMemory, indexBufferOffset);
-
-		switch (R)
-		{
-		case VK_SUCCESS:
-			std::cout << "IndexBuffer memory bind successful" << std::endl; break;
-		case VK_ERROR_OUT_OF_HOST_MEMORY:
-			std::cout << "IndexBuffer memory bind Error: Out of Host Memory" << std::endl; break;
-		case VK_ERROR_OUT_OF_DEVICE_MEMORY:
-			std::cout << "IndexBuffer memory bind Error: Out of Device Memory" << std::endl; break;
-		default:
-			std::cout << "IndexBuffer memory bind Unknown error" << std::endl;
-		}
-
-		void* mapping = nullptr;
-		vkMapMemory(GFXDevice.Device, RetVal.DeviceMemory, 0, VK_WHOLE_SIZE,
-			0, &mapping);
-		::memcpy(mapping, vertices, sizeof(vertices));
+		//Build the LOD chain at import time, all levels share the vertices and are stored as one index range
+		RetVal.LODs = BuildLODChain(vertices[0].position, 4, sizeof(Vertex), indices, 6, 4);
+		const std::vector<uint32_t>& MeshletIndices = RetVal.LODs.Indices;
 
-		::memcpy(static_cast<uint8_t*> (mapping) + indexBufferOffset,
-			indices, sizeof(indices));
-		vkUnmapMemory(GFXDevice.Device, RetVal.DeviceMemory);
+		static_assert(sizeof(Vertex) == TestMeshVertexStride, "Test mesh vertex layout changed");
+		RetVal.Geometry = AllocateGeometry(Geometry, vertices, 4, MeshletIndices.data(), static_cast<uint32_t> (MeshletIndices.size()));
 
 		return RetVal;
 	}
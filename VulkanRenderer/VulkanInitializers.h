@@ -2,6 +2,8 @@
 
 #include "vulkan\vulkan.h"
 #include "GLFW\glfw3.h"
+#include "MeshLOD.h"
+#include "GeometryBuffer.h"
 #include <vector>
 #include <tuple>
 
@@ -14,12 +16,41 @@ namespace VulkanCore
 		VkQueue GraphicsQueue = VK_NULL_HANDLE;
 		int GraphicsQueueIndex = VK_NULL_HANDLE;
 		VkPhysicalDevice PhysicalDevice = VK_NULL_HANDLE;
+
+		//Transfer only queue (DMA engine) when the device has one, otherwise the graphics queue and family again
+		VkQueue TransferQueue = VK_NULL_HANDLE;
+		int TransferQueueIndex = VK_NULL_HANDLE;
+		bool bHasTransferQueue = false;
+
+		//Compute queue without graphics for async work, otherwise the graphics queue and family again
+		//Shares the transfer family (as a second queue when the family has one) only if that is the sole compute-only family
+		VkQueue ComputeQueue = VK_NULL_HANDLE;
+		int ComputeQueueIndex = VK_NULL_HANDLE;
+		bool bHasComputeQueue = false;
+
+		//Limits (alignments, ranges) and the device's API version
+		VkPhysicalDeviceProperties Properties = {};
+
+		//Optional features enabled at device creation
+		bool bSupportsMultiDrawIndirect = false;
+
+		//VK_EXT_descriptor_indexing with update-after-bind, partially bound and runtime arrays (see Bindless.h)
+		bool bSupportsDescriptorIndexing = false;
+
+		//VK_KHR_timeline_semaphore, the dedicated transfer and compute queues are only used with it (see Sync.h)
+		bool bSupportsTimelineSemaphores = false;
+
+		//VK_KHR_imageless_framebuffer, framebuffers then only describe their attachments and get the views at render pass begin (see RenderPassCache.h)
+		bool bSupportsImagelessFramebuffer = false;
 	};
 
 	struct SwapchainData
 	{
 		VkSwapchainKHR Swapchain = VK_NULL_HANDLE;
 		VkFormat Format = VK_FORMAT_UNDEFINED;
+
+		//Always a color attachment, also a copy destination where the surface allows it
+		VkImageUsageFlags Usage = 0;
 	};
 
 	//Creates a Vulkan Instance
@@ -34,21 +65,21 @@ namespace VulkanCore
 	//Creates a swapchain used to present images to the surface
 	SwapchainData CreateSwapchain(GraphicsDevice& GFXDevice, VkSurfaceKHR& Surface, const int& BackBufferCount, const int& Width, const int& Height);
 
+	//First depth-only format the device can render to, VK_FORMAT_UNDEFINED when none (the spec guarantees one)
+	VkFormat FindDepthFormat(GraphicsDevice& GFXDevice);
+
 	//Fetches the swapchain images for use
 	std::vector<VkImage> GetSwapchainImages(GraphicsDevice& GFXDevice, VkSwapchainKHR& Swapchain);
 
 	//Creates the image views for our swapchain images
 	std::vector<VkImageView> CreateSwapchainImageViews(GraphicsDevice& GFXDevice, VkFormat format, const std::vector<VkImage> Images);
 
-	//Creates a minimal forward-rendering reanderpass
-	VkRenderPass CreateForwardRenderpass(GraphicsDevice& GFXDevice, VkFormat SwapFormat);
-
-	//Creates framebuffers and their image views for the input render pass
-	std::vector<VkFramebuffer> CreateFrameBuffers(GraphicsDevice& GFXDevice, VkRenderPass RenderPass, std::vector<VkImageView>& SwapchainViews, const int& width, const int& height);
-
 	//Creates a command pool from which command buffers can be created
 	VkCommandPool CreateCommandPool(GraphicsDevice& GFXDevice);
 
+	//Creates a command pool for a specific queue family (e.g. the transfer queue's)
+	VkCommandPool CreateCommandPool(GraphicsDevice& GFXDevice, const uint32_t QueueFamilyIndex);
+
 	//Creates "Count" command buffers of type primary
 	std::vector<VkCommandBuffer> AllocateCommandBuffers(GraphicsDevice& GFXDevice, VkCommandPool& CommandPool, const uint32_t& Count);
 
@@ -56,10 +87,56 @@ namespace VulkanCore
 	VkFence CreateFence(GraphicsDevice& GFXDevice, bool bSignaled);
 
 	//Load a Spir-V shader
+	//Copies ShaderContents to aligned storage first when it isn't 4 byte aligned
 	VkShaderModule LoadShader(GraphicsDevice& GFXDevice, const void* ShaderContents, const size_t Size);
 
-	//Create the VkPipeline
-	VkPipeline CreatePipeline(GraphicsDevice& GFXDevice, VkRenderPass& RenderPass, VkShaderModule& VertexShader, VkShaderModule& FragmentShader, VkExtent2D& Extent);
+	//A pipeline and the layout it was created with, the layout is owned by the DescriptorLayoutCache it came from
+	struct PipelineData
+	{
+		VkPipeline Pipeline = VK_NULL_HANDLE;
+		VkPipelineLayout Layout = VK_NULL_HANDLE;
+	};
+
+	//Set layouts (by set index) and push constant ranges a pipeline layout is built from
+	struct PipelineLayoutDesc
+	{
+		std::vector<VkDescriptorSetLayout> SetLayouts;
+		std::vector<VkPushConstantRange> PushConstantRanges;
+	};
+
+	//Vertex buffer bindings and the attributes read from them
+	struct VertexInputLayout
+	{
+		std::vector<VkVertexInputBindingDescription> Bindings;
+		std::vector<VkVertexInputAttributeDescription> Attributes;
+	};
+
+	//Declares Size bytes at Offset for Stages, offsets come from the shaders' push constant blocks
+	//Returns false (adding nothing) when the range would end past maxPushConstantsSize
+	bool AddPushConstantRange(GraphicsDevice& GFXDevice, PipelineLayoutDesc& LayoutDesc, const VkShaderStageFlags Stages, const uint32_t Offset, const uint32_t Size);
+
+	//Creates the VkPipelineLayout described by LayoutDesc, owned by the caller (GetPipelineLayout shares them instead)
+	VkPipelineLayout CreatePipelineLayout(GraphicsDevice& GFXDevice, const PipelineLayoutDesc& LayoutDesc);
+
+	//Create the VkPipeline, Specialization (when given) applies to both stages, DriverCache lets the driver reuse compiled stages
+	PipelineData CreatePipeline(GraphicsDevice& GFXDevice, VkRenderPass& RenderPass, VkShaderModule& VertexShader, VkShaderModule& FragmentShader, VkExtent2D& Extent,
+		VkPipelineLayout Layout, const VertexInputLayout& VertexInput, const VkSpecializationInfo* Specialization = nullptr,
+		VkPipelineCache DriverCache = VK_NULL_HANDLE, const bool bDepthTest = false);
+
+	//Create a compute VkPipeline, entry point "main"
+	PipelineData CreateComputePipeline(GraphicsDevice& GFXDevice, VkShaderModule& ComputeShader, VkPipelineLayout Layout);
+
+	//Creates a descriptor set layout from its bindings
+	//BindingFlags is either empty or holds one entry per binding (requires descriptor indexing)
+	VkDescriptorSetLayout CreateDescriptorSetLayout(GraphicsDevice& GFXDevice, const std::vector<VkDescriptorSetLayoutBinding>& Bindings,
+		const VkDescriptorSetLayoutCreateFlags Flags = 0, const std::vector<VkDescriptorBindingFlags>& BindingFlags = std::vector<VkDescriptorBindingFlags>());
+
+	//Creates a descriptor pool that can hold MaxSets sets drawn from PoolSizes
+	VkDescriptorPool CreateDescriptorPool(GraphicsDevice& GFXDevice, const std::vector<VkDescriptorPoolSize>& PoolSizes, const uint32_t MaxSets,
+		const VkDescriptorPoolCreateFlags Flags = 0);
+
+	//Allocates a single descriptor set from Pool
+	VkDescriptorSet AllocateDescriptorSet(GraphicsDevice& GFXDevice, VkDescriptorPool Pool, VkDescriptorSetLayout Layout);
 
 	struct MemoryTypeInfo
 	{
@@ -85,18 +162,27 @@ namespace VulkanCore
 	//GPU Memory Alloc helper
 	VkDeviceMemory AllocateMemory(VkDevice Device, std::vector<MemoryTypeInfo>& MemoryInfos, const int Size);
 
+	//GPU Memory Alloc helper that respects the resource's allowed memory types
+	//Device local memory for GPU only resources, host visible (preferably coherent) otherwise
+	VkDeviceMemory AllocateMemory(VkDevice Device, std::vector<MemoryTypeInfo>& MemoryInfos, const VkMemoryRequirements& Requirements, const bool bDeviceLocal);
+
 	//GPU Buffer alloc helper
 	VkBuffer AllocateBuffer(VkDevice Device, const int Size, const VkBufferUsageFlagBits UsageFlags);
 
 	struct TestMesh
 	{
-		VkBuffer VertexBuffer;
-		VkBuffer IndexBuffer;
-		VkDeviceMemory DeviceMemory;
+		//Range of the shared geometry buffer holding the mesh
+		GeometryAllocation Geometry;
+
+		//The index range holds every LOD level back to back, each in meshlet order so clusters can be drawn on their own
+		MeshLODChain LODs;
 	};
 
-	//Creates some testing Mesh buffers
-	TestMesh CreateMeshBuffers(GraphicsDevice& GFXDevice, VkCommandBuffer UploadCommandBuffer);
+	//Vertex layout of the test mesh: position, uv
+	static const uint32_t TestMeshVertexStride = 5 * sizeof(float);
+
+	//Creates a testing Mesh inside Geometry, whose stride must be TestMeshVertexStride
+	TestMesh CreateMeshBuffers(GeometryBuffer& Geometry);
 
 	template <typename T>
 	T RoundToNextMultiple(const T a, const T multiple)
@@ -0,0 +1,308 @@
+#include "VulkanTextures.h"
+#include "VulkanInitializers.h"
+#include <iostream>
+#include <cstring>
+#include <algorithm>
+#include <functional>
+
+namespace VulkanCore
+{
+	uint32_t CalculateMipLevels(const uint32_t Width, const uint32_t Height)
+	{
+		uint32_t Levels = 1;
+		uint32_t Size = std::max(Width, Height);
+		while (Size > 1)
+		{
+			Size >>= 1;
+			++Levels;
+		}
+		return Levels;
+	}
+
+	StagingBuffer CreateStagingBuffer(GraphicsDevice& GFXDevice, const void* Data, const VkDeviceSize Size)
+	{
+		StagingBuffer RetVal;
+		RetVal.Size = Size;
+
+		std::vector<MemoryTypeInfo> MemoryHeaps = EnumerateHeaps(GFXDevice.PhysicalDevice);
+
+		RetVal.Buffer = AllocateBuffer(GFXDevice.Device, static_cast<int> (Size), VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+
+		VkMemoryRequirements MemoryRequirements = {};
+		vkGetBufferMemoryRequirements(GFXDevice.Device, RetVal.Buffer, &MemoryRequirements);
+		RetVal.DeviceMemory = AllocateMemory(GFXDevice.Device, MemoryHeaps, MemoryRequirements, false);
+
+		VkResult R = vkBindBufferMemory(GFXDevice.Device, RetVal.Buffer, RetVal.DeviceMemory, 0);
+		if (R != VK_SUCCESS)
+		{
+			std::cout << "Staging buffer memory bind failed with error: " << R << std::endl;
+		}
+
+		void* Mapping = nullptr;
+		vkMapMemory(GFXDevice.Device, RetVal.DeviceMemory, 0, VK_WHOLE_SIZE, 0, &Mapping);
+		::memcpy(Mapping, Data, static_cast<size_t> (Size));
+		vkUnmapMemory(GFXDevice.Device, RetVal.DeviceMemory);
+
+		return RetVal;
+	}
+
+	void DestroyStagingBuffer(GraphicsDevice& GFXDevice, StagingBuffer& Staging)
+	{
+		vkDestroyBuffer(GFXDevice.Device, Staging.Buffer, nullptr);
+		vkFreeMemory(GFXDevice.Device, Staging.DeviceMemory, nullptr);
+		Staging = StagingBuffer();
+	}
+
+	Texture CreateImage(GraphicsDevice& GFXDevice, const uint32_t Width, const uint32_t Height, const uint32_t MipLevels, const VkFormat Format, const VkImageUsageFlags Usage)
+	{
+		Texture RetVal;
+		RetVal.Width = Width;
+		RetVal.Height = Height;
+		RetVal.MipLevels = MipLevels;
+		RetVal.Format = Format;
+
+		VkImageCreateInfo ImageCreateInfo = {};
+		ImageCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+		ImageCreateInfo.imageType = VK_IMAGE_TYPE_2D;
+		ImageCreateInfo.format = Format;
+		ImageCreateInfo.extent.width = Width;
+		ImageCreateInfo.extent.height = Height;
+		ImageCreateInfo.extent.depth = 1;
+		ImageCreateInfo.mipLevels = MipLevels;
+		ImageCreateInfo.arrayLayers = 1;
+		ImageCreateInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+		ImageCreateInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+		ImageCreateInfo.usage = Usage;
+		ImageCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		ImageCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+		VkResult R = vkCreateImage(GFXDevice.Device, &ImageCreateInfo, nullptr, &RetVal.Image);
+		if (R != VK_SUCCESS)
+		{
+			std::cout << "Image creation failed with error: " << R << std::endl;
+			return RetVal;
+		}
+
+		std::vector<MemoryTypeInfo> MemoryHeaps = EnumerateHeaps(GFXDevice.PhysicalDevice);
+		VkMemoryRequirements MemoryRequirements = {};
+		vkGetImageMemoryRequirements(GFXDevice.Device, RetVal.Image, &MemoryRequirements);
+		RetVal.DeviceMemory = AllocateMemory(GFXDevice.Device, MemoryHeaps, MemoryRequirements, true);
+
+		R = vkBindImageMemory(GFXDevice.Device, RetVal.Image, RetVal.DeviceMemory, 0);
+		if (R != VK_SUCCESS)
+		{
+			std::cout << "Image memory bind failed with error: " << R << std::endl;
+		}
+
+		VkImageViewCreateInfo ImageViewCreateInfo = {};
+		ImageViewCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+		ImageViewCreateInfo.image = RetVal.Image;
+		ImageViewCreateInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+		ImageViewCreateInfo.format = Format;
+		ImageViewCreateInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		ImageViewCreateInfo.subresourceRange.levelCount = MipLevels;
+		ImageViewCreateInfo.subresourceRange.layerCount = 1;
+
+		R = vkCreateImageView(GFXDevice.Device, &ImageViewCreateInfo, nullptr, &RetVal.View);
+		if (R == VK_SUCCESS)
+		{
+			std::cout << "Image created successfully (" << Width << "x" << Height << ", " << MipLevels << " mips)" << std::endl;
+		}
+		else
+		{
+			std::cout << "Image view creation failed with error: " << R << std::endl;
+		}
+
+		return RetVal;
+	}
+
+	void CmdTransitionImageLayout(VkCommandBuffer CommandBuffer, VkImage Image, const uint32_t BaseMip, const uint32_t MipCount,
+		const VkImageLayout OldLayout, const VkImageLayout NewLayout)
+	{
+		VkImageMemoryBarrier Barrier = {};
+		Barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		Barrier.oldLayout = OldLayout;
+		Barrier.newLayout = NewLayout;
+		Barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		Barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		Barrier.image = Image;
+		Barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		Barrier.subresourceRange.baseMipLevel = BaseMip;
+		Barrier.subresourceRange.levelCount = MipCount;
+		Barrier.subresourceRange.layerCount = 1;
+
+		VkPipelineStageFlags SrcStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+		VkPipelineStageFlags DstStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+
+		//Source: what has to finish before the transition
+		switch (OldLayout)
+		{
+		case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
+			Barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+			SrcStage = VK_PIPELINE_STAGE_TRANSFER_BIT; break;
+		case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL:
+			Barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+			SrcStage = VK_PIPELINE_STAGE_TRANSFER_BIT; break;
+		case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
+			Barrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+			SrcStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT; break;
+		default:
+			break;
+		}
+
+		//Destination: what waits on the transition
+		switch (NewLayout)
+		{
+		case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
+			Barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+			DstStage = VK_PIPELINE_STAGE_TRANSFER_BIT; break;
+		case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL:
+			Barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+			DstStage = VK_PIPELINE_STAGE_TRANSFER_BIT; break;
+		case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
+			Barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+			DstStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT; break;
+		default:
+			DstStage = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT; break;
+		}
+
+		vkCmdPipelineBarrier(CommandBuffer, SrcStage, DstStage, 0, 0, nullptr, 0, nullptr, 1, &Barrier);
+	}
+
+	bool CanGenerateMips(GraphicsDevice& GFXDevice, const VkFormat Format)
+	{
+		VkFormatProperties FormatProperties = {};
+		vkGetPhysicalDeviceFormatProperties(GFXDevice.PhysicalDevice, Format, &FormatProperties);
+		const VkFormatFeatureFlags BlitFeatures = VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT | VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
+		return (FormatProperties.optimalTilingFeatures & BlitFeatures) == BlitFeatures;
+	}
+
+	void CmdGenerateMips(VkCommandBuffer CommandBuffer, VkImage Image, const uint32_t Width, const uint32_t Height, const uint32_t FirstMip, const uint32_t EndMip)
+	{
+		for (uint32_t Mip = std::max(FirstMip, 1u); Mip < EndMip; ++Mip)
+		{
+			//Previous level becomes the blit source, its transition also waits for it to be written
+			CmdTransitionImageLayout(CommandBuffer, Image, Mip - 1, 1, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+
+			VkImageBlit Blit = {};
+			Blit.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+			Blit.srcSubresource.mipLevel = Mip - 1;
+			Blit.srcSubresource.layerCount = 1;
+			Blit.srcOffsets[1].x = static_cast<int32_t> (std::max(Width >> (Mip - 1), 1u));
+			Blit.srcOffsets[1].y = static_cast<int32_t> (std::max(Height >> (Mip - 1), 1u));
+			Blit.srcOffsets[1].z = 1;
+
+			Blit.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+			Blit.dstSubresource.mipLevel = Mip;
+			Blit.dstSubresource.layerCount = 1;
+			Blit.dstOffsets[1].x = static_cast<int32_t> (std::max(Width >> Mip, 1u));
+			Blit.dstOffsets[1].y = static_cast<int32_t> (std::max(Height >> Mip, 1u));
+			Blit.dstOffsets[1].z = 1;
+
+			vkCmdBlitImage(CommandBuffer, Image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &Blit, VK_FILTER_LINEAR);
+
+			//Done reading the previous level
+			CmdTransitionImageLayout(CommandBuffer, Image, Mip - 1, 1, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+		}
+	}
+
+	void DestroyTexture(GraphicsDevice& GFXDevice, Texture& Tex)
+	{
+		vkDestroyImageView(GFXDevice.Device, Tex.View, nullptr);
+		vkDestroyImage(GFXDevice.Device, Tex.Image, nullptr);
+		vkFreeMemory(GFXDevice.Device, Tex.DeviceMemory, nullptr);
+		Tex = Texture();
+	}
+
+	bool SamplerKey::operator==(const SamplerKey& Other) const
+	{
+		return MagFilter == Other.MagFilter && MinFilter == Other.MinFilter && MipmapMode == Other.MipmapMode &&
+			AddressModeU == Other.AddressModeU && AddressModeV == Other.AddressModeV && AddressModeW == Other.AddressModeW &&
+			MipLodBias == Other.MipLodBias && AnisotropyEnable == Other.AnisotropyEnable && MaxAnisotropy == Other.MaxAnisotropy &&
+			CompareEnable == Other.CompareEnable && CompareOp == Other.CompareOp && MinLod == Other.MinLod && MaxLod == Other.MaxLod &&
+			BorderColor == Other.BorderColor && UnnormalizedCoordinates == Other.UnnormalizedCoordinates;
+	}
+
+	size_t SamplerKeyHash::operator()(const SamplerKey& Key) const
+	{
+		size_t Hash = 0;
+		auto Combine = [&Hash](size_t Value) { Hash ^= Value + 0x9e3779b9 + (Hash << 6) + (Hash >> 2); };
+
+		Combine(std::hash<uint32_t>()(Key.MagFilter | (Key.MinFilter << 4) | (Key.MipmapMode << 8) | (Key.CompareOp << 12) | (Key.BorderColor << 16)));
+		Combine(std::hash<uint32_t>()(Key.AddressModeU | (Key.AddressModeV << 4) | (Key.AddressModeW << 8) |
+			(Key.AnisotropyEnable << 12) | (Key.CompareEnable << 13) | (Key.UnnormalizedCoordinates << 14)));
+		Combine(std::hash<float>()(Key.MipLodBias));
+		Combine(std::hash<float>()(Key.MaxAnisotropy));
+		Combine(std::hash<float>()(Key.MinLod));
+		Combine(std::hash<float>()(Key.MaxLod));
+
+		return Hash;
+	}
+
+	VkSampler GetSampler(GraphicsDevice& GFXDevice, SamplerCache& Cache, const VkSamplerCreateInfo& CreateInfo)
+	{
+		SamplerKey Key;
+		Key.MagFilter = CreateInfo.magFilter;
+		Key.MinFilter = CreateInfo.minFilter;
+		Key.MipmapMode = CreateInfo.mipmapMode;
+		Key.AddressModeU = CreateInfo.addressModeU;
+		Key.AddressModeV = CreateInfo.addressModeV;
+		Key.AddressModeW = CreateInfo.addressModeW;
+		Key.MipLodBias = CreateInfo.mipLodBias;
+		Key.AnisotropyEnable = CreateInfo.anisotropyEnable;
+		Key.MaxAnisotropy = CreateInfo.anisotropyEnable ? CreateInfo.maxAnisotropy : 1.0f;
+		Key.CompareEnable = CreateInfo.compareEnable;
+		Key.CompareOp = CreateInfo.compareEnable ? CreateInfo.compareOp : VK_COMPARE_OP_NEVER;
+		Key.MinLod = CreateInfo.minLod;
+		Key.MaxLod = CreateInfo.maxLod;
+		Key.BorderColor = CreateInfo.borderColor;
+		Key.UnnormalizedCoordinates = CreateInfo.unnormalizedCoordinates;
+
+		auto Found = Cache.Samplers.find(Key);
+		if (Found != Cache.Samplers.end())
+		{
+			return Found->second;
+		}
+
+		VkSampler Sampler = VK_NULL_HANDLE;
+		VkResult R = vkCreateSampler(GFXDevice.Device, &CreateInfo, nullptr, &Sampler);
+		if (R == VK_SUCCESS)
+		{
+			std::cout << "Sampler created successfully (" << Cache.Samplers.size() + 1 << " cached)" << std::endl;
+			Cache.Samplers[Key] = Sampler;
+		}
+		else
+		{
+			std::cout << "Sampler creation failed with error: " << R << std::endl;
+		}
+
+		return Sampler;
+	}
+
+	VkSamplerCreateInfo DefaultSamplerCreateInfo()
+	{
+		VkSamplerCreateInfo SamplerCreateInfo = {};
+		SamplerCreateInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+		SamplerCreateInfo.magFilter = VK_FILTER_LINEAR;
+		SamplerCreateInfo.minFilter = VK_FILTER_LINEAR;
+		SamplerCreateInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+		SamplerCreateInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+		SamplerCreateInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+		SamplerCreateInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+		SamplerCreateInfo.maxAnisotropy = 1.0f;
+		SamplerCreateInfo.compareOp = VK_COMPARE_OP_NEVER;
+		SamplerCreateInfo.minLod = 0.0f;
+		SamplerCreateInfo.maxLod = VK_LOD_CLAMP_NONE;
+		SamplerCreateInfo.borderColor = VK_BORDER_COLOR_FLOAT_OPAQUE_BLACK;
+		return SamplerCreateInfo;
+	}
+
+	void DestroySamplerCache(GraphicsDevice& GFXDevice, SamplerCache& Cache)
+	{
+		for (auto& Entry : Cache.Samplers)
+		{
+			vkDestroySampler(GFXDevice.Device, Entry.second, nullptr);
+		}
+		Cache.Samplers.clear();
+	}
+}
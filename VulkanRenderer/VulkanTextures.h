@@ -0,0 +1,95 @@
+#pragma once
+
+#include "vulkan\vulkan.h"
+#include <vector>
+#include <unordered_map>
+
+namespace VulkanCore
+{
+	struct GraphicsDevice;
+
+	//A sampled 2D image living in device local memory
+	struct Texture
+	{
+		VkImage Image = VK_NULL_HANDLE;
+		VkImageView View = VK_NULL_HANDLE;
+		VkDeviceMemory DeviceMemory = VK_NULL_HANDLE;
+		VkFormat Format = VK_FORMAT_UNDEFINED;
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		uint32_t MipLevels = 1;
+	};
+
+	//Host visible copy source, must outlive the upload command buffer's execution
+	struct StagingBuffer
+	{
+		VkBuffer Buffer = VK_NULL_HANDLE;
+		VkDeviceMemory DeviceMemory = VK_NULL_HANDLE;
+		VkDeviceSize Size = 0;
+	};
+
+	//Number of mips in a full chain down to 1x1
+	uint32_t CalculateMipLevels(const uint32_t Width, const uint32_t Height);
+
+	//Creates a mapped staging buffer and copies Data into it
+	StagingBuffer CreateStagingBuffer(GraphicsDevice& GFXDevice, const void* Data, const VkDeviceSize Size);
+
+	void DestroyStagingBuffer(GraphicsDevice& GFXDevice, StagingBuffer& Staging);
+
+	//Creates an optimal tiling image + view in device local memory, contents undefined
+	Texture CreateImage(GraphicsDevice& GFXDevice, const uint32_t Width, const uint32_t Height, const uint32_t MipLevels, const VkFormat Format, const VkImageUsageFlags Usage);
+
+	//Records a layout transition for a mip range of a color image
+	void CmdTransitionImageLayout(VkCommandBuffer CommandBuffer, VkImage Image, const uint32_t BaseMip, const uint32_t MipCount,
+		const VkImageLayout OldLayout, const VkImageLayout NewLayout);
+
+	//True when optimal tiling images of Format can be linearly blitted, which CmdGenerateMips needs
+	bool CanGenerateMips(GraphicsDevice& GFXDevice, const VkFormat Format);
+
+	//Records blits filling mips [FirstMip, EndMip) of Image, each from the level above it, Width / Height are mip 0's
+	//Levels [FirstMip - 1, EndMip) must be in TRANSFER_DST_OPTIMAL and are left in it, needs a graphics queue
+	void CmdGenerateMips(VkCommandBuffer CommandBuffer, VkImage Image, const uint32_t Width, const uint32_t Height, const uint32_t FirstMip, const uint32_t EndMip);
+
+	void DestroyTexture(GraphicsDevice& GFXDevice, Texture& Tex);
+
+	//The parts of VkSamplerCreateInfo that identify a sampler
+	struct SamplerKey
+	{
+		VkFilter MagFilter;
+		VkFilter MinFilter;
+		VkSamplerMipmapMode MipmapMode;
+		VkSamplerAddressMode AddressModeU;
+		VkSamplerAddressMode AddressModeV;
+		VkSamplerAddressMode AddressModeW;
+		float MipLodBias;
+		VkBool32 AnisotropyEnable;
+		float MaxAnisotropy;
+		VkBool32 CompareEnable;
+		VkCompareOp CompareOp;
+		float MinLod;
+		float MaxLod;
+		VkBorderColor BorderColor;
+		VkBool32 UnnormalizedCoordinates;
+
+		bool operator==(const SamplerKey& Other) const;
+	};
+
+	struct SamplerKeyHash
+	{
+		size_t operator()(const SamplerKey& Key) const;
+	};
+
+	//Deduplicates VkSamplers, identical create infos share one sampler
+	struct SamplerCache
+	{
+		std::unordered_map<SamplerKey, VkSampler, SamplerKeyHash> Samplers;
+	};
+
+	//Returns the cached sampler for CreateInfo, creating it on first use
+	VkSampler GetSampler(GraphicsDevice& GFXDevice, SamplerCache& Cache, const VkSamplerCreateInfo& CreateInfo);
+
+	//Trilinear, repeat addressing over the full mip chain
+	VkSamplerCreateInfo DefaultSamplerCreateInfo();
+
+	void DestroySamplerCache(GraphicsDevice& GFXDevice, SamplerCache& Cache);
+}
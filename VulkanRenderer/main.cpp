@@ -7,10 +7,35 @@
 #include "vulkan\vulkan.h"
 #include "GLFW\glfw3.h"
 #include "VulkanInitializers.h"
+#include "MeshLOD.h"
+#include "VulkanTextures.h"
+#include "TextureLoader.h"
+#include "TextureStreaming.h"
+#include "Descriptors.h"
+#include "Bindless.h"
+#include "UniformAllocator.h"
+#include "UploadScheduler.h"
+#include "AsyncCompute.h"
+#include "Particles.h"
+#include "Sync.h"
+#include "RenderGraph.h"
+#include "JobSystem.h"
+#include "VectorMath.h"
+#include "Scene.h"
+#include "DrawQueue.h"
+#include "DeletionQueue.h"
+#include "ResourceRegistry.h"
+#include "ShaderCache.h"
+#include "SpirvReflection.h"
+#include "PipelineCache.h"
 #include "BasicShaders.h"
 
 #include <iostream>
 #include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <cstddef>
 using namespace std;
 
 static void error_callback(int error, const char* description)
@@ -18,10 +43,15 @@ static void error_callback(int error, const char* description)
 	fprintf(stderr, "Error: %s\n", description);
 }
 
+//U toggles between the textured mesh and its UVs, two permutations of the same shaders
+static bool bShowUVs = false;
+
 static void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods)
 {
 	if (key == GLFW_KEY_ESCAPE && action == GLFW_PRESS)
 		glfwSetWindowShouldClose(window, GLFW_TRUE);
+	if (key == GLFW_KEY_U && action == GLFW_PRESS)
+		bShowUVs = !bShowUVs;
 }
 
 void window_size_callback(GLFWwindow* window, int width, int height)
@@ -29,8 +59,23 @@ void window_size_callback(GLFWwindow* window, int width, int height)
 
 }
 
-int main(void)
+int main(int argc, char** argv)
 {
+	//-jobbench measures job system scaling, -mathbench SIMD math against scalar code, both exit without opening a window
+	for (int i = 1; i < argc; ++i)
+	{
+		if (strcmp(argv[i], "-jobbench") == 0)
+		{
+			VulkanCore::RunJobSystemBenchmark();
+			exit(EXIT_SUCCESS);
+		}
+		if (strcmp(argv[i], "-mathbench") == 0)
+		{
+			VulkanCore::RunMathBenchmark();
+			exit(EXIT_SUCCESS);
+		}
+	}
+
 	GLFWwindow* window;
 	glfwSetErrorCallback(error_callback);
 	if (!glfwInit())
@@ -60,13 +105,18 @@ int main(void)
 	//Vulkan initial setup
 	VkInstance Instance = VulkanCore::CreateInstance();
 	VulkanCore::GraphicsDevice GFXDevice = VulkanCore::CreateDevice(Instance);
+
+	//One worker per remaining hardware thread (at least one, setup blocks on futures without running jobs), the main thread helps when it waits on a counter
+	VulkanCore::JobSystem Jobs = VulkanCore::CreateJobSystem(std::max(std::thread::hardware_concurrency(), 2u) - 1, true);
+
+	//Read (and transcode if the format isn't supported) on a worker while the rest of setup runs
+	std::future<VulkanCore::TextureFileData> PendingMeshTexture = VulkanCore::LoadTextureFileAsync(Jobs, GFXDevice, "Textures/MeshTexture.ktx2");
+
 	VkSurfaceKHR Surface = VulkanCore::CreateGLFWSurface(Instance, window);
 	const int BackBufferCount(2);
 	VulkanCore::SwapchainData SwapchainData = VulkanCore::CreateSwapchain(GFXDevice, Surface, BackBufferCount, Width, Height);
 	vector<VkImage> SwapchainImages = VulkanCore::GetSwapchainImages(GFXDevice, SwapchainData.Swapchain);
 	vector<VkImageView> SwapchainImageViews = VulkanCore::CreateSwapchainImageViews(GFXDevice, SwapchainData.Format, SwapchainImages);
-	VkRenderPass RenderPass = VulkanCore::CreateForwardRenderpass(GFXDevice, SwapchainData.Format);
-	vector<VkFramebuffer> Framebuffers = VulkanCore::CreateFrameBuffers(GFXDevice, RenderPass, SwapchainImageViews, Width, Height);
 	VkCommandPool CommandPool = VulkanCore::CreateCommandPool(GFXDevice);
 
 	//Create our setup and queue command buffers
@@ -76,40 +126,320 @@ int main(void)
 	VkCommandBuffer SetupCommandBuffer = CommandBuffers[BackBufferCount];
 	vector<VkCommandBuffer> FrameCommandBuffers(CommandBuffers.begin(), CommandBuffers.end() - 1);
 
-	//Frame Fences
-	vector<VkFence> FrameFences;
-	for (int i = 0; i < BackBufferCount; ++i)
-	{
-		FrameFences.push_back(VulkanCore::CreateFence(GFXDevice, true));
-	}
+	//Graphics queue timeline, FrameValues holds what each back buffer's last frame signals
+	VulkanCore::QueueTimeline GraphicsTimeline = VulkanCore::CreateQueueTimeline(GFXDevice, GFXDevice.GraphicsQueue);
+	vector<uint64_t> FrameValues(BackBufferCount, 0);
+
+	//Anything released from here on is destroyed once the graphics timeline passes the frame that last used it
+	VulkanCore::DeletionQueue Deletions = VulkanCore::CreateDeletionQueue(GraphicsTimeline);
+
+	//Owns the pipelines, textures and buffers below, everything else refers to them by handle
+	VulkanCore::ResourceRegistry Resources;
 
 	//Pre-Render setup
-	vkResetFences(GFXDevice.Device, 1, &FrameFences[0]);
 	//Begin a command buffer, record setup steps, End the buffer, and submit it to the queue
 
 	VkCommandBufferBeginInfo BeginInfo = {};
 	BeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
 	vkBeginCommandBuffer(SetupCommandBuffer, &BeginInfo);
 
-	VkShaderModule VertexShader = VulkanCore::LoadShader(GFXDevice, BasicVertexShader, sizeof(BasicVertexShader));
-	VkShaderModule FragmentShader = VulkanCore::LoadShader(GFXDevice, BasicFragmentShader, sizeof(BasicFragmentShader));
+	//With descriptor indexing every texture lives in one global set indexed by push constants,
+	//otherwise a set holding just the mesh texture is written and bound per draw
+	const bool bBindless = GFXDevice.bSupportsDescriptorIndexing;
+
 	VkExtent2D ScreenExtent = {};
 	ScreenExtent.height = Height;
 	ScreenExtent.width = Width;
 
-	VkPipeline Pipeline = VulkanCore::CreatePipeline(GFXDevice, RenderPass, VertexShader, FragmentShader, ScreenExtent);
-	VulkanCore::TestMesh Mesh = VulkanCore::CreateMeshBuffers(GFXDevice, SetupCommandBuffer);
+	VulkanCore::DescriptorLayoutCache LayoutCache;
+
+	//Per-draw data too big for push constants is bump allocated from this frame's slice of one mapped buffer and bound by dynamic offset
+	struct DrawUniforms
+	{
+		VulkanCore::Mat4 Transform;
+	};
+	VulkanCore::UniformAllocator Uniforms;
+
+	VulkanCore::BindlessTable Bindless;
+	if (bBindless)
+	{
+		VulkanCore::BindlessConfig BindlessTableConfig;
+		BindlessTableConfig.FramesInFlight = BackBufferCount;
+		Bindless = VulkanCore::CreateBindlessTable(GFXDevice, LayoutCache, BindlessTableConfig);
+	}
+
+	//The transform follows the material slots (16 byte aligned for the matrix), falling back to uniform set 1 when push constants are too small
+	//This only picks the path (and so the vertex shader), the pipeline layout is reflected from the shaders below
+	static const uint32_t TransformPushOffset = 16;
+	VulkanCore::PipelineLayoutDesc DrawDataLayout;
+	VulkanCore::DrawDataPath TransformPath = VulkanCore::DeclareDrawData(GFXDevice, DrawDataLayout, VK_SHADER_STAGE_VERTEX_BIT,
+		TransformPushOffset, sizeof(DrawUniforms), 1);
+	if (!TransformPath.bPushConstants)
+	{
+		Uniforms = VulkanCore::CreateUniformAllocator(GFXDevice, Resources, LayoutCache, BackBufferCount, 64 * 1024, sizeof(DrawUniforms), VK_SHADER_STAGE_VERTEX_BIT);
+	}
+
+	//Shaders are mapped from the .spv files in Shaders/, which the build copies next to the executable
+	//The compiled-in copies hold the same SPIR-V and stand in when a file is missing
+	//The cache owns the modules and creates each distinct SPIR-V blob once
+	VulkanCore::ShaderModuleCache Shaders;
+	VkShaderModule VertexShader = TransformPath.bPushConstants
+		? VulkanCore::LoadShaderFile(GFXDevice, Shaders, "Shaders/PushTransform.vert.spv", PushTransformVertexShader, sizeof(PushTransformVertexShader))
+		: VulkanCore::LoadShaderFile(GFXDevice, Shaders, "Shaders/Transform.vert.spv", TransformVertexShader, sizeof(TransformVertexShader));
+	VkShaderModule FragmentShader = bBindless
+		? VulkanCore::LoadShaderFile(GFXDevice, Shaders, "Shaders/Bindless.frag.spv", BindlessFragmentShader, sizeof(BindlessFragmentShader))
+		: VulkanCore::LoadShaderFile(GFXDevice, Shaders, "Shaders/Material.frag.spv", MaterialFragmentShader, sizeof(MaterialFragmentShader));
+
+	//Vertex attributes, set layouts and push constant ranges come from the shaders themselves, merged across both stages
+	//The bindless table and the dynamic uniform set are laid out by their owners, the shaders can't express either
+	const VulkanCore::CachedShaderModule* VertexCode = VulkanCore::FindCachedShader(Shaders, VertexShader);
+	const VulkanCore::CachedShaderModule* FragmentCode = VulkanCore::FindCachedShader(Shaders, FragmentShader);
+	const VulkanCore::ShaderReflection VertexReflection = VulkanCore::ReflectSpirv(VertexCode->Code, VertexCode->WordCount);
+	const VulkanCore::ShaderReflection FragmentReflection = VulkanCore::ReflectSpirv(FragmentCode->Code, FragmentCode->WordCount);
+	vector<VkDescriptorSetLayout> SetOverrides(1, bBindless ? Bindless.Layout : VK_NULL_HANDLE);
+	if (!TransformPath.bPushConstants)
+	{
+		SetOverrides.resize(TransformPath.UniformSetIndex + 1, VK_NULL_HANDLE);
+		SetOverrides[TransformPath.UniformSetIndex] = Uniforms.Layout;
+	}
+	VulkanCore::PipelineLayoutDesc PipelineLayout = VulkanCore::BuildReflectedLayout(GFXDevice, LayoutCache, { &VertexReflection, &FragmentReflection }, SetOverrides);
+	const VulkanCore::VertexInputLayout VertexInput = VulkanCore::BuildVertexInputLayout(VertexReflection);
+
+	//Set 0 of the material fragment shader (its image, sampler and texture feedback region), written per draw
+	VkDescriptorSetLayout TextureSetLayout = bBindless ? VK_NULL_HANDLE : PipelineLayout.SetLayouts[0];
+
+	//Every mesh is a range of one shared vertex and index buffer, draws never rebind buffers
+	VulkanCore::GeometryBuffer Geometry = VulkanCore::CreateGeometryBuffer(GFXDevice, Resources, VulkanCore::TestMeshVertexStride, 1 << 20, 4 << 20);
+	VulkanCore::TestMesh Mesh = VulkanCore::CreateMeshBuffers(Geometry);
+
+	//Textures start with only their low mips resident, the setup command buffer uploads those
+	//Falls back to a generated checkerboard when the texture file is missing or unsupported
+	VulkanCore::StreamingConfig TextureStreamingConfig;
+	TextureStreamingConfig.FramesInFlight = BackBufferCount;
+
+	//With a dedicated transfer family, mip upgrades are copied there while the graphics queue keeps rendering
+	const bool bAsyncUploads = GFXDevice.bHasTransferQueue;
+	VulkanCore::UploadScheduler Uploads;
+	if (bAsyncUploads)
+	{
+		Uploads = VulkanCore::CreateUploadScheduler(GFXDevice, 4, BackBufferCount);
+	}
+	VulkanCore::TextureStreamer Streamer = VulkanCore::CreateTextureStreamer(GFXDevice, TextureStreamingConfig, 16, Resources, Deletions, bAsyncUploads ? &Uploads : nullptr);
+
+	VulkanCore::TextureFileData MeshTextureData;
+	try
+	{
+		MeshTextureData = PendingMeshTexture.get();
+	}
+	catch (const std::exception& Exception)
+	{
+		std::cout << "Mesh texture load failed with exception: " << Exception.what() << std::endl;
+	}
+	catch (...)
+	{
+		std::cout << "Mesh texture load failed with an unknown exception" << std::endl;
+	}
+	if (MeshTextureData.Format == VK_FORMAT_UNDEFINED)
+	{
+		MeshTextureData = VulkanCore::CreateTestTextureData(256);
+	}
+	const uint32_t MeshTextureIndex = VulkanCore::AddStreamedTexture(GFXDevice, Streamer, SetupCommandBuffer, std::move(MeshTextureData));
+	VulkanCore::SamplerCache Samplers;
+	VkSampler MeshSampler = VulkanCore::GetSampler(GFXDevice, Samplers, VulkanCore::DefaultSamplerCreateInfo());
+
+	//The mesh's material: slots into the bindless arrays, the texture slot follows the streamer's image replacements
+	//Both fragment shaders write the levels they sample to the texture's feedback slot
+	VulkanCore::BindlessDrawData MeshMaterial;
+	MeshMaterial.FeedbackSlot = MeshTextureIndex;
+	uint32_t MeshTextureVersion = 0;
+	vector<uint32_t> FeedbackBufferSlots;
+	if (bBindless)
+	{
+		MeshMaterial.SamplerIndex = VulkanCore::RegisterBindlessSampler(Bindless, MeshSampler);
+		MeshMaterial.TextureIndex = VulkanCore::RegisterBindlessTexture(Bindless, VulkanCore::GetImage(Resources, Streamer.Textures[MeshTextureIndex].Resident).Image.View, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+		MeshTextureVersion = Streamer.Textures[MeshTextureIndex].Version;
+
+		//Each back buffer's feedback region gets a storage buffer slot, the pushed one follows CurrentBackBuffer
+		for (uint32_t i = 0; i < BackBufferCount; ++i)
+		{
+			FeedbackBufferSlots.push_back(VulkanCore::RegisterBindlessStorageBuffer(Bindless, Streamer.Feedback.Buffer,
+				VulkanCore::GetTextureFeedbackOffset(Streamer, i), Streamer.Feedback.RegionRange));
+		}
+	}
 
 	vkEndCommandBuffer(SetupCommandBuffer);
-	VkSubmitInfo SubmitInfo = {};
-	SubmitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-	SubmitInfo.commandBufferCount = 1;
-	SubmitInfo.pCommandBuffers = &SetupCommandBuffer;
-	//The frame fence here will later be used for frames, but we can use it here initially
-	vkQueueSubmit(GFXDevice.GraphicsQueue, 1, &SubmitInfo, FrameFences[0]);
+	VulkanCore::TimelineSubmitInfo SetupSubmitInfo;
+	SetupSubmitInfo.CommandBuffers.push_back(SetupCommandBuffer);
+	const uint64_t SetupValue = VulkanCore::SubmitToTimeline(GFXDevice, GraphicsTimeline, SetupSubmitInfo);
 
 	//Ensure setup is done
-	vkWaitForFences(GFXDevice.Device, 1, &FrameFences[0], VK_TRUE, UINT64_MAX);
+	VulkanCore::WaitForTimeline(GFXDevice, GraphicsTimeline, SetupValue);
+
+	//Sets are allocated every frame from that frame's pools, which are reset wholesale once its timeline value has completed
+	//so the streamed texture's current image view is always picked up
+	VulkanCore::DescriptorAllocator Descriptors = VulkanCore::CreateDescriptorAllocator(GFXDevice, BackBufferCount);
+	VulkanCore::DescriptorWriter DescriptorWrites;
+
+	//One indirect buffer per back buffer so the CPU never overwrites commands still in flight
+	//Sized for the LOD level with the most meshlets
+	uint32_t MaxMeshlets = 0;
+	for (const auto& LOD : Mesh.LODs.Levels)
+	{
+		MaxMeshlets = std::max(MaxMeshlets, static_cast<uint32_t>(LOD.Meshlets.Meshlets.size()));
+	}
+
+	//Particle simulation runs on the async compute queue, timestamps on both queues measure how much it overlaps rendering
+	//The graphics queue consumes a sample of every step, read back into LastParticleStats
+	VulkanCore::AsyncComputeQueue Compute = VulkanCore::CreateAsyncComputeQueue(GFXDevice, BackBufferCount);
+	VulkanCore::ParticleSystem Particles = VulkanCore::CreateParticleSystem(GFXDevice, LayoutCache, Shaders, Compute, 64 * 1024, 256, BackBufferCount);
+	VulkanCore::ParticleStats LastParticleStats;
+	VulkanCore::GpuTimer GraphicsTimer = VulkanCore::CreateGpuTimer(GFXDevice, GFXDevice.GraphicsQueueIndex, BackBufferCount, 2);
+	vector<uint64_t> GraphicsTimestamps;
+	vector<uint64_t> ComputeTimestamps;
+	VulkanCore::QueueOverlap OverlapTotals;
+	uint32_t OverlapSamples = 0;
+	double LastFrameTime = glfwGetTime();
+
+	vector<VulkanCore::IndirectDrawBuffer> IndirectBuffers;
+	for (int i = 0; i < BackBufferCount; ++i)
+	{
+		IndirectBuffers.push_back(VulkanCore::CreateIndirectDrawBuffer(GFXDevice, Resources, MaxMeshlets));
+	}
+
+	//The mesh is authored in clip space, so the view projection is identity
+	//and the eye sits behind the near plane looking down +Z
+	const VulkanCore::Mat4 ViewProjection = VulkanCore::Mat4Identity();
+	static const float CameraPosition[3] = { 0.0f, 0.0f, -1.0f };
+	VulkanCore::Frustum ViewFrustum = VulkanCore::ExtractFrustumPlanes(ViewProjection);
+
+	//Every node draws the mesh, its render handle indexes what it draws with
+	VulkanCore::Scene World;
+	VulkanCore::SceneDrawList SceneDraws;
+	VulkanCore::AABB MeshBounds;
+	MeshBounds.Min = VulkanCore::MakeVec3(Mesh.LODs.Center[0] - Mesh.LODs.Radius, Mesh.LODs.Center[1] - Mesh.LODs.Radius, Mesh.LODs.Center[2] - Mesh.LODs.Radius);
+	MeshBounds.Max = VulkanCore::MakeVec3(Mesh.LODs.Center[0] + Mesh.LODs.Radius, Mesh.LODs.Center[1] + Mesh.LODs.Radius, Mesh.LODs.Center[2] + Mesh.LODs.Radius);
+
+	//The backdrop fills the screen behind everything and is drawn from its culled clusters,
+	//the cards in front of it draw their whole LOD level with one indexed draw each, alternating between the textured and UV permutations
+	struct SceneRenderable
+	{
+		bool bMeshletCulled = false;
+		VulkanCore::ShaderFeatures Features = VulkanCore::ShaderFeatureTextured;
+		uint32_t MeshId = 0;
+		uint32_t MaterialId = 0;
+		VulkanCore::LODSelection LOD;
+	};
+	vector<SceneRenderable> Renderables;
+	auto AddRenderable = [&](const VulkanCore::Vec3& Translation, const float NodeScale, const bool bMeshletCulled, const VulkanCore::ShaderFeatures Features)
+	{
+		SceneRenderable Renderable;
+		Renderable.bMeshletCulled = bMeshletCulled;
+		Renderable.Features = Features;
+		Renderables.push_back(Renderable);
+		VulkanCore::AddSceneNode(World, VulkanCore::SceneNone, Translation, VulkanCore::QuatIdentity(), VulkanCore::MakeVec3(NodeScale, NodeScale, NodeScale),
+			MeshBounds, static_cast<uint32_t> (Renderables.size() - 1));
+	};
+	AddRenderable(VulkanCore::MakeVec3(0.0f, 0.0f, 0.9f), 1.0f, true, VulkanCore::ShaderFeatureTextured);
+	for (uint32_t i = 0; i < 6; ++i)
+	{
+		const float X = -0.6f + 0.6f * (i % 3);
+		const float Y = i < 3 ? -0.5f : 0.5f;
+		AddRenderable(VulkanCore::MakeVec3(X, Y, 0.2f + 0.1f * i), 0.25f, false, i % 2 ? 0 : VulkanCore::ShaderFeatureTextured);
+	}
+
+	//Draws are queued each frame and recorded in sort key order, the totals report how many binds that saved
+	VulkanCore::DrawQueue Draws;
+	VulkanCore::DrawQueueStats DrawTotals;
+	uint32_t DrawFrames = 0;
+
+	//Clip space spans 2 units across the screen height, so that's our pixels per unit
+	const float LODProjectionScale = Height * 0.5f;
+
+	//The frame as a render graph: the forward pass draws the scene into transient color and depth targets, the present pass copies the color
+	//into the imported swapchain image, which the graph leaves in present layout
+	//Render passes, barriers, transitions, framebuffers (one imageless one, or one per image) and the transients' memory all come from the graph,
+	//the pipeline is built against the forward render pass. Surfaces that can't be copied to get the scene drawn straight into the back buffer
+	uint32_t CurrentBackBuffer = 0;
+	uint32_t DrawCount = 0;
+	VkDescriptorSet TextureSet = VK_NULL_HANDLE;
+	//The forward pipeline is held by handle, so a rebuilt one can be swapped in without touching the draws
+	VulkanCore::PipelineHandle ForwardPipeline;
+	VulkanCore::RenderPassCache RenderPasses = VulkanCore::CreateRenderPassCache(Deletions);
+	VulkanCore::RenderGraph FrameGraph;
+	const uint32_t BackBufferResource = VulkanCore::ImportGraphImage(FrameGraph, "BackBuffer", SwapchainData.Format, ScreenExtent,
+		VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, SwapchainData.Usage);
+	const bool bCopyToBackBuffer = (SwapchainData.Usage & VK_IMAGE_USAGE_TRANSFER_DST_BIT) != 0;
+	const uint32_t SceneColor = bCopyToBackBuffer ? VulkanCore::CreateGraphImage(FrameGraph, "SceneColor", SwapchainData.Format, ScreenExtent) : BackBufferResource;
+	const uint32_t SceneDepth = VulkanCore::CreateGraphImage(FrameGraph, "SceneDepth", VulkanCore::FindDepthFormat(GFXDevice), ScreenExtent);
+	const uint32_t ForwardPass = VulkanCore::AddGraphPass(FrameGraph, "Forward", [&](VkCommandBuffer CommandBuffer)
+	{
+		//Render Impl
+		const VulkanCore::PipelineData& Pipeline = VulkanCore::GetPipeline(Resources, ForwardPipeline);
+		if (bBindless)
+		{
+			//Bound once for the whole frame, each draw only pushes its material's slots
+			VulkanCore::CmdBindBindlessTable(CommandBuffer, Bindless, Pipeline.Layout, VK_PIPELINE_BIND_POINT_GRAPHICS);
+			vkCmdPushConstants(CommandBuffer, Pipeline.Layout, VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(MeshMaterial), &MeshMaterial);
+		}
+		else
+		{
+			//The material shader only reads the feedback slot, at the same offset
+			vkCmdPushConstants(CommandBuffer, Pipeline.Layout, VK_SHADER_STAGE_FRAGMENT_BIT, static_cast<uint32_t> (offsetof(VulkanCore::BindlessDrawData, FeedbackSlot)),
+				sizeof(MeshMaterial.FeedbackSlot), &MeshMaterial.FeedbackSlot);
+		}
+
+		//Pipeline, material set and buffers are bound by the queue, only when they differ from the previous draw
+		//Per-draw transforms are pushed straight into the command buffer, or one memcpy plus a dynamic offset bind on the fallback path
+		VulkanCore::CmdSubmitDrawQueue(GFXDevice, CommandBuffer, Draws, TransformPath, Uniforms);
+	});
+	VkClearColorValue ClearColor = { { 0.042f, 0.042f, 0.042f, 1.0f } };
+	VulkanCore::AddColorOutput(FrameGraph, ForwardPass, SceneColor, VK_ATTACHMENT_LOAD_OP_CLEAR, ClearColor);
+	VulkanCore::AddDepthOutput(FrameGraph, ForwardPass, SceneDepth, VK_ATTACHMENT_LOAD_OP_CLEAR, 1.0f);
+
+	//Same format and extent, so a plain copy (no blit format features needed)
+	if (bCopyToBackBuffer)
+	{
+		const uint32_t PresentPass = VulkanCore::AddGraphPass(FrameGraph, "Present", [&](VkCommandBuffer CommandBuffer)
+		{
+			VkImageCopy Region = {};
+			Region.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+			Region.srcSubresource.layerCount = 1;
+			Region.dstSubresource = Region.srcSubresource;
+			Region.extent.width = ScreenExtent.width;
+			Region.extent.height = ScreenExtent.height;
+			Region.extent.depth = 1;
+			vkCmdCopyImage(CommandBuffer, FrameGraph.Resources[SceneColor].Image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+				FrameGraph.Resources[BackBufferResource].Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &Region);
+		});
+		VulkanCore::ReadGraphResource(FrameGraph, PresentPass, SceneColor, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_READ_BIT,
+			VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+		VulkanCore::WriteGraphResource(FrameGraph, PresentPass, BackBufferResource, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+			VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+	}
+
+	VulkanCore::CompileRenderGraph(GFXDevice, FrameGraph, RenderPasses);
+	const VulkanCore::RenderGraphStats& GraphStats = FrameGraph.Stats;
+	std::cout << "Render graph: " << GraphStats.PassCount - GraphStats.CulledPasses << " of " << GraphStats.PassCount << " passes, "
+		<< GraphStats.BarrierBatches << " barrier batches (" << GraphStats.ImageBarriers << " image, " << GraphStats.BufferBarriers << " buffer), "
+		<< GraphStats.RenderPassTransitions << " render pass transitions, " << GraphStats.AllocatedBytes << " of " << GraphStats.TransientBytes
+		<< " transient bytes allocated after aliasing" << std::endl;
+
+	//Optional shader parts are specialization constants of one module, each feature combination is its own pipeline
+	//The permutations used at runtime are compiled up front on the job system, switching between them never waits on a compile
+	VulkanCore::PipelineCache Pipelines = VulkanCore::CreatePipelineCache(GFXDevice, LayoutCache);
+	VulkanCore::GraphicsPipelineKey ForwardKey;
+	ForwardKey.RenderPass = FrameGraph.Passes[ForwardPass].RenderPass;
+	ForwardKey.VertexShader = VertexShader;
+	ForwardKey.FragmentShader = FragmentShader;
+	ForwardKey.Extent = ScreenExtent;
+	ForwardKey.bDepthTest = true;
+	ForwardKey.Layout = PipelineLayout;
+	ForwardKey.VertexInput = VertexInput;
+	ForwardKey.DeclaredFeatures = VulkanCore::GetDeclaredFeatures(VertexReflection) | VulkanCore::GetDeclaredFeatures(FragmentReflection);
+	vector<VulkanCore::GraphicsPipelineKey> HotPipelines(2, ForwardKey);
+	HotPipelines[0].Features = VulkanCore::ShaderFeatureTextured;
+	HotPipelines[1].Features = 0;
+	VulkanCore::PrecompilePipelines(GFXDevice, Pipelines, Resources, Jobs, HotPipelines);
 
 	//Semaphore create info used twice below
 	//Signal: Rendering completed within queue submit (when queue finishes work)
@@ -129,61 +459,199 @@ int main(void)
 	vkCreateSemaphore(GFXDevice.Device, &SemaphoreCreateInfo,
 		nullptr, &RenderingCompleteSemaphore);
 
-	uint32_t CurrentBackBuffer = 0;
-
 	while (!glfwWindowShouldClose(window))
 	{
 		vkAcquireNextImageKHR(GFXDevice.Device, SwapchainData.Swapchain, UINT64_MAX, ImageAcquiredSemaphore, VK_NULL_HANDLE, &CurrentBackBuffer);
 
-		vkWaitForFences(GFXDevice.Device, 1, &FrameFences[CurrentBackBuffer], VK_TRUE, UINT64_MAX);
-		vkResetFences(GFXDevice.Device, 1, &FrameFences[CurrentBackBuffer]);
+		VulkanCore::WaitForTimeline(GFXDevice, GraphicsTimeline, FrameValues[CurrentBackBuffer]);
+		VulkanCore::FlushDeletionQueue(GFXDevice, Deletions);
+		VulkanCore::BeginRenderPassCacheFrame(RenderPasses);
+
+		//This slot's last frame has finished on both queues, its graphics half waited for the compute step it read back
+		if (VulkanCore::GetGpuTimestamps(GFXDevice, GraphicsTimer, CurrentBackBuffer, GraphicsTimestamps) &&
+			VulkanCore::GetGpuTimestamps(GFXDevice, Compute.Timer, CurrentBackBuffer, ComputeTimestamps))
+		{
+			VulkanCore::QueueOverlap Overlap = VulkanCore::MeasureQueueOverlap(GraphicsTimestamps[0], GraphicsTimestamps[1],
+				ComputeTimestamps[VulkanCore::AsyncComputeBeginQuery], ComputeTimestamps[VulkanCore::AsyncComputeEndQuery]);
+			OverlapTotals.GraphicsMs += Overlap.GraphicsMs;
+			OverlapTotals.ComputeMs += Overlap.ComputeMs;
+			OverlapTotals.OverlapMs += Overlap.OverlapMs;
+			++OverlapSamples;
+		}
+		VulkanCore::ReadParticleSnapshot(GFXDevice, Particles, CurrentBackBuffer, LastParticleStats);
+
+		//Submitted first so the compute queue starts while the graphics work is still being recorded
+		const double FrameTime = glfwGetTime();
+		VkCommandBuffer ComputeCommandBuffer = VulkanCore::BeginAsyncCompute(GFXDevice, Compute, CurrentBackBuffer);
+		VulkanCore::CmdSimulateParticles(ComputeCommandBuffer, Particles, static_cast<float> (std::min(FrameTime - LastFrameTime, 0.1)));
+		VulkanCore::CmdHandOffParticleSnapshot(Compute, Particles);
+		VulkanCore::SubmitAsyncCompute(GFXDevice, Compute);
+		LastFrameTime = FrameTime;
+
+		VulkanCore::BeginDescriptorFrame(GFXDevice, Descriptors, CurrentBackBuffer);
+		if (!TransformPath.bPushConstants)
+		{
+			VulkanCore::BeginUniformFrame(Uniforms, CurrentBackBuffer);
+		}
+		if (bBindless)
+		{
+			VulkanCore::BeginBindlessFrame(Bindless);
+		}
+
+		//Dirty transforms are rebuilt level by level on the job system, whatever survives culling is drawn
+		VulkanCore::UpdateSceneParallel(Jobs, World);
+		VulkanCore::CullScene(World, ViewFrustum, SceneDraws);
+
+		//Each visible node picks a level by projected error, the meshlet culled one fills this frame's indirect buffer with its surviving clusters
+		//Errors are in mesh units, so a node's distance is divided by its (uniform) scale, nodes aren't rotated so the camera moves into mesh space by translation and scale alone
+		vector<uint32_t> NodeLODs(SceneDraws.Nodes.size());
+		DrawCount = 0;
+		for (size_t i = 0; i < SceneDraws.Nodes.size(); ++i)
+		{
+			const VulkanCore::Mat4& NodeWorld = World.WorldMatrices[SceneDraws.Nodes[i]];
+			SceneRenderable& Renderable = Renderables[SceneDraws.RenderHandles[i]];
+			const float NodeScale = NodeWorld.Columns[0].X;
+			const float ObjectCamera[3] = { (CameraPosition[0] - NodeWorld.Columns[3].X) / NodeScale, (CameraPosition[1] - NodeWorld.Columns[3].Y) / NodeScale,
+				(CameraPosition[2] - NodeWorld.Columns[3].Z) / NodeScale };
+			const float* MeshCenter = Mesh.LODs.Center;
+			const float CameraDistance = sqrtf((MeshCenter[0] - ObjectCamera[0]) * (MeshCenter[0] - ObjectCamera[0]) +
+				(MeshCenter[1] - ObjectCamera[1]) * (MeshCenter[1] - ObjectCamera[1]) +
+				(MeshCenter[2] - ObjectCamera[2]) * (MeshCenter[2] - ObjectCamera[2]));
+			NodeLODs[i] = VulkanCore::SelectLOD(Mesh.LODs, CameraDistance, LODProjectionScale, Renderable.LOD);
+
+			//Clusters are tested in mesh space, against the frustum pulled back through the node's world matrix
+			if (Renderable.bMeshletCulled)
+			{
+				const VulkanCore::Frustum ObjectFrustum = VulkanCore::ExtractFrustumPlanes(VulkanCore::Mat4Multiply(ViewProjection, NodeWorld));
+				DrawCount = VulkanCore::CullMeshlets(Mesh.LODs.Levels[NodeLODs[i]].Meshlets, ObjectFrustum, ObjectCamera, Mesh.Geometry.FirstIndex,
+					Mesh.Geometry.VertexOffset, IndirectBuffers[CurrentBackBuffer].Commands);
+			}
+		}
 
 		VkCommandBufferBeginInfo beginInfo = {};
 		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
 
 		vkBeginCommandBuffer(CommandBuffers[CurrentBackBuffer], &beginInfo);
-
-		VkRenderPassBeginInfo renderPassBeginInfo = {};
-		renderPassBeginInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-		renderPassBeginInfo.framebuffer = Framebuffers[CurrentBackBuffer];
-		renderPassBeginInfo.renderArea.extent.width = Width;
-		renderPassBeginInfo.renderArea.extent.height = Height;
-		renderPassBeginInfo.renderPass = RenderPass;
-
-		VkClearValue clearValue = {};
-
-		clearValue.color.float32[0] = 0.042f;
-		clearValue.color.float32[1] = 0.042f;
-		clearValue.color.float32[2] = 0.042f;
-		clearValue.color.float32[3] = 1.0f;
-
-		renderPassBeginInfo.pClearValues = &clearValue;
-		renderPassBeginInfo.clearValueCount = 1;
-
-		vkCmdBeginRenderPass(CommandBuffers[CurrentBackBuffer], &renderPassBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
-
-		//Render Impl
-		vkCmdBindPipeline(CommandBuffers[CurrentBackBuffer], VK_PIPELINE_BIND_POINT_GRAPHICS, Pipeline);
-		VkDeviceSize offsets[] = { 0 };
-		vkCmdBindIndexBuffer(CommandBuffers[CurrentBackBuffer], Mesh.IndexBuffer, 0, VK_INDEX_TYPE_UINT32);
-		vkCmdBindVertexBuffers(CommandBuffers[CurrentBackBuffer], 0, 1, &Mesh.VertexBuffer, offsets);
-		vkCmdDrawIndexed(CommandBuffers[CurrentBackBuffer], 6, 1, 0, 0, 0);
-
-		vkCmdEndRenderPass(CommandBuffers[CurrentBackBuffer]);
+		VulkanCore::CmdResetGpuTimer(CommandBuffers[CurrentBackBuffer], GraphicsTimer, CurrentBackBuffer);
+		VulkanCore::CmdWriteGpuTimestamp(CommandBuffers[CurrentBackBuffer], GraphicsTimer, CurrentBackBuffer, 0, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT);
+		VulkanCore::CmdAcquireAsyncCompute(CommandBuffers[CurrentBackBuffer], Compute);
+		VulkanCore::CmdReadBackParticleSnapshot(CommandBuffers[CurrentBackBuffer], Particles, CurrentBackBuffer);
+
+		//Takes ownership of whatever the transfer queue finished since last frame, before the streamer swaps those images in
+		if (bAsyncUploads)
+		{
+			VulkanCore::BeginUploadFrame(GFXDevice, Uploads, CommandBuffers[CurrentBackBuffer]);
+		}
+
+		//Residency follows the levels the fragment shaders sampled when this back buffer's last frame ran
+		//Uploads are recorded before the render pass
+		VulkanCore::ReadTextureFeedback(GFXDevice, Streamer, CurrentBackBuffer);
+		VulkanCore::UpdateTextureStreaming(GFXDevice, Streamer, CommandBuffers[CurrentBackBuffer]);
+		if (bAsyncUploads)
+		{
+			VulkanCore::SubmitUploadBatch(GFXDevice, Uploads);
+		}
+
+		const VulkanCore::StreamedTexture& MeshTexture = Streamer.Textures[MeshTextureIndex];
+		const VkImageView MeshTextureView = VulkanCore::GetImage(Resources, MeshTexture.Resident).Image.View;
+		TextureSet = VK_NULL_HANDLE;
+		if (bBindless)
+		{
+			//A replaced image gets a fresh slot, the old one is reused once in-flight frames are done with it
+			if (MeshTexture.Version != MeshTextureVersion)
+			{
+				VulkanCore::ReleaseBindlessSlot(Bindless, VulkanCore::BindlessTextureBinding, MeshMaterial.TextureIndex);
+				MeshMaterial.TextureIndex = VulkanCore::RegisterBindlessTexture(Bindless, MeshTextureView, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+				MeshTextureVersion = MeshTexture.Version;
+			}
+			MeshMaterial.FeedbackBuffer = FeedbackBufferSlots[CurrentBackBuffer];
+			VulkanCore::FlushBindlessWrites(GFXDevice, Bindless);
+		}
+		else
+		{
+			TextureSet = VulkanCore::AllocateFrameDescriptorSet(GFXDevice, Descriptors, TextureSetLayout);
+			VulkanCore::WriteImage(DescriptorWrites, TextureSet, 0, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, MeshTextureView, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_NULL_HANDLE);
+			VulkanCore::WriteImage(DescriptorWrites, TextureSet, 1, VK_DESCRIPTOR_TYPE_SAMPLER, VK_NULL_HANDLE, VK_IMAGE_LAYOUT_UNDEFINED, MeshSampler);
+			VulkanCore::WriteBuffer(DescriptorWrites, TextureSet, 2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, Streamer.Feedback.Buffer,
+				VulkanCore::GetTextureFeedbackOffset(Streamer, CurrentBackBuffer), Streamer.Feedback.RegionRange);
+			VulkanCore::FlushDescriptorWrites(GFXDevice, DescriptorWrites);
+		}
+
+		//Every visible node becomes a queued draw of its own world matrix, mesh and material, keyed front to back by the clip space depth of its bounds' center
+		//Built after the material set above is allocated, sorted once all draws are in so draws sharing a permutation are recorded together
+		//Every permutation shares one cached layout, so the bindless table bound against the textured one stays bound across permutation switches
+		VulkanCore::ResetDrawQueue(Draws, TransformPath.Size);
+		ForwardKey.Features = VulkanCore::ShaderFeatureTextured;
+		ForwardPipeline = VulkanCore::GetGraphicsPipeline(GFXDevice, Pipelines, Resources, ForwardKey);
+		for (size_t i = 0; i < SceneDraws.Nodes.size(); ++i)
+		{
+			const VulkanCore::Mat4& NodeWorld = World.WorldMatrices[SceneDraws.Nodes[i]];
+			const VulkanCore::AABB& NodeBounds = World.WorldBounds[SceneDraws.Nodes[i]];
+			const VulkanCore::Vec3 Center = VulkanCore::Scale(VulkanCore::Add(NodeBounds.Min, NodeBounds.Max), 0.5f);
+			const VulkanCore::Vec4 ClipCenter = VulkanCore::Mat4Transform(ViewProjection, VulkanCore::MakeVec4(Center.X, Center.Y, Center.Z, 1.0f));
+			const SceneRenderable& Renderable = Renderables[SceneDraws.RenderHandles[i]];
+
+			//U shows every node's UVs
+			ForwardKey.Features = bShowUVs ? 0 : Renderable.Features;
+			uint32_t PipelineIndex = 0;
+			const VulkanCore::PipelineData& Pipeline = VulkanCore::GetPipeline(Resources,
+				VulkanCore::GetGraphicsPipeline(GFXDevice, Pipelines, Resources, ForwardKey, &PipelineIndex));
+
+			VulkanCore::DrawItem Item;
+			Item.Key = VulkanCore::MakeDrawKey(0, PipelineIndex, Renderable.MaterialId, Renderable.MeshId, ClipCenter.W > 0.0f ? ClipCenter.Z / ClipCenter.W : 0.0f);
+			Item.Pipeline = Pipeline.Pipeline;
+			Item.Layout = Pipeline.Layout;
+			Item.MaterialSet = bBindless ? VK_NULL_HANDLE : TextureSet;
+			Item.VertexBuffer = VulkanCore::GetBuffer(Resources, Geometry.VertexBuffer).Buffer;
+			Item.IndexBuffer = VulkanCore::GetBuffer(Resources, Geometry.IndexBuffer).Buffer;
+			if (Renderable.bMeshletCulled)
+			{
+				if (DrawCount == 0)
+				{
+					continue;
+				}
+				Item.IndirectBuffer = VulkanCore::GetBuffer(Resources, IndirectBuffers[CurrentBackBuffer].Buffer).Buffer;
+				Item.DrawCount = DrawCount;
+			}
+			else
+			{
+				const VulkanCore::MeshLODLevel& Level = Mesh.LODs.Levels[NodeLODs[i]];
+				Item.FirstIndex = Mesh.Geometry.FirstIndex + Level.FirstIndex;
+				Item.IndexCount = Level.IndexCount;
+				Item.VertexOffset = Mesh.Geometry.VertexOffset;
+			}
+
+			DrawUniforms MeshUniforms;
+			MeshUniforms.Transform = VulkanCore::Mat4Multiply(ViewProjection, NodeWorld);
+			VulkanCore::AddDraw(Draws, Item, &MeshUniforms);
+		}
+		VulkanCore::SortDrawQueue(Draws);
+
+		VulkanCore::SetGraphImage(FrameGraph, BackBufferResource, SwapchainImages[CurrentBackBuffer], SwapchainImageViews[CurrentBackBuffer]);
+		VulkanCore::ExecuteRenderGraph(GFXDevice, FrameGraph, RenderPasses, CommandBuffers[CurrentBackBuffer]);
+		VulkanCore::CmdFinishTextureFeedback(CommandBuffers[CurrentBackBuffer], Streamer);
+		DrawTotals.Draws += Draws.Stats.Draws;
+		DrawTotals.PipelineBinds += Draws.Stats.PipelineBinds;
+		DrawTotals.DescriptorBinds += Draws.Stats.DescriptorBinds;
+		DrawTotals.VertexBufferBinds += Draws.Stats.VertexBufferBinds;
+		DrawTotals.IndexBufferBinds += Draws.Stats.IndexBufferBinds;
+		DrawTotals.SkippedBinds += Draws.Stats.SkippedBinds;
+		++DrawFrames;
+		VulkanCore::CmdWriteGpuTimestamp(CommandBuffers[CurrentBackBuffer], GraphicsTimer, CurrentBackBuffer, 1, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT);
 		vkEndCommandBuffer(CommandBuffers[CurrentBackBuffer]);
 
-		// Submit rendering work to the graphics queue
-		const VkPipelineStageFlags waitDstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-		VkSubmitInfo submitInfo = {};
-		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-		submitInfo.waitSemaphoreCount = 1;
-		submitInfo.pWaitSemaphores = &ImageAcquiredSemaphore;
-		submitInfo.pWaitDstStageMask = &waitDstStageMask;
-		submitInfo.commandBufferCount = 1;
-		submitInfo.pCommandBuffers = &CommandBuffers[CurrentBackBuffer];
-		submitInfo.signalSemaphoreCount = 1;
-		submitInfo.pSignalSemaphores = &RenderingCompleteSemaphore;
-		vkQueueSubmit(GFXDevice.GraphicsQueue, 1, &submitInfo, VK_NULL_HANDLE);
+		// Submit rendering work to the graphics queue, also waiting on the upload batches and compute results acquired this frame
+		VulkanCore::TimelineSubmitInfo FrameSubmitInfo;
+		FrameSubmitInfo.CommandBuffers.push_back(CommandBuffers[CurrentBackBuffer]);
+		FrameSubmitInfo.WaitSemaphores.push_back(ImageAcquiredSemaphore);
+		FrameSubmitInfo.WaitStages.push_back(VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT);
+		FrameSubmitInfo.SignalSemaphores.push_back(RenderingCompleteSemaphore);
+		VulkanCore::AddTimelineWait(FrameSubmitInfo, Compute.Timeline, Compute.WaitValue, Compute.WaitStages);
+		if (bAsyncUploads)
+		{
+			VulkanCore::AddTimelineWait(FrameSubmitInfo, Uploads.Timeline, Uploads.WaitValue, Uploads.WaitStages);
+		}
+		FrameValues[CurrentBackBuffer] = VulkanCore::SubmitToTimeline(GFXDevice, GraphicsTimeline, FrameSubmitInfo);
 
 		// Submit present operation to present queue
 		VkPresentInfoKHR presentInfo = {};
@@ -195,37 +663,82 @@ int main(void)
 		presentInfo.pImageIndices = &CurrentBackBuffer;
 		vkQueuePresentKHR(GFXDevice.GraphicsQueue, &presentInfo);
 
-		vkQueueSubmit(GFXDevice.GraphicsQueue, 0, nullptr, FrameFences[CurrentBackBuffer]);
-
 		glfwPollEvents();
 	}
 
 	//VULKAN SHUTDOWN ///////////////////////////////////////////////////////////////////////
-	vkDestroyPipeline(GFXDevice.Device, Pipeline, nullptr);
+	vkDeviceWaitIdle(GFXDevice.Device);
+
+	//Shutdown releases go through the deletion queue like runtime ones, the device is idle so they all run at DestroyDeletionQueue
+	VulkanCore::PrintResourceMemory(Resources);
+	std::cout << "Pipeline cache: " << Pipelines.PipelinesCreated << " permutations compiled (" << Pipelines.PipelinesPrecompiled << " at startup), "
+		<< Pipelines.CacheHits << " lookups served from the cache" << std::endl;
+	VulkanCore::DestroyPipelineCache(GFXDevice, Pipelines, Resources, Deletions);
+	VulkanCore::FreeGeometry(Geometry, Mesh.Geometry);
+	VulkanCore::DestroyGeometryBuffer(Resources, Deletions, Geometry);
+	for (auto& IndirectBuffer : IndirectBuffers)
+	{
+		VulkanCore::DestroyIndirectDrawBuffer(Resources, Deletions, IndirectBuffer);
+	}
 
-	//Need to store pipeline layout
-	//vkDestroyPipelineLayout(GFXDevice.Device, pipelineLayout_, nullptr);
+	if (DrawFrames > 0)
+	{
+		std::cout << "Draw queue per frame: " << DrawTotals.Draws / DrawFrames << " draws, " << DrawTotals.PipelineBinds / DrawFrames << " pipeline, "
+			<< DrawTotals.DescriptorBinds / DrawFrames << " descriptor, " << DrawTotals.VertexBufferBinds / DrawFrames << " vertex buffer, "
+			<< DrawTotals.IndexBufferBinds / DrawFrames << " index buffer binds, " << DrawTotals.SkippedBinds / DrawFrames << " redundant binds skipped" << std::endl;
+	}
+	if (OverlapSamples > 0)
+	{
+		std::cout << "Per frame: graphics " << OverlapTotals.GraphicsMs / OverlapSamples << " ms, async compute " << OverlapTotals.ComputeMs / OverlapSamples
+			<< " ms, overlapped " << OverlapTotals.OverlapMs / OverlapSamples << " ms (" << OverlapSamples << " frames, "
+			<< (Compute.bDedicated ? "compute-only queue" : "graphics queue") << ")" << std::endl;
+	}
+	if (LastParticleStats.Sampled > 0)
+	{
+		std::cout << "Particles: " << LastParticleStats.Resting << " of " << LastParticleStats.Sampled << " sampled resting on the floor, average height "
+			<< LastParticleStats.AverageHeight << ", highest " << LastParticleStats.MaxHeight << std::endl;
+	}
+	VulkanCore::DestroyGpuTimer(GFXDevice, GraphicsTimer);
+	VulkanCore::DestroyParticleSystem(GFXDevice, Particles);
+	VulkanCore::DestroyAsyncComputeQueue(GFXDevice, Compute);
 
-	vkDestroyBuffer(GFXDevice.Device, Mesh.VertexBuffer, nullptr);
-	vkDestroyBuffer(GFXDevice.Device, Mesh.IndexBuffer, nullptr);
-	vkFreeMemory(GFXDevice.Device, Mesh.DeviceMemory, nullptr);
+	VulkanCore::DestroyDescriptorAllocator(GFXDevice, Descriptors);
+	if (!TransformPath.bPushConstants)
+	{
+		VulkanCore::DestroyUniformAllocator(GFXDevice, Resources, Deletions, Uniforms);
+	}
+	if (bBindless)
+	{
+		VulkanCore::DestroyBindlessTable(GFXDevice, Bindless);
+	}
+	VulkanCore::DestroySamplerCache(GFXDevice, Samplers);
+	if (bAsyncUploads)
+	{
+		VulkanCore::DestroyUploadScheduler(GFXDevice, Uploads);
+	}
+
+	//Runs the streamer's and render pass cache's pending releases too, so both are destroyed after it
+	VulkanCore::DestroyDeletionQueue(GFXDevice, Deletions);
+	VulkanCore::DestroyTextureStreamer(GFXDevice, Streamer);
+	std::cout << "Shader cache: " << Shaders.ModulesCreated << " modules created, " << Shaders.CacheHits << " duplicate loads shared" << std::endl;
+	VulkanCore::DestroyShaderModuleCache(GFXDevice, Shaders);
+	VulkanCore::DestroyResourceRegistry(GFXDevice, Resources);
 
-	vkDestroyShaderModule(GFXDevice.Device, VertexShader, nullptr);
-	vkDestroyShaderModule(GFXDevice.Device, FragmentShader, nullptr);
+	//Owns the pipeline layouts, so it goes once every pipeline is destroyed
+	VulkanCore::DestroyDescriptorLayoutCache(GFXDevice, LayoutCache);
 
 	vkDestroySemaphore(GFXDevice.Device, ImageAcquiredSemaphore, nullptr);
 	vkDestroySemaphore(GFXDevice.Device, RenderingCompleteSemaphore, nullptr);
 
-	for (int i = 0; i < FrameFences.size(); ++i)
-	{
-		vkDestroyFence(GFXDevice.Device, FrameFences[i], nullptr);
-	}
+	VulkanCore::DestroyQueueTimeline(GFXDevice, GraphicsTimeline);
 
-	vkDestroyRenderPass(GFXDevice.Device, RenderPass, nullptr);
+	std::cout << "Render pass cache: " << RenderPasses.RenderPassesCreated << " render passes, " << RenderPasses.FramebuffersCreated << " framebuffers created, "
+		<< RenderPasses.FramebuffersEvicted << " evicted" << std::endl;
+	VulkanCore::DestroyRenderGraph(GFXDevice, FrameGraph);
+	VulkanCore::DestroyRenderPassCache(GFXDevice, RenderPasses);
 
-	for (int i = 0; i < Framebuffers.size(); ++i)
+	for (int i = 0; i < SwapchainImageViews.size(); ++i)
 	{
-		vkDestroyFramebuffer(GFXDevice.Device, Framebuffers[i], nullptr);
 		vkDestroyImageView(GFXDevice.Device, SwapchainImageViews[i], nullptr);
 	}
 
@@ -237,6 +750,8 @@ int main(void)
 	vkDestroyDevice(GFXDevice.Device, nullptr);
 	vkDestroyInstance(Instance, nullptr);
 
+	VulkanCore::DestroyJobSystem(Jobs);
+
 	std::cout << "Vulkan Shutdown Complete" << std::endl;
 
 	glfwDestroyWindow(window);